@@ -0,0 +1,48 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: a global "resource heap" of mutable descriptors, addressed in shaders by stable indices
+
+#pragma once
+
+#define NRI_BINDLESS_HEAP_H 1
+
+#include "../NRI.h"
+
+NriNamespaceBegin
+
+NriForwardStruct(BindlessHeap);
+
+static const uint32_t NriConstant(BINDLESS_HEAP_INVALID_SLOT) = (uint32_t)-1; // returned if the heap is full
+
+// Requires "features.mutableDescriptorType" and "tiers.bindless != 0"
+NriStruct(BindlessHeapDesc) {
+    NriPtr(DescriptorPool) descriptorPool; // the heap descriptor set is allocated from it (needs "ALLOW_UPDATE_AFTER_SET", 1 set and "slotNum" in "mutableMaxNum"), must outlive the heap and not be reset
+    uint32_t slotNum;                   // number of descriptors in the heap
+    uint32_t registerSpace;             // "space" of the heap descriptor set in pipeline layouts, must be unique
+    uint32_t baseRegisterIndex;         // the heap is a single "MUTABLE" array of "slotNum" descriptors starting at this register
+    Nri(StageBits) shaderStages;
+    Nri(PipelineLayoutBits) pipelineLayoutFlags; // only "IGNORE_GLOBAL_SPIRV_OFFSETS" matters, must match pipeline layouts accessing the heap
+
+    // Deferred slot reuse
+    NriOptional NriPtr(Fence) fence;    // values of this fence are passed to "FreeBindlessHeapSlot"
+};
+
+// Threadsafe: yes
+NriStruct(BindlessHeapInterface) {
+    Nri(Result)                     (NRI_CALL *CreateBindlessHeap)                  (NriRef(Device) device, const NriRef(BindlessHeapDesc) bindlessHeapDesc, NriOut NriRef(BindlessHeap*) bindlessHeap);
+    void                            (NRI_CALL *DestroyBindlessHeap)                 (NriPtr(BindlessHeap) bindlessHeap);
+
+    // Must be added to "PipelineLayoutDesc::descriptorSets" of pipeline layouts accessing the heap
+    const NriRef(DescriptorSetDesc) (NRI_CALL *GetBindlessHeapDescriptorSetDesc)    (const NriRef(BindlessHeap) bindlessHeap);
+
+    // Statically allocated (never changes), can be bound once per command buffer via "CmdSetDescriptorSet" (along with "descriptorPool")
+    NriPtr(DescriptorSet)           (NRI_CALL *GetBindlessHeapDescriptorSet)        (const NriRef(BindlessHeap) bindlessHeap);
+
+    // (HOST) Write a descriptor into a free slot. Return the slot index for shaders or "BINDLESS_HEAP_INVALID_SLOT" if the heap is full
+    uint32_t                        (NRI_CALL *AllocateBindlessHeapSlot)            (NriRef(BindlessHeap) bindlessHeap, const NriRef(Descriptor) descriptor);
+
+    // (HOST) The slot gets reused after "fence" reaches "fenceValue" (0 - immediately). The descriptor must not be accessed by the GPU after that
+    void                            (NRI_CALL *FreeBindlessHeapSlot)                (NriRef(BindlessHeap) bindlessHeap, uint32_t slot, uint64_t fenceValue);
+};
+
+NriNamespaceEnd
@@ -0,0 +1,37 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: contention-free transient descriptor sets, carved from private per-frame descriptor pools
+
+#pragma once
+
+#define NRI_DESCRIPTOR_ALLOCATOR_H 1
+
+#include "../NRI.h"
+
+NriNamespaceBegin
+
+NriForwardStruct(DescriptorAllocator);
+
+NriStruct(DescriptorAllocatorDesc) {
+    Nri(DescriptorPoolDesc) poolDesc;   // a single pool, more pools get chained if a frame needs more ("GROWABLE" is added implicitly)
+    NriPtr(Fence) fence;                // values of this fence are passed to "BeginDescriptorAllocatorFrame"
+    uint32_t poolMaxNum;                // max number of pools (all frames in flight), allocations fail if more are needed
+};
+
+// Threadsafe: no (an allocator is owned by a recording thread, allocators don't share pools)
+NriStruct(DescriptorAllocatorInterface) {
+    Nri(Result)             (NRI_CALL *CreateDescriptorAllocator)       (NriRef(Device) device, const NriRef(DescriptorAllocatorDesc) descriptorAllocatorDesc, NriOut NriRef(DescriptorAllocator*) descriptorAllocator);
+    void                    (NRI_CALL *DestroyDescriptorAllocator)      (NriPtr(DescriptorAllocator) descriptorAllocator);
+
+    // Descriptor sets allocated after this call are valid until "fence" reaches "fenceValue". Pools of completed frames get reset and reused
+    void                    (NRI_CALL *BeginDescriptorAllocatorFrame)   (NriRef(DescriptorAllocator) descriptorAllocator, uint64_t fenceValue);
+
+    // Bump-allocate a descriptor set and, if "descriptors" is provided, write it at once (see "UpdateDescriptorSet"). Return NULL on failure
+    NriPtr(DescriptorSet)   (NRI_CALL *AllocateDescriptorSet)           (NriRef(DescriptorAllocator) descriptorAllocator, const NriRef(PipelineLayout) pipelineLayout, uint32_t setIndex, NriOptional const NriPtr(Descriptor) const* descriptors);
+
+    // The pool of the last allocated descriptor set, it must be bound via "CmdSetDescriptorPool" before the set is bound
+    // A new pool gets chained (i.e. the returned pool changes) if the current one is exhausted in the middle of a frame
+    NriPtr(DescriptorPool)  (NRI_CALL *GetDescriptorAllocatorPool)      (const NriRef(DescriptorAllocator) descriptorAllocator);
+};
+
+NriNamespaceEnd
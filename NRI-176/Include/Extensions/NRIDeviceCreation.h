@@ -78,6 +78,9 @@ NriStruct(DeviceCreationDesc) {
     bool enableD3D11CommandBufferEmulation;     // enable? but why? (auto-enabled if deferred contexts are not supported)
     bool enableD3D12RayTracingValidation;       // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
     bool enableMemoryZeroInitialization;        // page-clears are fast, but memory is not cleared by default in VK
+    bool enableVKGraphicsPipelineLibrary;       // link graphics pipelines from cached parts via "VK_EXT_graphics_pipeline_library" (monolithic pipelines if unsupported), see "OptimizePipeline"
+    bool enableVKShaderObject;                  // bind graphics shaders as "VK_EXT_shader_object" objects and set all fixed-function state dynamically (pipelines if unsupported), takes precedence over "enableVKGraphicsPipelineLibrary"
+    bool enableVKDescriptorBuffer;              // back descriptor pools with host-visible "VK_EXT_descriptor_buffer" memory: updates become CPU writes, binding becomes offset-based (descriptor pools if unsupported)
 
     // Switches (enabled by default)
     bool disableVKRayTracing;                   // to save CPU memory in some implementations
@@ -0,0 +1,86 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: GPU-generated command sequences, which can change root constants, vertex and index buffers between draws or dispatches
+// https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_device_generated_commands.html
+
+#pragma once
+
+#define NRI_INDIRECT_COMMANDS_H 1
+
+#include "../NRI.h"
+
+NriNamespaceBegin
+
+NriForwardStruct(IndirectCommandLayout);
+
+// A sequence is a set of commands, the last command must be an action command
+NriEnum(IndirectCommandType, uint8_t,   // Data in a sequence:
+    ROOT_CONSTANTS,                     // "rootConstantSize" bytes
+    VERTEX_BUFFER,                      // "IndirectVertexBufferDesc"
+    INDEX_BUFFER,                       // "IndirectIndexBufferDesc"
+    DRAW,                               // "DrawDesc" (action)
+    DRAW_INDEXED,                       // "DrawIndexedDesc" (action)
+    DISPATCH                            // "DispatchDesc" (action)
+);
+
+NriStruct(IndirectVertexBufferDesc) {
+    uint64_t deviceAddress; // see "GetIndirectBufferDeviceAddress", can be offsetted
+    uint32_t size;
+    uint32_t stride;
+};
+
+NriStruct(IndirectIndexBufferDesc) {
+    uint64_t deviceAddress; // see "GetIndirectBufferDeviceAddress", can be offsetted
+    uint32_t size;
+    uint32_t indexType;     // 0 - UINT16, 1 - UINT32
+};
+
+NriStruct(IndirectCommandDesc) {
+    Nri(IndirectCommandType) type;
+    uint32_t offset;                // offset of the command data in a sequence, must be a multiple of 4
+    uint32_t rootConstantIndex;     // "ROOT_CONSTANTS" only
+    uint32_t rootConstantSize;      // "ROOT_CONSTANTS" only
+    uint32_t vertexBufferSlot;      // "VERTEX_BUFFER" only
+};
+
+NriStruct(IndirectCommandLayoutDesc) {
+    const NriPtr(PipelineLayout) pipelineLayout;    // root constants are taken from this layout
+    const NriPtr(IndirectCommandDesc) commands;
+    uint32_t commandNum;
+    uint32_t stride;                                // sequence size, must be a multiple of 4
+};
+
+NriStruct(ExecuteIndirectCommandsDesc) {
+    const NriPtr(IndirectCommandLayout) indirectCommandLayout;
+    const NriPtr(Buffer) buffer;                    // "ARGUMENT_BUFFER" usage, contains sequences
+    uint64_t offset;
+    uint32_t sequenceMaxNum;
+    NriOptional const NriPtr(Buffer) countBuffer;   // "ARGUMENT_BUFFER" usage, contains "uint32_t" number of sequences (clamped to "sequenceMaxNum")
+    uint64_t countBufferOffset;
+    NriOptional NriPtr(Buffer) preprocessBuffer;    // "PREPROCESS_BUFFER" usage, at least "GetIndirectCommandsPreprocessSize" bytes (not needed if the size is 0)
+};
+
+// Native with "VK_EXT_device_generated_commands", otherwise emulated during recording on the CPU:
+//  - "buffer" and "countBuffer" must be CPU-visible and filled before "CmdExecuteIndirectCommands"
+//  - buffers referenced by "IndirectVertexBufferDesc" and "IndirectIndexBufferDesc" must have memory bound before their addresses are queried
+// Threadsafe: yes
+NriStruct(IndirectCommandsInterface) {
+    Nri(Result)     (NRI_CALL *CreateIndirectCommandLayout)         (NriRef(Device) device, const NriRef(IndirectCommandLayoutDesc) indirectCommandLayoutDesc, NriOut NriRef(IndirectCommandLayout*) indirectCommandLayout);
+    void            (NRI_CALL *DestroyIndirectCommandLayout)        (NriPtr(IndirectCommandLayout) indirectCommandLayout);
+
+    // Address of a vertex or index buffer for "IndirectVertexBufferDesc" and "IndirectIndexBufferDesc"
+    uint64_t        (NRI_CALL *GetIndirectBufferDeviceAddress)      (const NriRef(Buffer) buffer);
+
+    // Size of a preprocess buffer needed to execute up to "sequenceMaxNum" sequences with "pipeline" bound (0 if emulated)
+    uint64_t        (NRI_CALL *GetIndirectCommandsPreprocessSize)   (const NriRef(IndirectCommandLayout) indirectCommandLayout, const NriRef(Pipeline) pipeline, uint32_t sequenceMaxNum);
+
+    // Command buffer
+    // {
+        // Sequences are executed with the bound pipeline. Root constants, vertex and index buffers are undefined after the call
+        // If emulated, "buffer" and "countBuffer" are read on the CPU right here: GPU writes (even earlier in this command buffer) are not seen,
+        // i.e. the buffers must be in host-visible memory and written on the host before recording
+        void        (NRI_CALL *CmdExecuteIndirectCommands)          (NriRef(CommandBuffer) commandBuffer, const NriRef(ExecuteIndirectCommandsDesc) executeIndirectCommandsDesc);
+    // }
+};
+
+NriNamespaceEnd
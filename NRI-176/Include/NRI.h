@@ -80,6 +80,7 @@ NriStruct(CoreInterface) {
     // Create (doesn't assume allocation of big chunks of memory on the device, but it happens for some entities implicitly)
     Nri(Result)         (NRI_CALL *CreateCommandAllocator)          (NriRef(Queue) queue, NriOut NriRef(CommandAllocator*) commandAllocator);
     Nri(Result)         (NRI_CALL *CreateCommandBuffer)             (NriRef(CommandAllocator) commandAllocator, NriOut NriRef(CommandBuffer*) commandBuffer);
+    Nri(Result)         (NRI_CALL *CreateSecondaryCommandBuffer)    (NriRef(CommandAllocator) commandAllocator, NriOut NriRef(CommandBuffer*) commandBuffer); // requires "features.secondaryCommandBuffer"
     Nri(Result)         (NRI_CALL *CreateFence)                     (NriRef(Device) device, uint64_t initialValue, NriOut NriRef(Fence*) fence);
     Nri(Result)         (NRI_CALL *CreateDescriptorPool)            (NriRef(Device) device, const NriRef(DescriptorPoolDesc) descriptorPoolDesc, NriOut NriRef(DescriptorPool*) descriptorPool);
     Nri(Result)         (NRI_CALL *CreatePipelineLayout)            (NriRef(Device) device, const NriRef(PipelineLayoutDesc) pipelineLayoutDesc, NriOut NriRef(PipelineLayout*) pipelineLayout);
@@ -133,17 +134,39 @@ NriStruct(CoreInterface) {
     Nri(Result)         (NRI_CALL *CreatePlacedBuffer)              (NriRef(Device) device, NriPtr(Memory) memory, uint64_t offset, const NriRef(BufferDesc) bufferDesc, NriOut NriRef(Buffer*) buffer);
     Nri(Result)         (NRI_CALL *CreatePlacedTexture)             (NriRef(Device) device, NriPtr(Memory) memory, uint64_t offset, const NriRef(TextureDesc) textureDesc, NriOut NriRef(Texture*) texture);
 
+    // Pipeline
+    // - "OptimizePipeline" relinks a pipeline created from pipeline libraries (see "enableVKGraphicsPipelineLibrary") with link time optimizations and swaps it in
+    // - it's slow, better call it from a background thread. Command buffers recorded before and after the swap are valid
+    // - NOP if the pipeline is not built from pipeline libraries or already optimized
+    // - "GetPipelineStats" returns creation statistics of a pipeline, "GetPipelineCreationStats" - aggregated over all pipelines created on the device
+    Nri(Result)         (NRI_CALL *OptimizePipeline)                (NriRef(Pipeline) pipeline);
+    void                (NRI_CALL *GetPipelineStats)                (const NriRef(Pipeline) pipeline, NriOut NriRef(PipelineStats) pipelineStats);
+    void                (NRI_CALL *GetPipelineCreationStats)        (const NriRef(Device) device, NriOut NriRef(PipelineCreationStats) pipelineCreationStats);
+
+    // Descriptor cache
+    // - identical "CreateSampler" and "CreateXxxView" calls share native samplers and views (ref-counted), but return different descriptors
+    void                (NRI_CALL *GetDescriptorCacheStats)         (const NriRef(Device) device, NriOut NriRef(DescriptorCacheStats) descriptorCacheStats);
+
     // Descriptor set management (entities don't require destroying)
     // - if "ALLOW_UPDATE_AFTER_SET" not used, descriptor sets (and data pointed to by descriptors) must be updated before "CmdSetDescriptorSet"
     // - if "ALLOW_UPDATE_AFTER_SET" used, descriptor sets (and data pointed to by descriptors) can be updated after "CmdSetDescriptorSet"
     // - "ResetDescriptorPool" resets the pool and and wipes out all allocated descriptor sets
+    // - "GetDescriptorPoolStats" returns peak usage of the pool, which can be used to size it better next run
+    // - "UpdateDescriptorSet" writes all descriptors of a set at once, "descriptors" go range by range ("descriptorNum" per range). Not for sets with "VARIABLE_SIZED_ARRAY" ranges
     Nri(Result)         (NRI_CALL *AllocateDescriptorSets)          (NriRef(DescriptorPool) descriptorPool, const NriRef(PipelineLayout) pipelineLayout, uint32_t setIndex, NriOut NriPtr(DescriptorSet)* descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
     void                (NRI_CALL *UpdateDescriptorRanges)          (const NriPtr(UpdateDescriptorRangeDesc) updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum);
+    void                (NRI_CALL *UpdateDescriptorSet)             (NriRef(DescriptorSet) descriptorSet, const NriPtr(Descriptor) const* descriptors);
     void                (NRI_CALL *CopyDescriptorRanges)            (const NriPtr(CopyDescriptorRangeDesc) copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum);
     void                (NRI_CALL *ResetDescriptorPool)             (NriRef(DescriptorPool) descriptorPool);
+    void                (NRI_CALL *GetDescriptorPoolStats)          (const NriRef(DescriptorPool) descriptorPool, NriOut NriRef(DescriptorPoolStats) descriptorPoolStats);
 
     // Command buffer (one time submit)
     Nri(Result)         (NRI_CALL *BeginCommandBuffer)              (NriRef(CommandBuffer) commandBuffer, const NriPtr(DescriptorPool) descriptorPool);
+
+    // Secondary command buffer (one time submit), continues rendering of a primary command buffer started with the same "attachmentsDesc" and "secondaryCommandBuffers = true".
+    // Recording is "inside CmdBeginRendering/CmdEndRendering" until "EndCommandBuffer". The bound state is not inherited, i.e. pipeline layout, pipeline, descriptor sets and etc. must be set again
+    Nri(Result)         (NRI_CALL *BeginSecondaryCommandBuffer)     (NriRef(CommandBuffer) commandBuffer, const NriRef(AttachmentsDesc) attachmentsDesc, const NriPtr(DescriptorPool) descriptorPool);
+
     // {                {
         // Set descriptor pool (initially can be set via "BeginCommandBuffer")
         void                (NRI_CALL *CmdSetDescriptorPool)        (NriRef(CommandBuffer) commandBuffer, const NriRef(DescriptorPool) descriptorPool);
@@ -151,13 +174,14 @@ NriStruct(CoreInterface) {
         // Resource binding (expect "CmdSetPipelineLayout" to be called first)
         void                (NRI_CALL *CmdSetPipelineLayout)        (NriRef(CommandBuffer) commandBuffer, Nri(BindPoint) bindPoint, const NriRef(PipelineLayout) pipelineLayout);
         void                (NRI_CALL *CmdSetDescriptorSet)         (NriRef(CommandBuffer) commandBuffer, const NriRef(SetDescriptorSetDesc) setDescriptorSetDesc);
+        void                (NRI_CALL *CmdSetDescriptorSets)        (NriRef(CommandBuffer) commandBuffer, const NriRef(SetDescriptorSetsDesc) setDescriptorSetsDesc); // required for sets with "DYNAMIC_OFFSET" ranges
         void                (NRI_CALL *CmdSetRootConstants)         (NriRef(CommandBuffer) commandBuffer, const NriRef(SetRootConstantsDesc) setRootConstantsDesc);
         void                (NRI_CALL *CmdSetRootDescriptor)        (NriRef(CommandBuffer) commandBuffer, const NriRef(SetRootDescriptorDesc) setRootDescriptorDesc);
 
         // Pipeline
         void                (NRI_CALL *CmdSetPipeline)              (NriRef(CommandBuffer) commandBuffer, const NriRef(Pipeline) pipeline);
 
-        // Barrier
+        // Barrier (VK: deferred until the next command, which needs it, and merged with adjacent barriers)
         void                (NRI_CALL *CmdBarrier)                  (NriRef(CommandBuffer) commandBuffer, const NriRef(BarrierDesc) barrierDesc);
 
         // Input assembly
@@ -178,6 +202,13 @@ NriStruct(CoreInterface) {
         // State override
         void                (NRI_CALL *CmdSetDepthBias)             (NriRef(CommandBuffer) commandBuffer, const NriRef(DepthBiasDesc) depthBiasDesc); // requires "features.dynamicDepthBias"
 
+        // Dynamic state, if enabled via "GraphicsPipelineDesc::dynamicState" in the current pipeline (must be set before drawing)
+        void                (NRI_CALL *CmdSetTopology)              (NriRef(CommandBuffer) commandBuffer, Nri(Topology) topology);
+        void                (NRI_CALL *CmdSetCullMode)              (NriRef(CommandBuffer) commandBuffer, Nri(CullMode) cullMode, bool frontCounterClockwise);
+        void                (NRI_CALL *CmdSetDepthState)            (NriRef(CommandBuffer) commandBuffer, const NriRef(DepthAttachmentDesc) depthAttachmentDesc);
+        void                (NRI_CALL *CmdSetStencilState)          (NriRef(CommandBuffer) commandBuffer, const NriRef(StencilAttachmentDesc) stencilAttachmentDesc);
+        void                (NRI_CALL *CmdSetBlendState)            (NriRef(CommandBuffer) commandBuffer, uint32_t baseAttachment, const NriPtr(ColorAttachmentDesc) colorAttachmentDescs, uint32_t colorAttachmentNum);
+
         // Graphics
         void                (NRI_CALL *CmdBeginRendering)           (NriRef(CommandBuffer) commandBuffer, const NriRef(AttachmentsDesc) attachmentsDesc);
         // {                {
@@ -188,11 +219,18 @@ NriStruct(CoreInterface) {
             void                (NRI_CALL *CmdDraw)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawDesc) drawDesc);
             void                (NRI_CALL *CmdDrawIndexed)          (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawIndexedDesc) drawIndexedDesc);
 
+            // Draw multi (many draws in one call, "stride" is the distance between descs in bytes, 0 means tightly packed)
+            void                (NRI_CALL *CmdDrawMulti)            (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawDesc) drawDescs, uint32_t drawNum, uint32_t stride);
+            void                (NRI_CALL *CmdDrawIndexedMulti)     (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawIndexedDesc) drawIndexedDescs, uint32_t drawNum, uint32_t stride);
+
             // Draw indirect:
             //  - drawNum = min(drawNum, countBuffer ? countBuffer[countBufferOffset] : INF)
             //  - see "Modified draw command signatures"
             void                (NRI_CALL *CmdDrawIndirect)         (NriRef(CommandBuffer) commandBuffer, const NriRef(Buffer) buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, NriOptional const NriPtr(Buffer) countBuffer, uint64_t countBufferOffset); // "buffer" contains "Draw(Base)Desc" commands
             void                (NRI_CALL *CmdDrawIndexedIndirect)  (NriRef(CommandBuffer) commandBuffer, const NriRef(Buffer) buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, NriOptional const NriPtr(Buffer) countBuffer, uint64_t countBufferOffset); // "buffer" contains "DrawIndexed(Base)Desc" commands
+
+            // Secondary command buffers (the only allowed command if "AttachmentsDesc::secondaryCommandBuffers = true"). The bound state is undefined afterwards
+            void                (NRI_CALL *CmdExecuteCommandBuffers) (NriRef(CommandBuffer) commandBuffer, const NriPtr(CommandBuffer) const* commandBuffers, uint32_t commandBufferNum);
         // }                }
         void                (NRI_CALL *CmdEndRendering)             (NriRef(CommandBuffer) commandBuffer);
 
@@ -202,6 +240,7 @@ NriStruct(CoreInterface) {
 
         // Copy
         void                (NRI_CALL *CmdCopyBuffer)               (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, uint64_t dstOffset, const NriRef(Buffer) srcBuffer, uint64_t srcOffset, uint64_t size);
+        void                (NRI_CALL *CmdCopyBufferRegions)        (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(Buffer) srcBuffer, const NriPtr(BufferCopyRegionDesc) regions, uint32_t regionNum); // destination ranges must not overlap
         void                (NRI_CALL *CmdCopyTexture)              (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, NriOptional const NriPtr(TextureRegionDesc) dstRegion, const NriRef(Texture) srcTexture, NriOptional const NriPtr(TextureRegionDesc) srcRegion);
         void                (NRI_CALL *CmdUploadBufferToTexture)    (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, const NriRef(TextureRegionDesc) dstRegion, const NriRef(Buffer) srcBuffer, const NriRef(TextureDataLayoutDesc) srcDataLayout);
         void                (NRI_CALL *CmdReadbackTextureToBuffer)  (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(TextureDataLayoutDesc) dstDataLayout, const NriRef(Texture) srcTexture, const NriRef(TextureRegionDesc) srcRegion);
@@ -212,6 +251,7 @@ NriStruct(CoreInterface) {
 
         // Clear (potentially slow)
         void                (NRI_CALL *CmdClearStorage)             (NriRef(CommandBuffer) commandBuffer, const NriRef(ClearStorageDesc) clearDesc);
+        void                (NRI_CALL *CmdClearStorages)            (NriRef(CommandBuffer) commandBuffer, const NriPtr(ClearStorageDesc) clearDescs, uint32_t clearDescNum); // one barrier covers the whole batch, clears can be reordered (overlapping clears must use the same value)
 
         // Query
         void                (NRI_CALL *CmdResetQueries)             (NriRef(CommandBuffer) commandBuffer, NriRef(QueryPool) queryPool, uint32_t offset, uint32_t num);
@@ -225,6 +265,7 @@ NriStruct(CoreInterface) {
         void                (NRI_CALL *CmdAnnotation)               (NriRef(CommandBuffer) commandBuffer, const char* name, uint32_t bgra);
     // }                }
     Nri(Result)         (NRI_CALL *EndCommandBuffer)                (NriRef(CommandBuffer) commandBuffer); // D3D11 performs state tracking and resets it there
+    void                (NRI_CALL *GetCommandBufferStats)           (const NriRef(CommandBuffer) commandBuffer, NriOut NriRef(CommandBufferStats) commandBufferStats); // native commands recorded in between are not tracked
 
     // Annotations for profiling tools: command queue - D3D11: NOP
     void                (NRI_CALL *QueueBeginAnnotation)            (NriRef(Queue) queue, const char* name, uint32_t bgra);
@@ -250,7 +291,8 @@ NriStruct(CoreInterface) {
     void*               (NRI_CALL *MapBuffer)                       (NriRef(Buffer) buffer, uint64_t offset, uint64_t size);
     void                (NRI_CALL *UnmapBuffer)                     (NriRef(Buffer) buffer);
 
-    // Debug name for any object declared as "NriForwardStruct" (skipped for buffers & textures in D3D if they are not bound to a memory)
+    // Debug name for any object declared as "NriForwardStruct" (skipped for buffers & textures in D3D if they are not bound to a memory,
+    // and for image views, buffer views and samplers in VK, which are shared between descriptors with identical descs)
     void                (NRI_CALL *SetDebugName)                    (NriPtr(Object) object, const char* name);
 
     // Native objects                                                                                            ___D3D11 (latest interface)________|_D3D12 (latest interface)____|_VK_________________________________
@@ -505,6 +505,8 @@ NriStruct(BufferBarrierDesc) {
     NriPtr(Buffer) buffer;  // use "GetAccelerationStructureBuffer" and "GetMicromapBuffer" for related barriers
     Nri(AccessStage) before;
     Nri(AccessStage) after;
+    uint64_t offset;        // VK only, D3D: the whole buffer is used
+    uint64_t size;          // can be "WHOLE_SIZE" (the rest of the buffer)
 };
 
 NriStruct(TextureBarrierDesc) {
@@ -585,7 +587,8 @@ NriBits(BufferUsageBits, uint16_t,                 // Min compatible access:
     ACCELERATION_STRUCTURE_BUILD_INPUT  = NriBit(8),  // SHADER_RESOURCE                         Read-only input in "CmdBuildAccelerationStructures" command
     ACCELERATION_STRUCTURE_STORAGE      = NriBit(9),  // ACCELERATION_STRUCTURE_READ/WRITE       (INTERNAL) acceleration structure storage
     MICROMAP_BUILD_INPUT                = NriBit(10), // SHADER_RESOURCE                         Read-only input in "CmdBuildMicromaps" command
-    MICROMAP_STORAGE                    = NriBit(11)  // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    MICROMAP_STORAGE                    = NriBit(11), // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    PREPROCESS_BUFFER                   = NriBit(12)  // ARGUMENT_BUFFER                         Preprocess buffer in "CmdExecuteIndirectCommands" command
 );
 
 NriStruct(TextureDesc) {
@@ -878,7 +881,8 @@ NriBits(PipelineLayoutBits, uint8_t,
 
 NriBits(DescriptorPoolBits, uint8_t,
     NONE                                    = 0,
-    ALLOW_UPDATE_AFTER_SET                  = NriBit(0)  // allows "DescriptorSetBits::ALLOW_UPDATE_AFTER_SET"
+    ALLOW_UPDATE_AFTER_SET                  = NriBit(0), // allows "DescriptorSetBits::ALLOW_UPDATE_AFTER_SET"
+    GROWABLE                                = NriBit(1)  // VK: an exhausted pool chains a new native pool twice bigger than the previous one (ignored in "descriptor buffer" mode)
 );
 
 NriBits(DescriptorSetBits, uint8_t,
@@ -897,7 +901,10 @@ NriBits(DescriptorRangeBits, uint8_t,
     ALLOW_UPDATE_AFTER_SET                  = NriBit(3), // descriptors in range can be updated after "CmdSetDescriptorSet" but before "QueueSubmit", also works as "DATA_VOLATILE"
 
     // https://docs.vulkan.org/features/latest/features/proposals/VK_EXT_mutable_descriptor_type.html
-    MUTABLE                                 = NriBit(4)  // descriptors in range may have various non-sampler types (aka "resource heap" concept)
+    MUTABLE                                 = NriBit(4), // descriptors in range may have various non-sampler types (aka "resource heap" concept)
+
+    // https://docs.vulkan.org/guide/latest/descriptor_dynamic_offset.html
+    DYNAMIC_OFFSET                          = NriBit(5)  // "CONSTANT_BUFFER", "STRUCTURED_BUFFER" or "STORAGE_STRUCTURED_BUFFER" descriptors get an additional offset at bind time via "CmdSetDescriptorSets", requires "features.dynamicDescriptorOffset"
 );
 
 // https://registry.khronos.org/vulkan/specs/latest/man/html/VkDescriptorType.html
@@ -994,9 +1001,26 @@ NriStruct(DescriptorPoolDesc) {
     uint32_t accelerationStructureMaxNum;   // number of "ACCELERATION_STRUCTURE" descriptors, requires "features.rayTracing"
     uint32_t mutableMaxNum;                 // number of descriptors for "DescriptorRangeBits::MUTABLE", requires "features.mutableDescriptorType"
 
+    // Dynamic offset descriptors are not included in the numbers above
+    uint32_t dynamicConstantBufferMaxNum;   // number of "CONSTANT_BUFFER" descriptors for "DescriptorRangeBits::DYNAMIC_OFFSET", requires "features.dynamicDescriptorOffset"
+    uint32_t dynamicStructuredBufferMaxNum; // number of "STRUCTURED_BUFFER" and "STORAGE_STRUCTURED_BUFFER" descriptors for "DescriptorRangeBits::DYNAMIC_OFFSET", requires "features.dynamicDescriptorOffset"
+
     Nri(DescriptorPoolBits) flags;
 };
 
+// Can be used to size "DescriptorPoolDesc" better next run
+NriStruct(DescriptorPoolStats) {
+    Nri(DescriptorPoolDesc) peakUsage;      // VK: max numbers of allocated descriptor sets and descriptors between resets
+    uint32_t chainedPoolNum;                // VK: number of native pools, can be > 1 only if "GROWABLE" is set
+};
+
+// VK only, zeros otherwise. Identical views and samplers share native objects
+NriStruct(DescriptorCacheStats) {
+    uint64_t hitNum;                        // number of "CreateSampler" and "CreateXxxView" calls reused an existing native object
+    uint32_t viewNum;                       // live native image and buffer views
+    uint32_t samplerNum;                    // live native samplers, must not exceed "samplerAllocationMaxNum"
+};
+
 // Updating/initializing descriptors in a descriptor set
 NriStruct(UpdateDescriptorRangeDesc) {
     // Destination
@@ -1028,6 +1052,17 @@ NriStruct(SetDescriptorSetDesc) {
     NriOptional Nri(BindPoint) bindPoint;
 };
 
+// Binds "descriptorSetNum" sets starting from "baseSetIndex" at once
+// - "dynamicOffsets" go set by set, in binding order within a set (i.e. ordered by register index), one per "DYNAMIC_OFFSET" descriptor
+NriStruct(SetDescriptorSetsDesc) {
+    uint32_t baseSetIndex;
+    const NriPtr(DescriptorSet) const* descriptorSets;
+    uint32_t descriptorSetNum;
+    NriOptional const uint32_t* dynamicOffsets; // must be aligned to "memoryAlignment.constantBufferOffset" or "memoryAlignment.bufferShaderResourceOffset"
+    NriOptional uint32_t dynamicOffsetNum;
+    NriOptional Nri(BindPoint) bindPoint;
+};
+
 NriStruct(SetRootConstantsDesc) {  // requires "pipelineLayoutRootConstantMaxSize > 0"
     uint32_t rootConstantIndex;
     const void* data;
@@ -1384,6 +1419,7 @@ NriStruct(AttachmentsDesc) {
     const NriPtr(Descriptor) const* colors;
     uint32_t colorNum;
     NriOptional uint32_t viewMask;          // if non-0, requires "viewMaxNum > 1"
+    NriOptional bool secondaryCommandBuffers; // if "true", the content is provided only by "CmdExecuteCommandBuffers", requires "features.secondaryCommandBuffer"
 };
 
 #pragma endregion
@@ -1400,6 +1436,17 @@ NriEnum(Robustness, uint8_t,
     D3D12           // moderate overhead, D3D12-level robust access (requires "VK_EXT_robustness2", soft fallback to VK mode)
 );
 
+// Dynamic state: the corresponding part of "GraphicsPipelineDesc" is ignored, the state must be set via "CmdSetXxx" after "CmdSetPipeline"
+// https://docs.vulkan.org/samples/latest/samples/extensions/dynamic_state3/README.html
+NriBits(DynamicStateBits, uint8_t,
+    NONE                                    = 0,
+    TOPOLOGY                                = NriBit(0), // "InputAssemblyDesc::topology" (within the same class: points, lines, triangles or patches), see "CmdSetTopology"
+    CULL_MODE                               = NriBit(1), // "RasterizationDesc::cullMode" and "frontCounterClockwise", see "CmdSetCullMode"
+    DEPTH                                   = NriBit(2), // "OutputMergerDesc::depth", see "CmdSetDepthState"
+    STENCIL                                 = NriBit(3), // "OutputMergerDesc::stencil", see "CmdSetStencilState"
+    BLEND                                   = NriBit(4)  // "ColorAttachmentDesc" except "format", see "CmdSetBlendState" (requires "features.dynamicBlendState")
+);
+
 // It's recommended to use "NRI.hlsl" in the shader code
 NriStruct(ShaderDesc) {
     Nri(StageBits) stage;
@@ -1418,6 +1465,7 @@ NriStruct(GraphicsPipelineDesc) {
     const NriPtr(ShaderDesc) shaders;
     uint32_t shaderNum;
     NriOptional Nri(Robustness) robustness;
+    NriOptional Nri(DynamicStateBits) dynamicState; // requires "features.dynamicState"
 };
 
 NriStruct(ComputePipelineDesc) {
@@ -1426,6 +1474,24 @@ NriStruct(ComputePipelineDesc) {
     NriOptional Nri(Robustness) robustness;
 };
 
+// VK only ("VK_EXT_pipeline_creation_feedback" for driver-provided values), zeros otherwise
+NriStruct(PipelineStats) {
+    uint64_t hash;            // stable across runs (shaders and state, but not "pipelineLayout"), a key for offline precompilation lists
+    uint64_t creationTime;    // us, CPU time spent in "CreateXxxPipeline"
+    uint64_t compilationTime; // us, driver-reported, 0 if unknown
+    uint32_t stageNum;
+    uint32_t cacheHitStageNum; // stages found in a cache, driver-reported
+    bool cacheHit;             // the whole pipeline was found in a cache, driver-reported
+};
+
+// Device-wide aggregate of "PipelineStats" of all successfully created pipelines
+NriStruct(PipelineCreationStats) {
+    Nri(PipelineStats) slowestPipelines[8]; // sorted by "creationTime", the slowest first
+    uint64_t totalCreationTime;             // us
+    uint32_t pipelineNum;
+    uint32_t slowestPipelineNum; // valid entries in "slowestPipelines"
+};
+
 #pragma endregion
 
 //============================================================================================================================================================================================
@@ -1533,6 +1599,12 @@ NriStruct(DrawIndexedBaseDesc) {         // see NRI_FILL_DRAW_INDEXED_COMMAND
 //============================================================================================================================================================================================
 
 // Copy
+NriStruct(BufferCopyRegionDesc) {
+    uint64_t dstOffset;
+    uint64_t srcOffset;
+    uint64_t size;          // can be "WHOLE_SIZE" (same rules as in "CmdCopyBuffer")
+};
+
 NriStruct(TextureRegionDesc) {
     Nri(Dim_t) x;
     Nri(Dim_t) y;
@@ -1594,6 +1666,34 @@ NriStruct(ClearStorageDesc) {
     uint32_t descriptorIndex;
 };
 
+// Counters are reset in "BeginCommandBuffer". Batched commands count each element
+NriStruct(CommandBufferStats) {
+    // Recorded commands
+    uint64_t recordingTime;                 // us, CPU time between "BeginCommandBuffer" and "EndCommandBuffer" (0 until "EndCommandBuffer")
+    uint64_t rootConstantSize;              // bytes passed to "CmdSetRootConstants"
+    uint32_t drawNum;                       // draws, including multi, indirect and mesh tasks ones (an indirect call is counted once)
+    uint32_t dispatchNum;                   // compute and ray dispatches, including indirect ones
+    uint32_t descriptorBindNum;             // descriptor sets and root descriptors passed to "CmdSetDescriptorSet(s)" and "CmdSetRootDescriptor"
+    uint32_t copyNum;                       // buffer and texture copies, uploads, readbacks, resolves and "CmdZeroBuffer" calls
+    uint32_t clearNum;                      // attachment and storage clears
+
+    // VK only, zeros otherwise. Identical state is not rebound
+    uint32_t skippedPipelineNum;            // "CmdSetPipeline" calls with the bound pipeline
+    uint32_t skippedPipelineLayoutNum;      // "CmdSetPipelineLayout" calls with the bound pipeline layout
+    uint32_t skippedDescriptorSetNum;       // "CmdSetDescriptorSet" calls with the bound descriptor set
+    uint32_t skippedVertexBufferNum;        // "CmdSetVertexBuffers" calls with the bound vertex buffers
+    uint32_t skippedIndexBufferNum;         // "CmdSetIndexBuffer" calls with the bound index buffer
+    uint32_t skippedViewportNum;            // "CmdSetViewports" calls with the current viewports
+    uint32_t skippedScissorNum;             // "CmdSetScissors" calls with the current scissors
+    uint32_t skippedStencilReferenceNum;    // "CmdSetStencilReference" calls with the current references
+    uint32_t skippedDepthBiasNum;           // "CmdSetDepthBias" calls and depth bias updates in "CmdSetPipeline" with the current depth bias
+
+    // Barriers
+    uint32_t requestedBarrierNum;           // global, buffer and texture barriers passed to "CmdBarrier"
+    uint32_t emittedBarrierNum;             // VK only: native barriers after merging (barriers are deferred until the next command, which needs them)
+    uint32_t barrierBatchNum;               // VK only: "vkCmdPipelineBarrier2" calls
+};
+
 #pragma endregion
 
 //============================================================================================================================================================================================
@@ -1904,6 +2004,8 @@ NriStruct(DeviceDesc) {
         uint32_t copyQueueTimestamp                              : 1; // see "QueryType::TIMESTAMP_COPY_QUEUE"
         uint32_t meshShaderPipelineStats                         : 1; // see "PipelineStatisticsDesc"
         uint32_t dynamicDepthBias                                : 1; // see "CmdSetDepthBias"
+        uint32_t dynamicState                                    : 1; // see "DynamicStateBits"
+        uint32_t dynamicBlendState                               : 1; // see "DynamicStateBits::BLEND"
         uint32_t additionalShadingRates                          : 1; // see "ShadingRate"
         uint32_t viewportOriginBottomLeft                        : 1; // see "Viewport"
         uint32_t regionResolve                                   : 1; // see "CmdResolveTexture"
@@ -1917,6 +2019,8 @@ NriStruct(DeviceDesc) {
         uint32_t rootConstantsOffset                             : 1; // see "SetRootConstantsDesc" (unsupported only in D3D11)
         uint32_t nonConstantBufferRootDescriptorOffset           : 1; // see "SetRootDescriptorDesc" (unsupported only in D3D11)
         uint32_t mutableDescriptorType                           : 1; // see "DescriptorRangeBits::MUTABLE"
+        uint32_t dynamicDescriptorOffset                         : 1; // see "DescriptorRangeBits::DYNAMIC_OFFSET" (VK only)
+        uint32_t secondaryCommandBuffer                          : 1; // see "CreateSecondaryCommandBuffer" (VK only)
     } features;
 
     // Shader features
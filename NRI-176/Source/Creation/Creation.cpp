@@ -507,6 +507,14 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(CoreInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(CoreInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(BindlessHeapInterface))) {
+        realInterfaceSize = sizeof(BindlessHeapInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(BindlessHeapInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(DescriptorAllocatorInterface))) {
+        realInterfaceSize = sizeof(DescriptorAllocatorInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(DescriptorAllocatorInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(ImguiInterface))) {
         realInterfaceSize = sizeof(ImguiInterface);
         if (realInterfaceSize == interfaceSize)
@@ -515,6 +523,10 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(HelperInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(HelperInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(IndirectCommandsInterface))) {
+        realInterfaceSize = sizeof(IndirectCommandsInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(IndirectCommandsInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(LowLatencyInterface))) {
         realInterfaceSize = sizeof(LowLatencyInterface);
         if (realInterfaceSize == interfaceSize)
@@ -68,6 +68,7 @@ struct CommandBufferD3D11 final : public CommandBufferBase {
     void SetPipeline(const Pipeline& pipeline);
     void SetDescriptorPool(const DescriptorPool& descriptorPool);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
+    void SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc);
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
@@ -103,6 +103,8 @@ NRI_INLINE Result CommandBufferD3D11::Begin(const DescriptorPool* descriptorPool
     m_StencilRef = 0;
     m_BlendFactor = {};
 
+    BeginStats();
+
     if (descriptorPool)
         SetDescriptorPool(*descriptorPool);
 
@@ -115,6 +117,8 @@ NRI_INLINE Result CommandBufferD3D11::End() {
 
     m_BindingState.UnbindAndReset(m_DeferredContext);
 
+    EndStats();
+
     return Result::SUCCESS;
 }
 
@@ -194,6 +198,8 @@ NRI_INLINE void CommandBufferD3D11::SetBlendConstants(const Color32f& color) {
 }
 
 NRI_INLINE void CommandBufferD3D11::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
+    m_Stats.clearNum += clearDescNum;
+
     if (!clearDescNum)
         return;
 
@@ -240,6 +246,8 @@ NRI_INLINE void CommandBufferD3D11::ClearAttachments(const ClearDesc* clearDescs
 }
 
 NRI_INLINE void CommandBufferD3D11::ClearStorage(const ClearStorageDesc& clearDesc) {
+    m_Stats.clearNum++;
+
     DescriptorD3D11& storage = *(DescriptorD3D11*)clearDesc.storage;
 
     if (storage.IsIntegerFormat() || storage.IsBuffer())
@@ -374,17 +382,34 @@ NRI_INLINE void CommandBufferD3D11::SetDescriptorPool(const DescriptorPool&) {
 }
 
 NRI_INLINE void CommandBufferD3D11::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    m_Stats.descriptorBindNum++;
+
     BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetDesc.bindPoint;
     const DescriptorSetD3D11& descriptorSetD3D11 = *(DescriptorSetD3D11*)setDescriptorSetDesc.descriptorSet;
 
     m_PipelineLayout->SetDescriptorSet(bindPoint, m_BindingState, m_DeferredContext, setDescriptorSetDesc.setIndex, &descriptorSetD3D11, nullptr, 0);
 }
 
+NRI_INLINE void CommandBufferD3D11::SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    for (uint32_t i = 0; i < setDescriptorSetsDesc.descriptorSetNum; i++) {
+        SetDescriptorSetDesc setDescriptorSetDesc = {};
+        setDescriptorSetDesc.setIndex = setDescriptorSetsDesc.baseSetIndex + i;
+        setDescriptorSetDesc.descriptorSet = setDescriptorSetsDesc.descriptorSets[i];
+        setDescriptorSetDesc.bindPoint = setDescriptorSetsDesc.bindPoint;
+
+        SetDescriptorSet(setDescriptorSetDesc);
+    }
+}
+
 NRI_INLINE void CommandBufferD3D11::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
+    m_Stats.rootConstantSize += setRootConstantsDesc.size;
+
     m_PipelineLayout->SetRootConstants(m_DeferredContext, setRootConstantsDesc);
 }
 
 NRI_INLINE void CommandBufferD3D11::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    m_Stats.descriptorBindNum++;
+
     BindPoint bindPoint = setRootDescriptorDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setRootDescriptorDesc.bindPoint;
     uint32_t setIndex = m_PipelineLayout->GetRootBindingIndex(setRootDescriptorDesc.rootDescriptorIndex);
     const DescriptorD3D11& descriptorD3D11 = *(DescriptorD3D11*)setRootDescriptorDesc.descriptor;
@@ -393,14 +418,20 @@ NRI_INLINE void CommandBufferD3D11::SetRootDescriptor(const SetRootDescriptorDes
 }
 
 NRI_INLINE void CommandBufferD3D11::Draw(const DrawDesc& drawDesc) {
+    m_Stats.drawNum++;
+
     m_DeferredContext->DrawInstanced(drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
 }
 
 NRI_INLINE void CommandBufferD3D11::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    m_Stats.drawNum++;
+
     m_DeferredContext->DrawIndexedInstanced(drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
 NRI_INLINE void CommandBufferD3D11::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     MaybeUnused(countBuffer, countBufferOffset);
 
     const BufferD3D11& bufferD3D11 = (BufferD3D11&)buffer;
@@ -433,6 +464,8 @@ NRI_INLINE void CommandBufferD3D11::DrawIndirect(const Buffer& buffer, uint64_t
 }
 
 NRI_INLINE void CommandBufferD3D11::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     MaybeUnused(countBuffer, countBufferOffset);
 
     const BufferD3D11& bufferD3D11 = (BufferD3D11&)buffer;
@@ -465,6 +498,8 @@ NRI_INLINE void CommandBufferD3D11::DrawIndexedIndirect(const Buffer& buffer, ui
 }
 
 NRI_INLINE void CommandBufferD3D11::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    m_Stats.copyNum++;
+
     const BufferD3D11& dst = (BufferD3D11&)dstBuffer;
     const BufferD3D11& src = (BufferD3D11&)srcBuffer;
 
@@ -489,6 +524,8 @@ NRI_INLINE void CommandBufferD3D11::CopyBuffer(Buffer& dstBuffer, uint64_t dstOf
 }
 
 NRI_INLINE void CommandBufferD3D11::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     const TextureD3D11& dst = (TextureD3D11&)dstTexture;
     const TextureD3D11& src = (TextureD3D11&)srcTexture;
 
@@ -521,6 +558,8 @@ NRI_INLINE void CommandBufferD3D11::CopyTexture(Texture& dstTexture, const Textu
 }
 
 NRI_INLINE void CommandBufferD3D11::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    m_Stats.copyNum++;
+
     BufferD3D11& src = (BufferD3D11&)srcBuffer;
     const TextureD3D11& dst = (TextureD3D11&)dstTexture;
 
@@ -547,6 +586,8 @@ NRI_INLINE void CommandBufferD3D11::UploadBufferToTexture(Texture& dstTexture, c
 }
 
 NRI_INLINE void CommandBufferD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    m_Stats.copyNum++;
+
     CHECK(dstDataLayout.offset == 0, "D3D11 implementation currently supports copying a texture region to a buffer only with offset = 0!");
 
     BufferD3D11& dst = (BufferD3D11&)dstBuffer;
@@ -565,6 +606,8 @@ NRI_INLINE void CommandBufferD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer, c
 }
 
 NRI_INLINE void CommandBufferD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    m_Stats.copyNum++;
+
     const BufferD3D11& dst = (BufferD3D11&)buffer;
     ID3D11Buffer* zeroBuffer = m_Device.GetZeroBuffer();
 
@@ -591,6 +634,8 @@ NRI_INLINE void CommandBufferD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset,
 }
 
 NRI_INLINE void CommandBufferD3D11::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     const TextureD3D11& dst = (TextureD3D11&)dstTexture;
     const TextureD3D11& src = (TextureD3D11&)srcTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -619,14 +664,20 @@ NRI_INLINE void CommandBufferD3D11::ResolveTexture(Texture& dstTexture, const Te
 }
 
 NRI_INLINE void CommandBufferD3D11::Dispatch(const DispatchDesc& dispatchDesc) {
+    m_Stats.dispatchNum++;
+
     m_DeferredContext->Dispatch(dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
 
 NRI_INLINE void CommandBufferD3D11::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
     m_DeferredContext->DispatchIndirect((BufferD3D11&)buffer, (uint32_t)offset);
 }
 
 NRI_INLINE void CommandBufferD3D11::Barrier(const BarrierDesc& barrierDesc) {
+    m_Stats.requestedBarrierNum += barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum;
+
     if (barrierDesc.textureNum == 0 && barrierDesc.bufferNum == 0)
         return;
 
@@ -56,6 +56,7 @@ struct CommandBufferEmuD3D11 final : public CommandBufferBase {
     void SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout);
     void SetPipeline(const Pipeline& pipeline);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
+    void SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc);
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
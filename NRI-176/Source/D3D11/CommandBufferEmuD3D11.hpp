@@ -485,12 +485,16 @@ NRI_INLINE Result CommandBufferEmuD3D11::Begin(const DescriptorPool* descriptorP
     Push(m_PushBuffer, BEGIN);
     Push(m_PushBuffer, descriptorPool);
 
+    BeginStats();
+
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result CommandBufferEmuD3D11::End() {
     Push(m_PushBuffer, END);
 
+    EndStats();
+
     return Result::SUCCESS;
 }
 
@@ -528,12 +532,16 @@ NRI_INLINE void CommandBufferEmuD3D11::SetBlendConstants(const Color32f& color)
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
+    m_Stats.clearNum += clearDescNum;
+
     Push(m_PushBuffer, CLEAR_ATTACHMENTS);
     Push(m_PushBuffer, clearDescs, clearDescNum);
     Push(m_PushBuffer, rects, rectNum);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::ClearStorage(const ClearStorageDesc& clearDesc) {
+    m_Stats.clearNum++;
+
     Push(m_PushBuffer, CLEAR_STORAGE);
     Push(m_PushBuffer, clearDesc);
 }
@@ -573,32 +581,55 @@ NRI_INLINE void CommandBufferEmuD3D11::SetPipeline(const Pipeline& pipeline) {
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    m_Stats.descriptorBindNum++;
+
     Push(m_PushBuffer, SET_DESCRIPTOR_SET);
     Push(m_PushBuffer, setDescriptorSetDesc);
 }
 
+NRI_INLINE void CommandBufferEmuD3D11::SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    for (uint32_t i = 0; i < setDescriptorSetsDesc.descriptorSetNum; i++) {
+        SetDescriptorSetDesc setDescriptorSetDesc = {};
+        setDescriptorSetDesc.setIndex = setDescriptorSetsDesc.baseSetIndex + i;
+        setDescriptorSetDesc.descriptorSet = setDescriptorSetsDesc.descriptorSets[i];
+        setDescriptorSetDesc.bindPoint = setDescriptorSetsDesc.bindPoint;
+
+        SetDescriptorSet(setDescriptorSetDesc);
+    }
+}
+
 NRI_INLINE void CommandBufferEmuD3D11::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
+    m_Stats.rootConstantSize += setRootConstantsDesc.size;
+
     Push(m_PushBuffer, SET_ROOT_CONSTANTS);
     Push(m_PushBuffer, setRootConstantsDesc);
     Push(m_PushBuffer, (uint8_t*)setRootConstantsDesc.data, setRootConstantsDesc.size);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    m_Stats.descriptorBindNum++;
+
     Push(m_PushBuffer, SET_ROOT_DESCRIPTOR);
     Push(m_PushBuffer, setRootDescriptorDesc);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::Draw(const DrawDesc& drawDesc) {
+    m_Stats.drawNum++;
+
     Push(m_PushBuffer, DRAW);
     Push(m_PushBuffer, drawDesc);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    m_Stats.drawNum++;
+
     Push(m_PushBuffer, DRAW_INDEXED);
     Push(m_PushBuffer, drawIndexedDesc);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     Push(m_PushBuffer, DRAW_INDIRECT);
     Push(m_PushBuffer, &buffer);
     Push(m_PushBuffer, offset);
@@ -609,6 +640,8 @@ NRI_INLINE void CommandBufferEmuD3D11::DrawIndirect(const Buffer& buffer, uint64
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     Push(m_PushBuffer, DRAW_INDEXED_INDIRECT);
     Push(m_PushBuffer, &buffer);
     Push(m_PushBuffer, offset);
@@ -619,6 +652,8 @@ NRI_INLINE void CommandBufferEmuD3D11::DrawIndexedIndirect(const Buffer& buffer,
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    m_Stats.copyNum++;
+
     Push(m_PushBuffer, COPY_BUFFER);
     Push(m_PushBuffer, &dstBuffer);
     Push(m_PushBuffer, dstOffset);
@@ -628,6 +663,8 @@ NRI_INLINE void CommandBufferEmuD3D11::CopyBuffer(Buffer& dstBuffer, uint64_t ds
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     TextureRegionDesc wholeResource = {};
     wholeResource.mipOffset = NULL_TEXTURE_REGION_DESC;
 
@@ -644,6 +681,8 @@ NRI_INLINE void CommandBufferEmuD3D11::CopyTexture(Texture& dstTexture, const Te
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    m_Stats.copyNum++;
+
     Push(m_PushBuffer, UPLOAD_BUFFER_TO_TEXTURE);
     Push(m_PushBuffer, &dstTexture);
     Push(m_PushBuffer, dstRegion);
@@ -652,6 +691,8 @@ NRI_INLINE void CommandBufferEmuD3D11::UploadBufferToTexture(Texture& dstTexture
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    m_Stats.copyNum++;
+
     Push(m_PushBuffer, READBACK_TEXTURE_TO_BUFFER);
     Push(m_PushBuffer, &dstBuffer);
     Push(m_PushBuffer, dstDataLayout);
@@ -660,6 +701,8 @@ NRI_INLINE void CommandBufferEmuD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    m_Stats.copyNum++;
+
     Push(m_PushBuffer, ZERO_BUFFER);
     Push(m_PushBuffer, &buffer);
     Push(m_PushBuffer, offset);
@@ -667,6 +710,8 @@ NRI_INLINE void CommandBufferEmuD3D11::ZeroBuffer(Buffer& buffer, uint64_t offse
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     TextureRegionDesc wholeResource = {};
     wholeResource.mipOffset = NULL_TEXTURE_REGION_DESC;
 
@@ -683,17 +728,23 @@ NRI_INLINE void CommandBufferEmuD3D11::ResolveTexture(Texture& dstTexture, const
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::Dispatch(const DispatchDesc& dispatchDesc) {
+    m_Stats.dispatchNum++;
+
     Push(m_PushBuffer, DISPATCH);
     Push(m_PushBuffer, dispatchDesc);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
     Push(m_PushBuffer, DISPATCH_INDIRECT);
     Push(m_PushBuffer, &buffer);
     Push(m_PushBuffer, offset);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::Barrier(const BarrierDesc& barrierDesc) {
+    m_Stats.requestedBarrierNum += barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum;
+
     Push(m_PushBuffer, BARRIER);
     Push(m_PushBuffer, barrierDesc.globals, barrierDesc.globalNum);
     Push(m_PushBuffer, barrierDesc.buffers, barrierDesc.bufferNum);
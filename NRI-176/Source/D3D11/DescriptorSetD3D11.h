@@ -20,6 +20,7 @@ struct DescriptorSetD3D11 final : public DebugNameBase {
     //================================================================================================================
 
     static void UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum);
+    void UpdateDescriptorSet(const Descriptor* const* descriptors);
     static void Copy(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum);
 
 private:
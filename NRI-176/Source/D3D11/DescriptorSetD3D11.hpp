@@ -23,6 +23,11 @@ NRI_INLINE void DescriptorSetD3D11::UpdateDescriptorRanges(const UpdateDescripto
     }
 }
 
+NRI_INLINE void DescriptorSetD3D11::UpdateDescriptorSet(const Descriptor* const* descriptors) {
+    // Descriptors of all ranges are stored consecutively
+    memcpy(m_Descriptors, descriptors, m_BindingSet->descriptorNum * sizeof(DescriptorD3D11*));
+}
+
 NRI_INLINE void DescriptorSetD3D11::Copy(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
         const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
@@ -122,6 +122,8 @@ struct DeviceD3D11 final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(BindlessHeapInterface& table) const override;
+    Result FillFunctionTable(DescriptorAllocatorInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
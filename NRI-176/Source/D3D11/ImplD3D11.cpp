@@ -18,6 +18,8 @@
 #include "SwapChainD3D11.h"
 #include "TextureD3D11.h"
 
+#include "BindlessHeapInterface.h"
+#include "DescriptorAllocatorInterface.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
 #include "StreamerInterface.h"
@@ -97,6 +99,12 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, C
     return ((CommandAllocatorD3D11&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator&, CommandBuffer*& commandBuffer) {
+    commandBuffer = nullptr;
+
+    return Result::UNSUPPORTED;
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
     return ((DeviceD3D11&)device).CreateImplementation<FenceD3D11>(fence, initialValue);
 }
@@ -277,6 +285,22 @@ static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint6
     return CreateCommittedTexture(device, memoryLocation, priority, textureDesc, texture);
 }
 
+static Result NRI_CALL OptimizePipeline(Pipeline&) {
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL GetPipelineStats(const Pipeline&, PipelineStats& pipelineStats) {
+    pipelineStats = {};
+}
+
+static void NRI_CALL GetPipelineCreationStats(const Device&, PipelineCreationStats& pipelineCreationStats) {
+    pipelineCreationStats = {};
+}
+
+static void NRI_CALL GetDescriptorCacheStats(const Device&, DescriptorCacheStats& descriptorCacheStats) {
+    descriptorCacheStats = {};
+}
+
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     return ((DescriptorPoolD3D11&)descriptorPool).AllocateDescriptorSets(pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
 }
@@ -285,6 +309,10 @@ static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* upd
     DescriptorSetD3D11::UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
+static void NRI_CALL UpdateDescriptorSet(DescriptorSet& descriptorSet, const Descriptor* const* descriptors) {
+    ((DescriptorSetD3D11&)descriptorSet).UpdateDescriptorSet(descriptors);
+}
+
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     DescriptorSetD3D11::Copy(copyDescriptorRangeDescs, copyDescriptorRangeDescNum);
 }
@@ -293,6 +321,10 @@ static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
     ((DescriptorPoolD3D11&)descriptorPool).Reset();
 }
 
+static void NRI_CALL GetDescriptorPoolStats(const DescriptorPool&, DescriptorPoolStats& descriptorPoolStats) {
+    descriptorPoolStats = {};
+}
+
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
     return ((CommandBufferD3D11&)commandBuffer).Begin(descriptorPool);
 }
@@ -309,6 +341,10 @@ static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const Set
     ((CommandBufferD3D11&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
+static void NRI_CALL CmdSetDescriptorSets(CommandBuffer& commandBuffer, const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    ((CommandBufferD3D11&)commandBuffer).SetDescriptorSets(setDescriptorSetsDesc);
+}
+
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
     ((CommandBufferD3D11&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
@@ -363,6 +399,21 @@ static void NRI_CALL CmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&) {
 static void NRI_CALL CmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer&, Topology) {
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer&, CullMode, bool) {
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer&, const DepthAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer&, const StencilAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetBlendState(CommandBuffer&, uint32_t, const ColorAttachmentDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferD3D11&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -379,6 +430,24 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferD3D11&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawDescs;
+    if (!stride)
+        stride = sizeof(DrawDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).Draw(*(DrawDesc*)(ptr + i * stride));
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawIndexedDescs;
+    if (!stride)
+        stride = sizeof(DrawIndexedDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).DrawIndexed(*(DrawIndexedDesc*)(ptr + i * stride));
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferD3D11&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -403,6 +472,11 @@ static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuff
     ((CommandBufferD3D11&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferD3D11&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -427,6 +501,11 @@ static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearSt
     ((CommandBufferD3D11&)commandBuffer).ClearStorage(clearDesc);
 }
 
+static void NRI_CALL CmdClearStorages(CommandBuffer& commandBuffer, const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    for (uint32_t i = 0; i < clearDescNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).ClearStorage(clearDescs[i]);
+}
+
 static void NRI_CALL CmdResetQueries(CommandBuffer&, QueryPool&, uint32_t, uint32_t) {
 }
 
@@ -467,6 +546,17 @@ static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
     return ((CommandBufferD3D11&)commandBuffer).End();
 }
 
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = ((CommandBufferBase&)commandBuffer).GetStats();
+}
+
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer&, const AttachmentsDesc&, const DescriptorPool*) {
+    return Result::UNSUPPORTED;
+}
+
+static void NRI_CALL CmdExecuteCommandBuffers(CommandBuffer&, const CommandBuffer* const*, uint32_t) {
+}
+
 static void NRI_CALL QueueBeginAnnotation(Queue&, const char*, uint32_t) {
 }
 
@@ -577,6 +667,10 @@ static void NRI_CALL EmuCmdSetDescriptorSet(CommandBuffer& commandBuffer, const
     ((CommandBufferEmuD3D11&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
+static void NRI_CALL EmuCmdSetDescriptorSets(CommandBuffer& commandBuffer, const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    ((CommandBufferEmuD3D11&)commandBuffer).SetDescriptorSets(setDescriptorSetsDesc);
+}
+
 static void NRI_CALL EmuSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
     ((CommandBufferEmuD3D11&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
@@ -647,6 +741,24 @@ static void NRI_CALL EmuCmdDrawIndexed(CommandBuffer& commandBuffer, const DrawI
     ((CommandBufferEmuD3D11&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL EmuCmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawDescs;
+    if (!stride)
+        stride = sizeof(DrawDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).Draw(*(DrawDesc*)(ptr + i * stride));
+}
+
+static void NRI_CALL EmuCmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawIndexedDescs;
+    if (!stride)
+        stride = sizeof(DrawIndexedDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).DrawIndexed(*(DrawIndexedDesc*)(ptr + i * stride));
+}
+
 static void NRI_CALL EmuCmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferEmuD3D11&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -671,6 +783,11 @@ static void NRI_CALL EmuCmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstB
     ((CommandBufferEmuD3D11&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
+static void NRI_CALL EmuCmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 static void NRI_CALL EmuCmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferEmuD3D11&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -695,6 +812,11 @@ static void NRI_CALL EmuCmdClearStorage(CommandBuffer& commandBuffer, const Clea
     ((CommandBufferEmuD3D11&)commandBuffer).ClearStorage(clearDesc);
 }
 
+static void NRI_CALL EmuCmdClearStorages(CommandBuffer& commandBuffer, const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    for (uint32_t i = 0; i < clearDescNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).ClearStorage(clearDescs[i]);
+}
+
 static void NRI_CALL EmuCmdResetQueries(CommandBuffer&, QueryPool&, uint32_t, uint32_t) {
 }
 
@@ -753,6 +875,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTexture1DView = ::CreateTexture1DView;
@@ -788,10 +911,19 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
     table.CreateCommittedTexture = ::CreateCommittedTexture;
     table.CreatePlacedBuffer = ::CreatePlacedBuffer;
     table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.OptimizePipeline = ::OptimizePipeline;
+    table.GetPipelineStats = ::GetPipelineStats;
+    table.GetPipelineCreationStats = ::GetPipelineCreationStats;
+    table.GetDescriptorCacheStats = ::GetDescriptorCacheStats;
     table.AllocateDescriptorSets = ::AllocateDescriptorSets;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.UpdateDescriptorSet = ::UpdateDescriptorSet;
     table.CopyDescriptorRanges = ::CopyDescriptorRanges;
     table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorPoolStats = ::GetDescriptorPoolStats;
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
+    table.CmdExecuteCommandBuffers = ::CmdExecuteCommandBuffers;
     table.QueueBeginAnnotation = ::QueueBeginAnnotation;
     table.QueueEndAnnotation = ::QueueEndAnnotation;
     table.QueueAnnotation = ::QueueAnnotation;
@@ -814,6 +946,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.BeginCommandBuffer = ::EmuBeginCommandBuffer;
         table.CmdSetDescriptorPool = ::EmuCmdSetDescriptorPool;
         table.CmdSetDescriptorSet = ::EmuCmdSetDescriptorSet;
+        table.CmdSetDescriptorSets = ::EmuCmdSetDescriptorSets;
         table.CmdSetPipelineLayout = ::EmuCmdSetPipelineLayout;
         table.CmdSetPipeline = ::EmuCmdSetPipeline;
         table.CmdSetRootConstants = ::EmuSetRootConstants;
@@ -829,22 +962,31 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdSetSampleLocations = ::EmuCmdSetSampleLocations;
         table.CmdSetShadingRate = ::EmuCmdSetShadingRate;
         table.CmdSetDepthBias = ::EmuCmdSetDepthBias;
+        table.CmdSetTopology = ::CmdSetTopology;
+        table.CmdSetCullMode = ::CmdSetCullMode;
+        table.CmdSetDepthState = ::CmdSetDepthState;
+        table.CmdSetStencilState = ::CmdSetStencilState;
+        table.CmdSetBlendState = ::CmdSetBlendState;
         table.CmdBeginRendering = ::EmuCmdBeginRendering;
         table.CmdClearAttachments = ::EmuCmdClearAttachments;
         table.CmdDraw = ::EmuCmdDraw;
         table.CmdDrawIndexed = ::EmuCmdDrawIndexed;
+        table.CmdDrawMulti = ::EmuCmdDrawMulti;
+        table.CmdDrawIndexedMulti = ::EmuCmdDrawIndexedMulti;
         table.CmdDrawIndirect = ::EmuCmdDrawIndirect;
         table.CmdDrawIndexedIndirect = ::EmuCmdDrawIndexedIndirect;
         table.CmdEndRendering = ::EmuCmdEndRendering;
         table.CmdDispatch = ::EmuCmdDispatch;
         table.CmdDispatchIndirect = ::EmuCmdDispatchIndirect;
         table.CmdCopyBuffer = ::EmuCmdCopyBuffer;
+        table.CmdCopyBufferRegions = ::EmuCmdCopyBufferRegions;
         table.CmdCopyTexture = ::EmuCmdCopyTexture;
         table.CmdUploadBufferToTexture = ::EmuCmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::EmuCmdReadbackTextureToBuffer;
         table.CmdZeroBuffer = ::EmuCmdFillBuffer;
         table.CmdResolveTexture = ::EmuCmdResolveTexture;
         table.CmdClearStorage = ::EmuCmdClearStorage;
+        table.CmdClearStorages = ::EmuCmdClearStorages;
         table.CmdResetQueries = ::EmuCmdResetQueries;
         table.CmdBeginQuery = ::EmuCmdBeginQuery;
         table.CmdEndQuery = ::EmuCmdEndQuery;
@@ -858,6 +1000,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.BeginCommandBuffer = ::BeginCommandBuffer;
         table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
         table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+        table.CmdSetDescriptorSets = ::CmdSetDescriptorSets;
         table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
         table.CmdSetPipeline = ::CmdSetPipeline;
         table.CmdSetRootConstants = ::CmdSetRootConstants;
@@ -873,22 +1016,31 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdSetSampleLocations = ::CmdSetSampleLocations;
         table.CmdSetShadingRate = ::CmdSetShadingRate;
         table.CmdSetDepthBias = ::CmdSetDepthBias;
+        table.CmdSetTopology = ::CmdSetTopology;
+        table.CmdSetCullMode = ::CmdSetCullMode;
+        table.CmdSetDepthState = ::CmdSetDepthState;
+        table.CmdSetStencilState = ::CmdSetStencilState;
+        table.CmdSetBlendState = ::CmdSetBlendState;
         table.CmdBeginRendering = ::CmdBeginRendering;
         table.CmdClearAttachments = ::CmdClearAttachments;
         table.CmdDraw = ::CmdDraw;
         table.CmdDrawIndexed = ::CmdDrawIndexed;
+        table.CmdDrawMulti = ::CmdDrawMulti;
+        table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
         table.CmdDrawIndirect = ::CmdDrawIndirect;
         table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
         table.CmdEndRendering = ::CmdEndRendering;
         table.CmdDispatch = ::CmdDispatch;
         table.CmdDispatchIndirect = ::CmdDispatchIndirect;
         table.CmdCopyBuffer = ::CmdCopyBuffer;
+        table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
         table.CmdCopyTexture = ::CmdCopyTexture;
         table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
         table.CmdZeroBuffer = ::CmdZeroBuffer;
         table.CmdResolveTexture = ::CmdResolveTexture;
         table.CmdClearStorage = ::CmdClearStorage;
+        table.CmdClearStorages = ::CmdClearStorages;
         table.CmdResetQueries = ::CmdResetQueries;
         table.CmdBeginQuery = ::CmdBeginQuery;
         table.CmdEndQuery = ::CmdEndQuery;
@@ -905,6 +1057,101 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  BindlessHeap  ]
+
+static Result NRI_CALL CreateBindlessHeap(Device& device, const BindlessHeapDesc& bindlessHeapDesc, BindlessHeap*& bindlessHeap) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    BindlessHeapImpl* impl = Allocate<BindlessHeapImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(bindlessHeapDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessHeap = nullptr;
+    } else
+        bindlessHeap = (BindlessHeap*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessHeap(BindlessHeap* bindlessHeap) {
+    Destroy((BindlessHeapImpl*)bindlessHeap);
+}
+
+static const DescriptorSetDesc& NRI_CALL GetBindlessHeapDescriptorSetDesc(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSetDesc();
+}
+
+static DescriptorSet* NRI_CALL GetBindlessHeapDescriptorSet(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSet();
+}
+
+static uint32_t NRI_CALL AllocateBindlessHeapSlot(BindlessHeap& bindlessHeap, const Descriptor& descriptor) {
+    return ((BindlessHeapImpl&)bindlessHeap).AllocateSlot(descriptor);
+}
+
+static void NRI_CALL FreeBindlessHeapSlot(BindlessHeap& bindlessHeap, uint32_t slot, uint64_t fenceValue) {
+    ((BindlessHeapImpl&)bindlessHeap).FreeSlot(slot, fenceValue);
+}
+
+Result DeviceD3D11::FillFunctionTable(BindlessHeapInterface& table) const {
+    table.CreateBindlessHeap = ::CreateBindlessHeap;
+    table.DestroyBindlessHeap = ::DestroyBindlessHeap;
+    table.GetBindlessHeapDescriptorSetDesc = ::GetBindlessHeapDescriptorSetDesc;
+    table.GetBindlessHeapDescriptorSet = ::GetBindlessHeapDescriptorSet;
+    table.AllocateBindlessHeapSlot = ::AllocateBindlessHeapSlot;
+    table.FreeBindlessHeapSlot = ::FreeBindlessHeapSlot;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DescriptorAllocator  ]
+
+static Result NRI_CALL CreateDescriptorAllocator(Device& device, const DescriptorAllocatorDesc& descriptorAllocatorDesc, DescriptorAllocator*& descriptorAllocator) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    DescriptorAllocatorImpl* impl = Allocate<DescriptorAllocatorImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(descriptorAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        descriptorAllocator = nullptr;
+    } else
+        descriptorAllocator = (DescriptorAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDescriptorAllocator(DescriptorAllocator* descriptorAllocator) {
+    Destroy((DescriptorAllocatorImpl*)descriptorAllocator);
+}
+
+static void NRI_CALL BeginDescriptorAllocatorFrame(DescriptorAllocator& descriptorAllocator, uint64_t fenceValue) {
+    ((DescriptorAllocatorImpl&)descriptorAllocator).BeginFrame(fenceValue);
+}
+
+static DescriptorSet* NRI_CALL AllocateDescriptorSet(DescriptorAllocator& descriptorAllocator, const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).AllocateDescriptorSet(pipelineLayout, setIndex, descriptors);
+}
+
+static DescriptorPool* NRI_CALL GetDescriptorAllocatorPool(const DescriptorAllocator& descriptorAllocator) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).GetCurrentPool();
+}
+
+Result DeviceD3D11::FillFunctionTable(DescriptorAllocatorInterface& table) const {
+    table.CreateDescriptorAllocator = ::CreateDescriptorAllocator;
+    table.DestroyDescriptorAllocator = ::DestroyDescriptorAllocator;
+    table.BeginDescriptorAllocatorFrame = ::BeginDescriptorAllocatorFrame;
+    table.AllocateDescriptorSet = ::AllocateDescriptorSet;
+    table.GetDescriptorAllocatorPool = ::GetDescriptorAllocatorPool;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -148,20 +148,29 @@ struct CommandBufferBase : public DebugNameBase {
     virtual ~CommandBufferBase() {
     }
 
+    inline const CommandBufferStats& GetStats() const {
+        return m_Stats;
+    }
+
     virtual Result Create(ID3D11DeviceContext* precreatedContext) = 0;
     virtual void Submit() = 0;
     virtual ID3D11DeviceContextBest* GetNativeObject() const = 0;
     virtual const AllocationCallbacks& GetAllocationCallbacks() const = 0;
-};
 
-static inline uint64_t ComputeHash(const void* key, uint32_t len) {
-    const uint8_t* p = (uint8_t*)key;
-    uint64_t result = 14695981039346656037ull;
-    while (len--)
-        result = (result ^ (*p++)) * 1099511628211ull;
+protected:
+    inline void BeginStats() {
+        m_Stats = {};
+        m_RecordingStart = std::chrono::steady_clock::now();
+    }
 
-    return result;
-}
+    inline void EndStats() {
+        auto recordingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_RecordingStart);
+        m_Stats.recordingTime = (uint64_t)recordingTime.count();
+    }
+
+    CommandBufferStats m_Stats = {};
+    std::chrono::steady_clock::time_point m_RecordingStart = {};
+};
 
 struct SamplePositionsState {
     std::array<SampleLocation, 32> positions;
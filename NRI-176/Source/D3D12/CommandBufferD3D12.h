@@ -39,6 +39,10 @@ struct CommandBufferD3D12 final : public DebugNameBase {
         return m_Version;
     }
 
+    inline const CommandBufferStats& GetStats() const {
+        return m_Stats;
+    }
+
     inline void ResetAttachments() {
         m_RenderTargetNum = 0;
         for (size_t i = 0; i < m_RenderTargets.size(); i++)
@@ -81,6 +85,7 @@ struct CommandBufferD3D12 final : public DebugNameBase {
     void SetPipeline(const Pipeline& pipeline);
     void SetDescriptorPool(const DescriptorPool& descriptorPool);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
+    void SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc);
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
@@ -125,6 +130,8 @@ private:
     const PipelineLayoutD3D12* m_PipelineLayout = nullptr;
     uint32_t m_RenderTargetNum = 0;
     BindPoint m_PipelineBindPoint = BindPoint::INHERIT;
+    CommandBufferStats m_Stats = {};
+    std::chrono::steady_clock::time_point m_RecordingStart = {};
     uint8_t m_Version = 0;
 };
 
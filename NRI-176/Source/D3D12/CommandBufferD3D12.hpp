@@ -293,6 +293,9 @@ NRI_INLINE Result CommandBufferD3D12::Begin(const DescriptorPool* descriptorPool
 
     ResetAttachments();
 
+    m_Stats = {};
+    m_RecordingStart = std::chrono::steady_clock::now();
+
     return Result::SUCCESS;
 }
 
@@ -300,6 +303,9 @@ NRI_INLINE Result CommandBufferD3D12::End() {
     if (FAILED(m_GraphicsCommandList->Close()))
         return Result::FAILURE;
 
+    auto recordingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_RecordingStart);
+    m_Stats.recordingTime = (uint64_t)recordingTime.count();
+
     return Result::SUCCESS;
 }
 
@@ -375,6 +381,8 @@ NRI_INLINE void CommandBufferD3D12::SetDepthBias(const DepthBiasDesc& depthBiasD
 }
 
 NRI_INLINE void CommandBufferD3D12::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
+    m_Stats.clearNum += clearDescNum;
+
     if (!clearDescNum)
         return;
 
@@ -397,6 +405,8 @@ NRI_INLINE void CommandBufferD3D12::ClearAttachments(const ClearDesc* clearDescs
 }
 
 NRI_INLINE void CommandBufferD3D12::ClearStorage(const ClearStorageDesc& clearDesc) {
+    m_Stats.clearNum++;
+
     DescriptorSetD3D12* descriptorSet = m_DescriptorSets[clearDesc.setIndex];
     DescriptorD3D12* storage = (DescriptorD3D12*)clearDesc.storage;
 
@@ -493,23 +503,43 @@ NRI_INLINE void CommandBufferD3D12::SetDescriptorPool(const DescriptorPool& desc
 }
 
 NRI_INLINE void CommandBufferD3D12::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    m_Stats.descriptorBindNum++;
+
     BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetDesc.bindPoint;
     m_PipelineLayout->SetDescriptorSet(m_GraphicsCommandList, bindPoint, setDescriptorSetDesc);
 
     m_DescriptorSets[setDescriptorSetDesc.setIndex] = (DescriptorSetD3D12*)setDescriptorSetDesc.descriptorSet;
 }
 
+NRI_INLINE void CommandBufferD3D12::SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    // Descriptor tables are set one by one, dynamic offsets are not supported
+    for (uint32_t i = 0; i < setDescriptorSetsDesc.descriptorSetNum; i++) {
+        SetDescriptorSetDesc setDescriptorSetDesc = {};
+        setDescriptorSetDesc.setIndex = setDescriptorSetsDesc.baseSetIndex + i;
+        setDescriptorSetDesc.descriptorSet = setDescriptorSetsDesc.descriptorSets[i];
+        setDescriptorSetDesc.bindPoint = setDescriptorSetsDesc.bindPoint;
+
+        SetDescriptorSet(setDescriptorSetDesc);
+    }
+}
+
 NRI_INLINE void CommandBufferD3D12::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
+    m_Stats.rootConstantSize += setRootConstantsDesc.size;
+
     BindPoint bindPoint = setRootConstantsDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setRootConstantsDesc.bindPoint;
     m_PipelineLayout->SetRootConstants(m_GraphicsCommandList, bindPoint, setRootConstantsDesc);
 }
 
 NRI_INLINE void CommandBufferD3D12::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    m_Stats.descriptorBindNum++;
+
     BindPoint bindPoint = setRootDescriptorDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setRootDescriptorDesc.bindPoint;
     m_PipelineLayout->SetRootDescriptor(m_GraphicsCommandList, bindPoint, setRootDescriptorDesc);
 }
 
 NRI_INLINE void CommandBufferD3D12::Draw(const DrawDesc& drawDesc) {
+    m_Stats.drawNum++;
+
     if (m_PipelineLayout && m_PipelineLayout->IsDrawParametersEmulationEnabled()) {
         struct BaseVertexInstance {
             uint32_t baseVertex;
@@ -523,6 +553,8 @@ NRI_INLINE void CommandBufferD3D12::Draw(const DrawDesc& drawDesc) {
 }
 
 NRI_INLINE void CommandBufferD3D12::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    m_Stats.drawNum++;
+
     if (m_PipelineLayout && m_PipelineLayout->IsDrawParametersEmulationEnabled()) {
         struct BaseVertexInstance {
             int32_t baseVertex;
@@ -536,6 +568,8 @@ NRI_INLINE void CommandBufferD3D12::DrawIndexed(const DrawIndexedDesc& drawIndex
 }
 
 NRI_INLINE void CommandBufferD3D12::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     ID3D12Resource* pCountBuffer = nullptr;
     if (countBuffer)
         pCountBuffer = *(BufferD3D12*)countBuffer;
@@ -544,6 +578,8 @@ NRI_INLINE void CommandBufferD3D12::DrawIndirect(const Buffer& buffer, uint64_t
 }
 
 NRI_INLINE void CommandBufferD3D12::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     ID3D12Resource* pCountBuffer = nullptr;
     if (countBuffer)
         pCountBuffer = *(BufferD3D12*)countBuffer;
@@ -552,6 +588,8 @@ NRI_INLINE void CommandBufferD3D12::DrawIndexedIndirect(const Buffer& buffer, ui
 }
 
 NRI_INLINE void CommandBufferD3D12::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    m_Stats.copyNum++;
+
     if (size == WHOLE_SIZE)
         size = ((BufferD3D12&)srcBuffer).GetDesc().size;
 
@@ -559,6 +597,8 @@ NRI_INLINE void CommandBufferD3D12::CopyBuffer(Buffer& dstBuffer, uint64_t dstOf
 }
 
 NRI_INLINE void CommandBufferD3D12::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     const TextureD3D12& dst = (TextureD3D12&)dstTexture;
     const TextureD3D12& src = (TextureD3D12&)srcTexture;
 
@@ -596,6 +636,8 @@ NRI_INLINE void CommandBufferD3D12::CopyTexture(Texture& dstTexture, const Textu
 }
 
 NRI_INLINE void CommandBufferD3D12::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    m_Stats.copyNum++;
+
     const BufferD3D12& dst = (BufferD3D12&)buffer;
     ID3D12Resource* zeroBuffer = m_Device.GetZeroBuffer();
     D3D12_RESOURCE_DESC zeroBufferDesc = zeroBuffer->GetDesc();
@@ -615,6 +657,8 @@ NRI_INLINE void CommandBufferD3D12::ZeroBuffer(Buffer& buffer, uint64_t offset,
 }
 
 NRI_INLINE void CommandBufferD3D12::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
     const TextureD3D12& dst = (TextureD3D12&)dstTexture;
     const TextureD3D12& src = (TextureD3D12&)srcTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -650,6 +694,8 @@ NRI_INLINE void CommandBufferD3D12::ResolveTexture(Texture& dstTexture, const Te
 }
 
 NRI_INLINE void CommandBufferD3D12::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    m_Stats.copyNum++;
+
     const TextureD3D12& dst = (TextureD3D12&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
 
@@ -676,6 +722,8 @@ NRI_INLINE void CommandBufferD3D12::UploadBufferToTexture(Texture& dstTexture, c
 }
 
 NRI_INLINE void CommandBufferD3D12::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    m_Stats.copyNum++;
+
     const TextureD3D12& src = (TextureD3D12&)srcTexture;
     const TextureDesc& srcDesc = src.GetDesc();
 
@@ -709,16 +757,22 @@ NRI_INLINE void CommandBufferD3D12::ReadbackTextureToBuffer(Buffer& dstBuffer, c
 }
 
 NRI_INLINE void CommandBufferD3D12::Dispatch(const DispatchDesc& dispatchDesc) {
+    m_Stats.dispatchNum++;
+
     m_GraphicsCommandList->Dispatch(dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
 
 NRI_INLINE void CommandBufferD3D12::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
     static_assert(sizeof(DispatchDesc) == sizeof(D3D12_DISPATCH_ARGUMENTS));
 
     m_GraphicsCommandList->ExecuteIndirect(m_Device.GetDispatchCommandSignature(), 1, (BufferD3D12&)buffer, offset, nullptr, 0);
 }
 
 NRI_INLINE void CommandBufferD3D12::Barrier(const BarrierDesc& barrierDesc) {
+    m_Stats.requestedBarrierNum += barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum;
+
 #if NRI_ENABLE_AGILITY_SDK_SUPPORT
     if (m_Device.GetDesc().features.enhancedBarriers) {
         // Count
@@ -1171,6 +1225,8 @@ NRI_INLINE void CommandBufferD3D12::WriteMicromapsSizes(const Micromap* const* m
 }
 
 NRI_INLINE void CommandBufferD3D12::DispatchRays(const DispatchRaysDesc& dispatchRaysDesc) {
+    m_Stats.dispatchNum++;
+
     D3D12_DISPATCH_RAYS_DESC desc = {};
 
     desc.RayGenerationShaderRecord.StartAddress = (*(BufferD3D12*)dispatchRaysDesc.raygenShader.buffer).GetGPUVA() + dispatchRaysDesc.raygenShader.offset;
@@ -1202,16 +1258,22 @@ NRI_INLINE void CommandBufferD3D12::DispatchRays(const DispatchRaysDesc& dispatc
 }
 
 NRI_INLINE void CommandBufferD3D12::DispatchRaysIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
     static_assert(sizeof(DispatchRaysIndirectDesc) == sizeof(D3D12_DISPATCH_RAYS_DESC));
 
     m_GraphicsCommandList->ExecuteIndirect(m_Device.GetDispatchRaysCommandSignature(), 1, (BufferD3D12&)buffer, offset, nullptr, 0);
 }
 
 NRI_INLINE void CommandBufferD3D12::DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    m_Stats.drawNum++;
+
     m_GraphicsCommandList->DispatchMesh(drawMeshTasksDesc.x, drawMeshTasksDesc.y, drawMeshTasksDesc.z);
 }
 
 NRI_INLINE void CommandBufferD3D12::DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
     static_assert(sizeof(DrawMeshTasksDesc) == sizeof(D3D12_DISPATCH_MESH_ARGUMENTS));
 
     ID3D12Resource* pCountBuffer = nullptr;
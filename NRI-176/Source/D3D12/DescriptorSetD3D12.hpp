@@ -43,6 +43,20 @@ NRI_INLINE void DescriptorSetD3D12::UpdateDescriptorRanges(const UpdateDescripto
     }
 }
 
+NRI_INLINE void DescriptorSetD3D12::UpdateDescriptorSet(const Descriptor* const* descriptors) {
+    uint32_t descriptorIndex = 0;
+    for (const DescriptorRangeMapping& rangeMapping : m_DescriptorSetMapping->descriptorRangeMappings) {
+        uint32_t dstOffset = m_HeapOffsets[rangeMapping.descriptorHeapType] + rangeMapping.heapOffset;
+
+        for (uint32_t j = 0; j < rangeMapping.descriptorNum; j++) {
+            DescriptorHandleCPU dstHandle = m_DescriptorPoolD3D12->GetDescriptorHandleCPU(rangeMapping.descriptorHeapType, dstOffset + j);
+            DescriptorHandleCPU srcHandle = ((DescriptorD3D12*)descriptors[descriptorIndex++])->GetDescriptorHandleCPU();
+
+            GetDevice()->CopyDescriptorsSimple(1, {dstHandle}, {srcHandle}, (D3D12_DESCRIPTOR_HEAP_TYPE)rangeMapping.descriptorHeapType);
+        }
+    }
+}
+
 NRI_INLINE void DescriptorSetD3D12::Copy(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
         const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
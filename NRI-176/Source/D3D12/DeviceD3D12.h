@@ -131,6 +131,8 @@ struct DeviceD3D12 final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(BindlessHeapInterface& table) const override;
+    Result FillFunctionTable(DescriptorAllocatorInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
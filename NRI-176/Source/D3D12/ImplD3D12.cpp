@@ -21,6 +21,8 @@
 #include "SwapChainD3D12.h"
 #include "TextureD3D12.h"
 
+#include "BindlessHeapInterface.h"
+#include "DescriptorAllocatorInterface.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
 #include "StreamerInterface.h"
@@ -100,6 +102,12 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, C
     return ((CommandAllocatorD3D12&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator&, CommandBuffer*& commandBuffer) {
+    commandBuffer = nullptr;
+
+    return Result::UNSUPPORTED;
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
     return ((DeviceD3D12&)device).CreateImplementation<FenceD3D12>(fence, initialValue);
 }
@@ -308,6 +316,22 @@ static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint6
     return result;
 }
 
+static Result NRI_CALL OptimizePipeline(Pipeline&) {
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL GetPipelineStats(const Pipeline&, PipelineStats& pipelineStats) {
+    pipelineStats = {};
+}
+
+static void NRI_CALL GetPipelineCreationStats(const Device&, PipelineCreationStats& pipelineCreationStats) {
+    pipelineCreationStats = {};
+}
+
+static void NRI_CALL GetDescriptorCacheStats(const Device&, DescriptorCacheStats& descriptorCacheStats) {
+    descriptorCacheStats = {};
+}
+
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     return ((DescriptorPoolD3D12&)descriptorPool).AllocateDescriptorSets(pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
 }
@@ -316,6 +340,10 @@ static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* upd
     DescriptorSetD3D12::UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
+static void NRI_CALL UpdateDescriptorSet(DescriptorSet& descriptorSet, const Descriptor* const* descriptors) {
+    ((DescriptorSetD3D12&)descriptorSet).UpdateDescriptorSet(descriptors);
+}
+
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     DescriptorSetD3D12::Copy(copyDescriptorRangeDescs, copyDescriptorRangeDescNum);
 }
@@ -324,10 +352,18 @@ static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
     ((DescriptorPoolD3D12&)descriptorPool).Reset();
 }
 
+static void NRI_CALL GetDescriptorPoolStats(const DescriptorPool&, DescriptorPoolStats& descriptorPoolStats) {
+    descriptorPoolStats = {};
+}
+
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
     return ((CommandBufferD3D12&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer&, const AttachmentsDesc&, const DescriptorPool*) {
+    return Result::UNSUPPORTED;
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferD3D12&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -340,6 +376,10 @@ static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const Set
     ((CommandBufferD3D12&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
+static void NRI_CALL CmdSetDescriptorSets(CommandBuffer& commandBuffer, const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    ((CommandBufferD3D12&)commandBuffer).SetDescriptorSets(setDescriptorSetsDesc);
+}
+
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
     ((CommandBufferD3D12&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
@@ -396,6 +436,21 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferD3D12&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer&, Topology) {
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer&, CullMode, bool) {
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer&, const DepthAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer&, const StencilAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetBlendState(CommandBuffer&, uint32_t, const ColorAttachmentDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferD3D12&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -412,6 +467,24 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferD3D12&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawDescs;
+    if (!stride)
+        stride = sizeof(DrawDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferD3D12&)commandBuffer).Draw(*(DrawDesc*)(ptr + i * stride));
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* ptr = (uint8_t*)drawIndexedDescs;
+    if (!stride)
+        stride = sizeof(DrawIndexedDesc);
+
+    for (uint32_t i = 0; i < drawNum; i++)
+        ((CommandBufferD3D12&)commandBuffer).DrawIndexed(*(DrawIndexedDesc*)(ptr + i * stride));
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferD3D12&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -420,6 +493,9 @@ static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const
     ((CommandBufferD3D12&)commandBuffer).DrawIndexedIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
+static void NRI_CALL CmdExecuteCommandBuffers(CommandBuffer&, const CommandBuffer* const*, uint32_t) {
+}
+
 static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
     ((CommandBufferD3D12&)commandBuffer).ResetAttachments();
 }
@@ -436,6 +512,11 @@ static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuff
     ((CommandBufferD3D12&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferD3D12&)commandBuffer).CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferD3D12&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -460,6 +541,11 @@ static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearSt
     ((CommandBufferD3D12&)commandBuffer).ClearStorage(clearDesc);
 }
 
+static void NRI_CALL CmdClearStorages(CommandBuffer& commandBuffer, const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    for (uint32_t i = 0; i < clearDescNum; i++)
+        ((CommandBufferD3D12&)commandBuffer).ClearStorage(clearDescs[i]);
+}
+
 static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
     ((CommandBufferD3D12&)commandBuffer).ResetQueries(queryPool, offset, num);
 }
@@ -501,6 +587,10 @@ static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
     return ((CommandBufferD3D12&)commandBuffer).End();
 }
 
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = ((CommandBufferD3D12&)commandBuffer).GetStats();
+}
+
 static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
     MaybeUnused(queue, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
@@ -618,6 +708,7 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTexture1DView = ::CreateTexture1DView;
@@ -653,13 +744,21 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CreateCommittedTexture = ::CreateCommittedTexture;
     table.CreatePlacedBuffer = ::CreatePlacedBuffer;
     table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.OptimizePipeline = ::OptimizePipeline;
+    table.GetPipelineStats = ::GetPipelineStats;
+    table.GetPipelineCreationStats = ::GetPipelineCreationStats;
+    table.GetDescriptorCacheStats = ::GetDescriptorCacheStats;
     table.AllocateDescriptorSets = ::AllocateDescriptorSets;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.UpdateDescriptorSet = ::UpdateDescriptorSet;
     table.CopyDescriptorRanges = ::CopyDescriptorRanges;
     table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorPoolStats = ::GetDescriptorPoolStats;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetDescriptorSets = ::CmdSetDescriptorSets;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
     table.CmdSetPipeline = ::CmdSetPipeline;
     table.CmdSetRootConstants = ::CmdSetRootConstants;
@@ -675,22 +774,32 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetBlendState = ::CmdSetBlendState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdExecuteCommandBuffers = ::CmdExecuteCommandBuffers;
     table.CmdEndRendering = ::CmdEndRendering;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
+    table.CmdClearStorages = ::CmdClearStorages;
     table.CmdResetQueries = ::CmdResetQueries;
     table.CmdBeginQuery = ::CmdBeginQuery;
     table.CmdEndQuery = ::CmdEndQuery;
@@ -699,6 +808,7 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdEndAnnotation = ::CmdEndAnnotation;
     table.CmdAnnotation = ::CmdAnnotation;
     table.EndCommandBuffer = ::EndCommandBuffer;
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
     table.QueueBeginAnnotation = ::QueueBeginAnnotation;
     table.QueueEndAnnotation = ::QueueEndAnnotation;
     table.QueueAnnotation = ::QueueAnnotation;
@@ -723,6 +833,101 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  BindlessHeap  ]
+
+static Result NRI_CALL CreateBindlessHeap(Device& device, const BindlessHeapDesc& bindlessHeapDesc, BindlessHeap*& bindlessHeap) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    BindlessHeapImpl* impl = Allocate<BindlessHeapImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
+    Result result = impl->Create(bindlessHeapDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessHeap = nullptr;
+    } else
+        bindlessHeap = (BindlessHeap*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessHeap(BindlessHeap* bindlessHeap) {
+    Destroy((BindlessHeapImpl*)bindlessHeap);
+}
+
+static const DescriptorSetDesc& NRI_CALL GetBindlessHeapDescriptorSetDesc(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSetDesc();
+}
+
+static DescriptorSet* NRI_CALL GetBindlessHeapDescriptorSet(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSet();
+}
+
+static uint32_t NRI_CALL AllocateBindlessHeapSlot(BindlessHeap& bindlessHeap, const Descriptor& descriptor) {
+    return ((BindlessHeapImpl&)bindlessHeap).AllocateSlot(descriptor);
+}
+
+static void NRI_CALL FreeBindlessHeapSlot(BindlessHeap& bindlessHeap, uint32_t slot, uint64_t fenceValue) {
+    ((BindlessHeapImpl&)bindlessHeap).FreeSlot(slot, fenceValue);
+}
+
+Result DeviceD3D12::FillFunctionTable(BindlessHeapInterface& table) const {
+    table.CreateBindlessHeap = ::CreateBindlessHeap;
+    table.DestroyBindlessHeap = ::DestroyBindlessHeap;
+    table.GetBindlessHeapDescriptorSetDesc = ::GetBindlessHeapDescriptorSetDesc;
+    table.GetBindlessHeapDescriptorSet = ::GetBindlessHeapDescriptorSet;
+    table.AllocateBindlessHeapSlot = ::AllocateBindlessHeapSlot;
+    table.FreeBindlessHeapSlot = ::FreeBindlessHeapSlot;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DescriptorAllocator  ]
+
+static Result NRI_CALL CreateDescriptorAllocator(Device& device, const DescriptorAllocatorDesc& descriptorAllocatorDesc, DescriptorAllocator*& descriptorAllocator) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    DescriptorAllocatorImpl* impl = Allocate<DescriptorAllocatorImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
+    Result result = impl->Create(descriptorAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        descriptorAllocator = nullptr;
+    } else
+        descriptorAllocator = (DescriptorAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDescriptorAllocator(DescriptorAllocator* descriptorAllocator) {
+    Destroy((DescriptorAllocatorImpl*)descriptorAllocator);
+}
+
+static void NRI_CALL BeginDescriptorAllocatorFrame(DescriptorAllocator& descriptorAllocator, uint64_t fenceValue) {
+    ((DescriptorAllocatorImpl&)descriptorAllocator).BeginFrame(fenceValue);
+}
+
+static DescriptorSet* NRI_CALL AllocateDescriptorSet(DescriptorAllocator& descriptorAllocator, const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).AllocateDescriptorSet(pipelineLayout, setIndex, descriptors);
+}
+
+static DescriptorPool* NRI_CALL GetDescriptorAllocatorPool(const DescriptorAllocator& descriptorAllocator) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).GetCurrentPool();
+}
+
+Result DeviceD3D12::FillFunctionTable(DescriptorAllocatorInterface& table) const {
+    table.CreateDescriptorAllocator = ::CreateDescriptorAllocator;
+    table.DestroyDescriptorAllocator = ::DestroyDescriptorAllocator;
+    table.BeginDescriptorAllocatorFrame = ::BeginDescriptorAllocatorFrame;
+    table.AllocateDescriptorSet = ::AllocateDescriptorSet;
+    table.GetDescriptorAllocatorPool = ::GetDescriptorAllocatorPool;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -175,7 +175,10 @@ struct DeviceNONE final : public DeviceBase {
     }
 
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(BindlessHeapInterface& table) const override;
+    Result FillFunctionTable(DescriptorAllocatorInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
@@ -255,6 +258,12 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator&, CommandBuffer*& co
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator&, CommandBuffer*& commandBuffer) {
+    commandBuffer = DummyObject<CommandBuffer>();
+
+    return Result::SUCCESS;
+}
+
 static Result NRI_CALL CreateFence(Device&, uint64_t, Fence*& fence) {
     fence = DummyObject<Fence>();
 
@@ -420,6 +429,22 @@ static Result NRI_CALL CreatePlacedTexture(Device&, Memory*, uint64_t, const Tex
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL OptimizePipeline(Pipeline&) {
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL GetPipelineStats(const Pipeline&, PipelineStats& pipelineStats) {
+    pipelineStats = {};
+}
+
+static void NRI_CALL GetPipelineCreationStats(const Device&, PipelineCreationStats& pipelineCreationStats) {
+    pipelineCreationStats = {};
+}
+
+static void NRI_CALL GetDescriptorCacheStats(const Device&, DescriptorCacheStats& descriptorCacheStats) {
+    descriptorCacheStats = {};
+}
+
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool&, const PipelineLayout&, uint32_t, DescriptorSet**, uint32_t, uint32_t) {
     return Result::SUCCESS;
 }
@@ -427,16 +452,27 @@ static Result NRI_CALL AllocateDescriptorSets(DescriptorPool&, const PipelineLay
 static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc*, uint32_t) {
 }
 
+static void NRI_CALL UpdateDescriptorSet(DescriptorSet&, const Descriptor* const*) {
+}
+
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc*, uint32_t) {
 }
 
 static void NRI_CALL ResetDescriptorPool(DescriptorPool&) {
 }
 
+static void NRI_CALL GetDescriptorPoolStats(const DescriptorPool&, DescriptorPoolStats& descriptorPoolStats) {
+    descriptorPoolStats = {};
+}
+
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer&, const DescriptorPool*) {
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer&, const AttachmentsDesc&, const DescriptorPool*) {
+    return Result::SUCCESS;
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer&, const DescriptorPool&) {
 }
 
@@ -446,6 +482,9 @@ static void NRI_CALL CmdSetPipelineLayout(CommandBuffer&, BindPoint, const Pipel
 static void NRI_CALL CmdSetDescriptorSet(CommandBuffer&, const SetDescriptorSetDesc&) {
 }
 
+static void NRI_CALL CmdSetDescriptorSets(CommandBuffer&, const SetDescriptorSetsDesc&) {
+}
+
 static void NRI_CALL CmdSetRootConstants(CommandBuffer&, const SetRootConstantsDesc&) {
 }
 
@@ -488,6 +527,21 @@ static void NRI_CALL CmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&) {
 static void NRI_CALL CmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer&, Topology) {
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer&, CullMode, bool) {
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer&, const DepthAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer&, const StencilAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetBlendState(CommandBuffer&, uint32_t, const ColorAttachmentDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer&, const AttachmentsDesc&) {
 }
 
@@ -500,12 +554,21 @@ static void NRI_CALL CmdDraw(CommandBuffer&, const DrawDesc&) {
 static void NRI_CALL CmdDrawIndexed(CommandBuffer&, const DrawIndexedDesc&) {
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer&, const DrawDesc*, uint32_t, uint32_t) {
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer&, const DrawIndexedDesc*, uint32_t, uint32_t) {
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
 }
 
 static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
 }
 
+static void NRI_CALL CmdExecuteCommandBuffers(CommandBuffer&, const CommandBuffer* const*, uint32_t) {
+}
+
 static void NRI_CALL CmdEndRendering(CommandBuffer&) {
 }
 
@@ -518,6 +581,9 @@ static void NRI_CALL CmdDispatchIndirect(CommandBuffer&, const Buffer&, uint64_t
 static void NRI_CALL CmdCopyBuffer(CommandBuffer&, Buffer&, uint64_t, const Buffer&, uint64_t, uint64_t) {
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer&, Buffer&, const Buffer&, const BufferCopyRegionDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdCopyTexture(CommandBuffer&, Texture&, const TextureRegionDesc*, const Texture&, const TextureRegionDesc*) {
 }
 
@@ -536,6 +602,9 @@ static void NRI_CALL CmdResolveTexture(CommandBuffer&, Texture&, const TextureRe
 static void NRI_CALL CmdClearStorage(CommandBuffer&, const ClearStorageDesc&) {
 }
 
+static void NRI_CALL CmdClearStorages(CommandBuffer&, const ClearStorageDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdResetQueries(CommandBuffer&, QueryPool&, uint32_t, uint32_t) {
 }
 
@@ -561,6 +630,10 @@ static Result NRI_CALL EndCommandBuffer(CommandBuffer&) {
     return Result::SUCCESS;
 }
 
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer&, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = {};
+}
+
 static void NRI_CALL QueueBeginAnnotation(Queue&, const char*, uint32_t) {
 }
 
@@ -635,6 +708,7 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTexture1DView = ::CreateTexture1DView;
@@ -670,13 +744,21 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CreateCommittedTexture = ::CreateCommittedTexture;
     table.CreatePlacedBuffer = ::CreatePlacedBuffer;
     table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.OptimizePipeline = ::OptimizePipeline;
+    table.GetPipelineStats = ::GetPipelineStats;
+    table.GetPipelineCreationStats = ::GetPipelineCreationStats;
+    table.GetDescriptorCacheStats = ::GetDescriptorCacheStats;
     table.AllocateDescriptorSets = ::AllocateDescriptorSets;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.UpdateDescriptorSet = ::UpdateDescriptorSet;
     table.CopyDescriptorRanges = ::CopyDescriptorRanges;
     table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorPoolStats = ::GetDescriptorPoolStats;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetDescriptorSets = ::CmdSetDescriptorSets;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
     table.CmdSetPipeline = ::CmdSetPipeline;
     table.CmdSetRootConstants = ::CmdSetRootConstants;
@@ -692,22 +774,32 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetBlendState = ::CmdSetBlendState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdExecuteCommandBuffers = ::CmdExecuteCommandBuffers;
     table.CmdEndRendering = ::CmdEndRendering;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
+    table.CmdClearStorages = ::CmdClearStorages;
     table.CmdResetQueries = ::CmdResetQueries;
     table.CmdBeginQuery = ::CmdBeginQuery;
     table.CmdEndQuery = ::CmdEndQuery;
@@ -716,6 +808,7 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdEndAnnotation = ::CmdEndAnnotation;
     table.CmdAnnotation = ::CmdAnnotation;
     table.EndCommandBuffer = ::EndCommandBuffer;
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
     table.QueueBeginAnnotation = ::QueueBeginAnnotation;
     table.QueueEndAnnotation = ::QueueEndAnnotation;
     table.QueueAnnotation = ::QueueAnnotation;
@@ -740,6 +833,83 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  BindlessHeap  ]
+
+static Result NRI_CALL CreateBindlessHeap(Device&, const BindlessHeapDesc&, BindlessHeap*& bindlessHeap) {
+    bindlessHeap = DummyObject<BindlessHeap>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyBindlessHeap(BindlessHeap*) {
+}
+
+static const DescriptorSetDesc& NRI_CALL GetBindlessHeapDescriptorSetDesc(const BindlessHeap&) {
+    static const DescriptorSetDesc descriptorSetDesc = {};
+
+    return descriptorSetDesc;
+}
+
+static DescriptorSet* NRI_CALL GetBindlessHeapDescriptorSet(const BindlessHeap&) {
+    return DummyObject<DescriptorSet>();
+}
+
+static uint32_t NRI_CALL AllocateBindlessHeapSlot(BindlessHeap&, const Descriptor&) {
+    return 0;
+}
+
+static void NRI_CALL FreeBindlessHeapSlot(BindlessHeap&, uint32_t, uint64_t) {
+}
+
+Result DeviceNONE::FillFunctionTable(BindlessHeapInterface& table) const {
+    table.CreateBindlessHeap = ::CreateBindlessHeap;
+    table.DestroyBindlessHeap = ::DestroyBindlessHeap;
+    table.GetBindlessHeapDescriptorSetDesc = ::GetBindlessHeapDescriptorSetDesc;
+    table.GetBindlessHeapDescriptorSet = ::GetBindlessHeapDescriptorSet;
+    table.AllocateBindlessHeapSlot = ::AllocateBindlessHeapSlot;
+    table.FreeBindlessHeapSlot = ::FreeBindlessHeapSlot;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DescriptorAllocator  ]
+
+static Result NRI_CALL CreateDescriptorAllocator(Device&, const DescriptorAllocatorDesc&, DescriptorAllocator*& descriptorAllocator) {
+    descriptorAllocator = DummyObject<DescriptorAllocator>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyDescriptorAllocator(DescriptorAllocator*) {
+}
+
+static void NRI_CALL BeginDescriptorAllocatorFrame(DescriptorAllocator&, uint64_t) {
+}
+
+static DescriptorSet* NRI_CALL AllocateDescriptorSet(DescriptorAllocator&, const PipelineLayout&, uint32_t, const Descriptor* const*) {
+    return DummyObject<DescriptorSet>();
+}
+
+static DescriptorPool* NRI_CALL GetDescriptorAllocatorPool(const DescriptorAllocator&) {
+    return DummyObject<DescriptorPool>();
+}
+
+Result DeviceNONE::FillFunctionTable(DescriptorAllocatorInterface& table) const {
+    table.CreateDescriptorAllocator = ::CreateDescriptorAllocator;
+    table.DestroyDescriptorAllocator = ::DestroyDescriptorAllocator;
+    table.BeginDescriptorAllocatorFrame = ::BeginDescriptorAllocatorFrame;
+    table.AllocateDescriptorSet = ::AllocateDescriptorSet;
+    table.GetDescriptorAllocatorPool = ::GetDescriptorAllocatorPool;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -805,6 +975,41 @@ Result DeviceNONE::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device&, const IndirectCommandLayoutDesc&, IndirectCommandLayout*& indirectCommandLayout) {
+    indirectCommandLayout = DummyObject<IndirectCommandLayout>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout*) {
+}
+
+static uint64_t NRI_CALL GetIndirectBufferDeviceAddress(const Buffer&) {
+    return 0;
+}
+
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessSize(const IndirectCommandLayout&, const Pipeline&, uint32_t) {
+    return 0;
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer&, const ExecuteIndirectCommandsDesc&) {
+}
+
+Result DeviceNONE::FillFunctionTable(IndirectCommandsInterface& table) const {
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.GetIndirectBufferDeviceAddress = ::GetIndirectBufferDeviceAddress;
+    table.GetIndirectCommandsPreprocessSize = ::GetIndirectCommandsPreprocessSize;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  LowLatency  ]
 
@@ -0,0 +1,77 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct PendingSlot {
+    uint64_t fenceValue;
+    uint32_t slot;
+};
+
+// "std::atomic" is not copyable, but "Vector" needs it for "resize"
+struct FreeListLink {
+    FreeListLink() = default;
+
+    inline FreeListLink(const FreeListLink& other)
+        : next(other.next.load(std::memory_order_relaxed)) {
+    }
+
+    std::atomic_uint32_t next = BINDLESS_HEAP_INVALID_SLOT;
+};
+
+struct BindlessHeapImpl final : public DebugNameBase {
+    inline BindlessHeapImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_FreeListLinks(((DeviceBase&)device).GetStdAllocator())
+        , m_PendingSlots(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline const DescriptorSetDesc& GetDescriptorSetDesc() const {
+        return m_DescriptorSetDesc;
+    }
+
+    inline DescriptorSet* GetDescriptorSet() const {
+        return m_DescriptorSet;
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    ~BindlessHeapImpl();
+
+    Result Create(const BindlessHeapDesc& desc);
+    uint32_t AllocateSlot(const Descriptor& descriptor);
+    void FreeSlot(uint32_t slot, uint64_t fenceValue);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        m_iCore.SetDebugName(m_DescriptorSet, name);
+        m_iCore.SetDebugName(m_PipelineLayout, name);
+    }
+
+private:
+    uint32_t PopFreeSlot();
+    void PushFreeSlot(uint32_t slot);
+    bool RecycleSlots();
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    BindlessHeapDesc m_Desc = {};
+    DescriptorRangeDesc m_DescriptorRangeDesc = {};
+    DescriptorSetDesc m_DescriptorSetDesc = {};
+    Vector<FreeListLink> m_FreeListLinks;
+    Vector<PendingSlot> m_PendingSlots;       // m_Lock
+    PipelineLayout* m_PipelineLayout = nullptr;
+    DescriptorSet* m_DescriptorSet = nullptr;
+    std::atomic_uint64_t m_FreeListHead{BINDLESS_HEAP_INVALID_SLOT}; // tag (high) + slot (low), the tag protects against ABA
+    Lock m_Lock;
+};
+
+} // namespace nri
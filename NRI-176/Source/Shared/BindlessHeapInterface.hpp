@@ -0,0 +1,140 @@
+// © 2025 NVIDIA Corporation
+
+constexpr uint64_t FREE_LIST_TAG_STEP = 1ull << 32;
+
+BindlessHeapImpl::~BindlessHeapImpl() {
+    m_iCore.DestroyPipelineLayout(m_PipelineLayout);
+}
+
+Result BindlessHeapImpl::Create(const BindlessHeapDesc& desc) {
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    if (!deviceDesc.features.mutableDescriptorType || !deviceDesc.tiers.bindless)
+        return Result::UNSUPPORTED;
+
+    if (!desc.descriptorPool)
+        return Result::INVALID_ARGUMENT;
+
+    m_Desc = desc;
+
+    // The heap is a single partially bound array of mutable descriptors, which can be updated while in use
+    m_DescriptorRangeDesc.baseRegisterIndex = desc.baseRegisterIndex;
+    m_DescriptorRangeDesc.descriptorNum = desc.slotNum;
+    m_DescriptorRangeDesc.descriptorType = DescriptorType::TEXTURE;
+    m_DescriptorRangeDesc.shaderStages = desc.shaderStages;
+    m_DescriptorRangeDesc.flags = DescriptorRangeBits::ARRAY | DescriptorRangeBits::PARTIALLY_BOUND | DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET | DescriptorRangeBits::MUTABLE;
+
+    m_DescriptorSetDesc.registerSpace = desc.registerSpace;
+    m_DescriptorSetDesc.ranges = &m_DescriptorRangeDesc;
+    m_DescriptorSetDesc.rangeNum = 1;
+    m_DescriptorSetDesc.flags = DescriptorSetBits::ALLOW_UPDATE_AFTER_SET;
+
+    // Only needed for the allocation, the descriptor set is compatible with any pipeline layout declaring the same set
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.descriptorSets = &m_DescriptorSetDesc;
+    pipelineLayoutDesc.descriptorSetNum = 1;
+    pipelineLayoutDesc.shaderStages = desc.shaderStages;
+    pipelineLayoutDesc.flags = (PipelineLayoutBits)(desc.pipelineLayoutFlags & PipelineLayoutBits::IGNORE_GLOBAL_SPIRV_OFFSETS);
+
+    Result result = m_iCore.CreatePipelineLayout(m_Device, pipelineLayoutDesc, m_PipelineLayout);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // The set lives in the caller's pool, since only one pool can be bound at a time on some backends
+    result = m_iCore.AllocateDescriptorSets(*desc.descriptorPool, *m_PipelineLayout, 0, &m_DescriptorSet, 1, 0);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // Chain all slots into the free list
+    m_FreeListLinks.resize(desc.slotNum);
+    for (uint32_t i = 0; i + 1 < desc.slotNum; i++)
+        m_FreeListLinks[i].next.store(i + 1, std::memory_order_relaxed);
+
+    m_FreeListHead.store(desc.slotNum ? 0 : BINDLESS_HEAP_INVALID_SLOT, std::memory_order_release);
+
+    return Result::SUCCESS;
+}
+
+uint32_t BindlessHeapImpl::PopFreeSlot() {
+    uint64_t head = m_FreeListHead.load(std::memory_order_acquire);
+
+    for (;;) {
+        uint32_t slot = (uint32_t)head;
+        if (slot == BINDLESS_HEAP_INVALID_SLOT)
+            return BINDLESS_HEAP_INVALID_SLOT;
+
+        // A stale "next" is harmless, since the tag makes "compare_exchange" fail if the head has been popped in between
+        uint32_t next = m_FreeListLinks[slot].next.load(std::memory_order_relaxed);
+        uint64_t newHead = ((head & ~0xFFFFFFFFull) + FREE_LIST_TAG_STEP) | next;
+
+        if (m_FreeListHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            return slot;
+    }
+}
+
+void BindlessHeapImpl::PushFreeSlot(uint32_t slot) {
+    uint64_t head = m_FreeListHead.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+
+    do {
+        m_FreeListLinks[slot].next.store((uint32_t)head, std::memory_order_relaxed);
+        newHead = ((head & ~0xFFFFFFFFull) + FREE_LIST_TAG_STEP) | slot;
+    } while (!m_FreeListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool BindlessHeapImpl::RecycleSlots() {
+    ExclusiveScope lock(m_Lock);
+
+    if (m_PendingSlots.empty())
+        return false;
+
+    uint64_t completedValue = m_iCore.GetFenceValue(*m_Desc.fence);
+
+    size_t pendingNum = 0;
+    bool isRecycled = false;
+
+    for (const PendingSlot& pendingSlot : m_PendingSlots) {
+        if (pendingSlot.fenceValue <= completedValue) {
+            PushFreeSlot(pendingSlot.slot);
+            isRecycled = true;
+        } else
+            m_PendingSlots[pendingNum++] = pendingSlot;
+    }
+
+    m_PendingSlots.resize(pendingNum);
+
+    return isRecycled;
+}
+
+uint32_t BindlessHeapImpl::AllocateSlot(const Descriptor& descriptor) {
+    // Lock-free fast path, pending slots are recycled only if the free list is exhausted
+    uint32_t slot = PopFreeSlot();
+    if (slot == BINDLESS_HEAP_INVALID_SLOT && RecycleSlots())
+        slot = PopFreeSlot();
+
+    if (slot == BINDLESS_HEAP_INVALID_SLOT)
+        return BINDLESS_HEAP_INVALID_SLOT;
+
+    // Different "ALLOW_UPDATE_AFTER_SET" descriptors can be updated concurrently
+    const Descriptor* descriptors[] = {&descriptor};
+
+    UpdateDescriptorRangeDesc updateDescriptorRangeDesc = {};
+    updateDescriptorRangeDesc.descriptorSet = m_DescriptorSet;
+    updateDescriptorRangeDesc.rangeIndex = 0;
+    updateDescriptorRangeDesc.baseDescriptor = slot;
+    updateDescriptorRangeDesc.descriptors = descriptors;
+    updateDescriptorRangeDesc.descriptorNum = 1;
+
+    m_iCore.UpdateDescriptorRanges(&updateDescriptorRangeDesc, 1);
+
+    return slot;
+}
+
+void BindlessHeapImpl::FreeSlot(uint32_t slot, uint64_t fenceValue) {
+    if (!fenceValue || !m_Desc.fence) {
+        PushFreeSlot(slot);
+        return;
+    }
+
+    ExclusiveScope lock(m_Lock);
+    m_PendingSlots.push_back({fenceValue, slot});
+}
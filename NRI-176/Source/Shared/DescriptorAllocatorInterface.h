@@ -0,0 +1,54 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct FramePool {
+    DescriptorPool* pool;
+    uint64_t fenceValue; // the last frame the pool has been used in
+};
+
+struct DescriptorAllocatorImpl final : public DebugNameBase {
+    inline DescriptorAllocatorImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Pools(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline DescriptorPool* GetCurrentPool() const {
+        return m_CurrentPool;
+    }
+
+    ~DescriptorAllocatorImpl();
+
+    Result Create(const DescriptorAllocatorDesc& desc);
+    void BeginFrame(uint64_t fenceValue);
+    DescriptorSet* AllocateDescriptorSet(const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        for (const FramePool& framePool : m_Pools)
+            m_iCore.SetDebugName(framePool.pool, name);
+    }
+
+private:
+    Result AcquirePool();
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    DescriptorAllocatorDesc m_Desc = {};
+    Vector<FramePool> m_Pools;
+    DescriptorPool* m_CurrentPool = nullptr;
+    uint64_t m_FenceValue = 0;
+};
+
+} // namespace nri
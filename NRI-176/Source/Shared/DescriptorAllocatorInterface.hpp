@@ -0,0 +1,77 @@
+// © 2025 NVIDIA Corporation
+
+DescriptorAllocatorImpl::~DescriptorAllocatorImpl() {
+    for (const FramePool& framePool : m_Pools)
+        m_iCore.DestroyDescriptorPool(framePool.pool);
+}
+
+Result DescriptorAllocatorImpl::Create(const DescriptorAllocatorDesc& desc) {
+    if (!desc.poolMaxNum)
+        return Result::INVALID_ARGUMENT;
+
+    m_Desc = desc;
+
+    // VK pools grow by themselves, other backends rely on chaining
+    m_Desc.poolDesc.flags |= DescriptorPoolBits::GROWABLE;
+
+    return AcquirePool();
+}
+
+Result DescriptorAllocatorImpl::AcquirePool() {
+    // A pool can be reused if its last frame is completed and it's not used in the current frame
+    uint64_t completedValue = m_iCore.GetFenceValue(*m_Desc.fence);
+
+    for (FramePool& framePool : m_Pools) {
+        if (framePool.fenceValue <= completedValue && framePool.fenceValue != m_FenceValue) {
+            m_iCore.ResetDescriptorPool(*framePool.pool);
+            framePool.fenceValue = m_FenceValue;
+            m_CurrentPool = framePool.pool;
+
+            return Result::SUCCESS;
+        }
+    }
+
+    if (m_Pools.size() >= m_Desc.poolMaxNum)
+        return Result::OUT_OF_MEMORY;
+
+    DescriptorPool* pool = nullptr;
+    Result result = m_iCore.CreateDescriptorPool(m_Device, m_Desc.poolDesc, pool);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Pools.push_back({pool, m_FenceValue});
+    m_CurrentPool = pool;
+
+    return Result::SUCCESS;
+}
+
+void DescriptorAllocatorImpl::BeginFrame(uint64_t fenceValue) {
+    m_FenceValue = fenceValue;
+
+    // Lazily acquired by the first allocation of the frame
+    m_CurrentPool = nullptr;
+}
+
+DescriptorSet* DescriptorAllocatorImpl::AllocateDescriptorSet(const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors) {
+    if (!m_CurrentPool && AcquirePool() != Result::SUCCESS)
+        return nullptr;
+
+    // The pool is private, i.e. its lock is never contended
+    DescriptorSet* descriptorSet = nullptr;
+    Result result = m_iCore.AllocateDescriptorSets(*m_CurrentPool, pipelineLayout, setIndex, &descriptorSet, 1, 0);
+
+    // The current pool is exhausted, chain another one (the caller rebinds it, see "GetDescriptorAllocatorPool")
+    if (result != Result::SUCCESS) {
+        if (AcquirePool() != Result::SUCCESS)
+            return nullptr;
+
+        result = m_iCore.AllocateDescriptorSets(*m_CurrentPool, pipelineLayout, setIndex, &descriptorSet, 1, 0);
+        if (result != Result::SUCCESS)
+            return nullptr;
+    }
+
+    if (descriptors)
+        m_iCore.UpdateDescriptorSet(*descriptorSet, descriptors);
+
+    return descriptorSet;
+}
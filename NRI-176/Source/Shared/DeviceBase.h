@@ -69,10 +69,18 @@ struct DeviceBase : public DebugNameBaseVal {
     virtual ~DeviceBase() {
     }
 
+    virtual Result FillFunctionTable(BindlessHeapInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(CoreInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(DescriptorAllocatorInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(HelperInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -81,6 +89,10 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(IndirectCommandsInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(LowLatencyInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -2,6 +2,8 @@
 
 #include "SharedExternal.h"
 
+#include "BindlessHeapInterface.h"
+#include "DescriptorAllocatorInterface.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
 #include "StreamerInterface.h"
@@ -9,6 +11,8 @@
 
 using namespace nri;
 
+#include "BindlessHeapInterface.hpp"
+#include "DescriptorAllocatorInterface.hpp"
 #include "HelperInterface.hpp"
 #include "ImguiInterface.hpp"
 #include "StreamerInterface.hpp"
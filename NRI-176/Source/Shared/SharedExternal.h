@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cassert>   // assert
+#include <chrono>    // steady_clock
 #include <cinttypes> // PRIu64
 #include <cstring>   // memcpy
 #include <numeric>   // lcm
@@ -23,9 +24,12 @@ typedef uint32_t DXGI_FORMAT;
 #include "NRI.h"
 #include "NRI.hlsl"
 
+#include "Extensions/NRIBindlessHeap.h"
+#include "Extensions/NRIDescriptorAllocator.h"
 #include "Extensions/NRIDeviceCreation.h"
 #include "Extensions/NRIHelper.h"
 #include "Extensions/NRIImgui.h"
+#include "Extensions/NRIIndirectCommands.h"
 #include "Extensions/NRILowLatency.h"
 #include "Extensions/NRIMeshShader.h"
 #include "Extensions/NRIRayTracing.h"
@@ -461,6 +465,51 @@ inline Dim_t GetDimension(GraphicsAPI api, const TextureDesc& textureDesc, Dim_t
     return dim;
 }
 
+// FNV-1a, "seed" allows to continue hashing
+inline uint64_t ComputeHash(const void* key, size_t len, uint64_t seed = 14695981039346656037ull) {
+    const uint8_t* p = (uint8_t*)key;
+    uint64_t result = seed;
+    while (len--)
+        result = (result ^ (*p++)) * 1099511628211ull;
+
+    return result;
+}
+
+template <typename T>
+inline void HashValue(uint64_t& hash, const T& value) {
+    hash = ComputeHash(&value, sizeof(T), hash);
+}
+
+// Serialized creation parameters are used as cache keys, which are compared on a hit, since hashes can collide
+inline void AppendBytes(Vector<uint8_t>& blob, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    blob.insert(blob.end(), bytes, bytes + size);
+}
+
+template <typename T>
+inline void AppendValue(Vector<uint8_t>& blob, const T& value) {
+    AppendBytes(blob, &value, sizeof(T));
+}
+
+// Field by field, since the struct has padding
+inline void SerializeSamplerDesc(Vector<uint8_t>& blob, const SamplerDesc& samplerDesc) {
+    AppendValue(blob, samplerDesc.filters.min);
+    AppendValue(blob, samplerDesc.filters.mag);
+    AppendValue(blob, samplerDesc.filters.mip);
+    AppendValue(blob, samplerDesc.filters.ext);
+    AppendValue(blob, samplerDesc.anisotropy);
+    AppendValue(blob, samplerDesc.mipBias);
+    AppendValue(blob, samplerDesc.mipMin);
+    AppendValue(blob, samplerDesc.mipMax);
+    AppendValue(blob, samplerDesc.addressModes.u);
+    AppendValue(blob, samplerDesc.addressModes.v);
+    AppendValue(blob, samplerDesc.addressModes.w);
+    AppendValue(blob, samplerDesc.compareOp);
+    AppendValue(blob, samplerDesc.borderColor);
+    AppendValue(blob, samplerDesc.isInteger);
+    AppendValue(blob, samplerDesc.unnormalizedCoordinates);
+}
+
 inline bool IsDepthBiasEnabled(const DepthBiasDesc& depthBiasDesc) {
     return depthBiasDesc.constant != 0.0f || depthBiasDesc.slope != 0.0f;
 }
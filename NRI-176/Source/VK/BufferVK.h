@@ -8,17 +8,27 @@ struct MemoryVK;
 
 struct BufferVK final : public DebugNameBase {
     inline BufferVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_UniqueId(device.GenerateUniqueId()) {
     }
 
     inline VkBuffer GetHandle() const {
         return m_Handle;
     }
 
+    // Identifies the resource in the device descriptor object cache, since a destroyed handle can be reused
+    inline uint64_t GetUniqueId() const {
+        return m_UniqueId;
+    }
+
     inline VkDeviceAddress GetDeviceAddress() const {
         return m_DeviceAddress;
     }
 
+    inline uint8_t* GetMappedMemory() const {
+        return m_MappedMemory;
+    }
+
     inline DeviceVK& GetDevice() const {
         return m_Device;
     }
@@ -51,6 +61,7 @@ struct BufferVK final : public DebugNameBase {
 private:
     DeviceVK& m_Device;
     VkBuffer m_Handle = VK_NULL_HANDLE;
+    uint64_t m_UniqueId = 0;
     VkDeviceAddress m_DeviceAddress = 0;
     uint8_t* m_MappedMemory = nullptr;
     VkDeviceMemory m_NonCoherentDeviceMemory = VK_NULL_HANDLE;
@@ -60,6 +71,7 @@ private:
     BufferDesc m_Desc = {};
     VmaAllocation m_VmaAllocation = nullptr;
     bool m_OwnsNativeObjects = true;
+    bool m_IsDeviceAddressRegistered = false;
 };
 
 inline VkDeviceAddress GetBufferDeviceAddress(const Buffer* buffer, uint64_t offset) {
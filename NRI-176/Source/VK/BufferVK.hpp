@@ -1,6 +1,9 @@
 // © 2021 NVIDIA Corporation
 
 BufferVK::~BufferVK() {
+    if (m_IsDeviceAddressRegistered)
+        m_Device.UnregisterBufferDeviceAddress(*this);
+
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
 
@@ -15,7 +18,8 @@ Result BufferVK::Create(const BufferDesc& bufferDesc) {
     m_Desc = bufferDesc;
 
     VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(bufferDesc, info);
+    VkBufferUsageFlags2CreateInfo usageInfo = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO};
+    m_Device.FillCreateInfo(bufferDesc, info, usageInfo);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateBuffer(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
@@ -84,6 +88,12 @@ Result BufferVK::AllocateAndBindMemory(MemoryLocation memoryLocation, float prio
 
         const auto& vk = m_Device.GetDispatchTable();
         m_DeviceAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+
+        // Emulated indirect commands resolve vertex and index buffer addresses on the CPU
+        if (!m_Device.m_IsSupported.deviceGeneratedCommands && (m_Desc.usage & (BufferUsageBits::VERTEX_BUFFER | BufferUsageBits::INDEX_BUFFER))) {
+            m_Device.RegisterBufferDeviceAddress(*this);
+            m_IsDeviceAddressRegistered = true;
+        }
     }
 
     return Result::SUCCESS;
@@ -127,6 +137,12 @@ Result BufferVK::BindMemory(MemoryVK& memory, uint64_t offset, bool bindMemory)
 
         const auto& vk = m_Device.GetDispatchTable();
         m_DeviceAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+
+        // Emulated indirect commands resolve vertex and index buffer addresses on the CPU
+        if (!m_Device.m_IsSupported.deviceGeneratedCommands && (m_Desc.usage & (BufferUsageBits::VERTEX_BUFFER | BufferUsageBits::INDEX_BUFFER))) {
+            m_Device.RegisterBufferDeviceAddress(*this);
+            m_IsDeviceAddressRegistered = true;
+        }
     }
 
     return Result::SUCCESS;
@@ -4,9 +4,13 @@
 
 namespace nri {
 
+struct CommandBufferVK;
+
 struct CommandAllocatorVK final : public DebugNameBase {
     inline CommandAllocatorVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_FreePrimaryCommandBuffers(device.GetStdAllocator())
+        , m_FreeSecondaryCommandBuffers(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandPool() const {
@@ -32,11 +36,21 @@ struct CommandAllocatorVK final : public DebugNameBase {
     // NRI
     //================================================================================================================
 
-    Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateCommandBuffer(CommandBuffer*& commandBuffer, VkCommandBufferLevel level);
+    void ReleaseCommandBuffer(CommandBufferVK& commandBuffer);
     void Reset();
 
+private:
+    Result AllocateCommandBuffers(VkCommandBufferLevel level);
+
+    inline Vector<CommandBufferVK*>& GetFreeCommandBuffers(VkCommandBufferLevel level) {
+        return level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? m_FreePrimaryCommandBuffers : m_FreeSecondaryCommandBuffers;
+    }
+
 private:
     DeviceVK& m_Device;
+    Vector<CommandBufferVK*> m_FreePrimaryCommandBuffers;   // m_Lock
+    Vector<CommandBufferVK*> m_FreeSecondaryCommandBuffers; // m_Lock
     VkCommandPool m_Handle = VK_NULL_HANDLE;
     QueueType m_Type = (QueueType)0;
     bool m_OwnsNativeObjects = true;
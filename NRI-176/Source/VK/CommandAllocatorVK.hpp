@@ -1,12 +1,46 @@
 // © 2021 NVIDIA Corporation
 
+// Command buffers are allocated in batches and recycled on destruction, i.e. "CreateCommandBuffer" rarely hits the driver or the heap.
+// Recycling relies on the implicit reset in "vkBeginCommandBuffer", i.e. on "VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT", which
+// is known to be set only for owned pools. Command buffers of wrapped pools are allocated one by one and freed on destruction
+constexpr uint32_t COMMAND_BUFFER_BATCH_SIZE = 8;
+
 CommandAllocatorVK::~CommandAllocatorVK() {
+    // Recycled command buffers come from the owned pool only, native command buffers are freed along with it
+    for (Vector<CommandBufferVK*>* freeCommandBuffers : {&m_FreePrimaryCommandBuffers, &m_FreeSecondaryCommandBuffers}) {
+        for (CommandBufferVK* commandBuffer : *freeCommandBuffers)
+            Destroy(commandBuffer);
+    }
+
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
         vk.DestroyCommandPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
     }
 }
 
+Result CommandAllocatorVK::AllocateCommandBuffers(VkCommandBufferLevel level) {
+    uint32_t commandBufferNum = m_OwnsNativeObjects ? COMMAND_BUFFER_BATCH_SIZE : 1;
+    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, level, commandBufferNum};
+
+    std::array<VkCommandBuffer, COMMAND_BUFFER_BATCH_SIZE> commandBufferHandles = {};
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.AllocateCommandBuffers(m_Device, &info, commandBufferHandles.data());
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateCommandBuffers");
+
+    Vector<CommandBufferVK*>& freeCommandBuffers = GetFreeCommandBuffers(level);
+    for (uint32_t i = 0; i < commandBufferNum; i++) {
+        VkCommandBuffer commandBufferHandle = commandBufferHandles[i];
+
+        CommandBufferVK* commandBufferVK = Allocate<CommandBufferVK>(m_Device.GetAllocationCallbacks(), m_Device);
+        commandBufferVK->Create(*this, commandBufferHandle, m_Type, level);
+
+        freeCommandBuffers.push_back(commandBufferVK);
+    }
+
+    return Result::SUCCESS;
+}
+
 Result CommandAllocatorVK::Create(const Queue& queue) {
     const QueueVK& queueVK = (QueueVK&)queue;
 
@@ -33,23 +67,43 @@ NRI_INLINE void CommandAllocatorVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)m_Handle, name);
 }
 
-NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& commandBuffer) {
+NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& commandBuffer, VkCommandBufferLevel level) {
     ExclusiveScope lock(m_Lock);
 
-    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+    Vector<CommandBufferVK*>& freeCommandBuffers = GetFreeCommandBuffers(level);
+    if (freeCommandBuffers.empty()) {
+        Result result = AllocateCommandBuffers(level);
+        if (result != Result::SUCCESS)
+            return result;
+    }
 
-    VkCommandBuffer commandBufferHandle = VK_NULL_HANDLE;
+    commandBuffer = (CommandBuffer*)freeCommandBuffers.back();
+    freeCommandBuffers.pop_back();
 
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.AllocateCommandBuffers(m_Device, &info, &commandBufferHandle);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateCommandBuffers");
+    return Result::SUCCESS;
+}
 
-    CommandBufferVK* commandBufferVK = Allocate<CommandBufferVK>(m_Device.GetAllocationCallbacks(), m_Device);
-    commandBufferVK->Create(m_Handle, commandBufferHandle, m_Type);
+NRI_INLINE void CommandAllocatorVK::ReleaseCommandBuffer(CommandBufferVK& commandBuffer) {
+    // A wrapped pool may lack "VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT", i.e. its command buffers can't be recycled
+    if (!m_OwnsNativeObjects) {
+        ExclusiveScope lock(m_Lock); // "vkFreeCommandBuffers" requires external synchronization of the pool
 
-    commandBuffer = (CommandBuffer*)commandBufferVK;
+        const auto& vk = m_Device.GetDispatchTable();
+        VkCommandBuffer commandBufferHandle = commandBuffer;
+        vk.FreeCommandBuffers(m_Device, m_Handle, 1, &commandBufferHandle);
 
-    return Result::SUCCESS;
+        Destroy(&commandBuffer);
+        return;
+    }
+
+    // The name must not leak to the next owner
+    commandBuffer.SetDebugName(nullptr);
+
+    ExclusiveScope lock(m_Lock);
+
+    // The native command buffer gets implicitly reset by the next "vkBeginCommandBuffer"
+    Vector<CommandBufferVK*>& freeCommandBuffers = GetFreeCommandBuffers(commandBuffer.GetLevel());
+    freeCommandBuffers.push_back(&commandBuffer);
 }
 
 NRI_INLINE void CommandAllocatorVK::Reset() {
@@ -5,12 +5,27 @@
 namespace nri {
 
 struct PipelineVK;
+struct ShaderObjectState;
 struct PipelineLayoutVK;
 struct DescriptorVK;
 
+// Shadow state, used to skip redundant binds
+struct BoundVertexBuffer {
+    VkBuffer handle;
+    uint64_t offset;
+    uint64_t stride;
+};
+
+struct BoundDescriptorSet {
+    uint64_t handle; // "VkDescriptorSet" or an offset in the descriptor buffer
+    BindPoint bindPoint;
+};
+
 struct CommandBufferVK final : public DebugNameBase {
     inline CommandBufferVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_BufferBarriers(device.GetStdAllocator())
+        , m_TextureBarriers(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandBuffer() const {
@@ -21,10 +36,25 @@ struct CommandBufferVK final : public DebugNameBase {
         return m_Device;
     }
 
-    ~CommandBufferVK();
+    inline CommandAllocatorVK* GetCommandAllocator() const {
+        return m_CommandAllocator;
+    }
+
+    inline VkCommandBufferLevel GetLevel() const {
+        return m_Level;
+    }
+
+    inline const CommandBufferStats& GetStats() const {
+        return m_Stats;
+    }
+
+    inline bool HasPendingBarriers() const {
+        return m_HasPendingBarriers;
+    }
 
-    void Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type);
+    void Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer, QueueType type, VkCommandBufferLevel level);
     Result Create(const CommandBufferVKDesc& commandBufferVKDesc);
+    void FlushBarriers();
 
     //================================================================================================================
     // DebugNameBase
@@ -37,15 +67,19 @@ struct CommandBufferVK final : public DebugNameBase {
     //================================================================================================================
 
     Result Begin(const DescriptorPool* descriptorPool);
+    Result BeginSecondary(const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool);
     Result End();
     void SetPipeline(const Pipeline& pipeline);
+    void SetDescriptorPool(const DescriptorPool& descriptorPool);
     void SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
+    void SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc);
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Barrier(const BarrierDesc& barrierDesc);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
+    void ExecuteCommandBuffers(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum);
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
     void SetScissors(const Rect* rects, uint32_t rectNum);
     void SetDepthBounds(float boundsMin, float boundsMax);
@@ -54,12 +88,20 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetBlendConstants(const Color32f& color);
     void SetShadingRate(const ShadingRateDesc& shadingRateDesc);
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
+    void SetTopology(Topology topology);
+    void SetCullMode(CullMode cullMode, bool frontCounterClockwise);
+    void SetDepthState(const DepthAttachmentDesc& depthAttachmentDesc);
+    void SetStencilState(const StencilAttachmentDesc& stencilAttachmentDesc);
+    void SetBlendState(uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    void ClearStorages(const ClearStorageDesc* clearDescs, uint32_t clearDescNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -70,6 +112,7 @@ struct CommandBufferVK final : public DebugNameBase {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
+    void CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
@@ -88,19 +131,59 @@ struct CommandBufferVK final : public DebugNameBase {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc);
+
+private:
+    void BindShaderObjects(const ShaderObjectState& state);
+    void EmulateIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc);
+    void FlushRootDescriptors();
+    void InvalidateState();
+    void UpdateRenderArea(const AttachmentsDesc& attachmentsDesc);
 
 private:
     DeviceVK& m_Device;
     const PipelineLayoutVK* m_PipelineLayout = nullptr;
     const DescriptorVK* m_DepthStencil = nullptr;
     VkCommandBuffer m_Handle = VK_NULL_HANDLE;
-    VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+    CommandAllocatorVK* m_CommandAllocator = nullptr; // owns the native command buffer, NULL if wrapped
+    VkCommandBufferLevel m_Level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     QueueType m_Type = (QueueType)0;
     uint32_t m_ViewMask = 0;
     BindPoint m_PipelineBindPoint = BindPoint::INHERIT;
     Dim_t m_RenderLayerNum = 0;
     Dim_t m_RenderWidth = 0;
     Dim_t m_RenderHeight = 0;
+    std::array<uint32_t, 32> m_VertexBufferStrides = {}; // "shader object" mode only
+    std::array<DescriptorUpdateData, ROOT_DESCRIPTOR_MAX_NUM> m_RootDescriptorData = {}; // pushed at once before the next draw, dispatch or trace
+    uint32_t m_RootDescriptorValidMask = 0;
+    uint32_t m_RootDescriptorDirtyMask = 0;
+    BindPoint m_RootDescriptorBindPoint = BindPoint::INHERIT;
+
+    // Redundant state filtering (reset in "InvalidateState")
+    const PipelineVK* m_Pipeline = nullptr;
+    std::array<BoundVertexBuffer, 32> m_VertexBuffers = {};
+    std::array<BoundDescriptorSet, 32> m_DescriptorSets = {}; // indexed by register space
+    std::array<VkViewport, 16> m_Viewports = {};
+    std::array<VkRect2D, 16> m_Scissors = {};
+    DepthBiasDesc m_DepthBias = {};
+    VkBuffer m_IndexBuffer = VK_NULL_HANDLE;
+    uint64_t m_IndexBufferOffset = 0;
+    IndexType m_IndexType = IndexType::MAX_NUM;
+    uint32_t m_VertexBufferValidMask = 0;
+    uint32_t m_DescriptorSetValidMask = 0;
+    uint32_t m_ViewportNum = 0; // 0 - unknown
+    uint32_t m_ScissorNum = 0;  // 0 - unknown
+    uint32_t m_StencilReference = uint32_t(-1); // front | back << 8
+    bool m_IsDepthBiasValid = false;
+
+    // Barriers are emitted at once before the next command, which needs them
+    VkMemoryBarrier2 m_GlobalBarrier = {};
+    Vector<VkBufferMemoryBarrier2> m_BufferBarriers;
+    Vector<VkImageMemoryBarrier2> m_TextureBarriers;
+    bool m_HasPendingBarriers = false;
+
+    CommandBufferStats m_Stats = {};
+    std::chrono::steady_clock::time_point m_RecordingStart = {};
 };
 
 } // namespace nri
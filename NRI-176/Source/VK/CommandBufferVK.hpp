@@ -1,44 +1,167 @@
 // © 2021 NVIDIA Corporation
 
+#include <algorithm>
 #include <math.h>
 
-static inline VkPipelineBindPoint GetPipelineBindPoint(BindPoint bindPoint) {
-    switch (bindPoint) {
-        case BindPoint::COMPUTE:
-            return VK_PIPELINE_BIND_POINT_COMPUTE;
-        case BindPoint::RAY_TRACING:
-            return VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR;
-        default:
-            return VK_PIPELINE_BIND_POINT_GRAPHICS;
-    }
-}
-
-CommandBufferVK::~CommandBufferVK() {
-    if (m_CommandPool) {
-        const auto& vk = m_Device.GetDispatchTable();
-        vk.FreeCommandBuffers(m_Device, m_CommandPool, 1, &m_Handle);
-    }
-}
-
-void CommandBufferVK::Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type) {
-    m_CommandPool = commandPool;
+void CommandBufferVK::Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer, QueueType type, VkCommandBufferLevel level) {
+    m_CommandAllocator = &commandAllocator;
     m_Handle = commandBuffer;
     m_Type = type;
+    m_Level = level;
 }
 
 Result CommandBufferVK::Create(const CommandBufferVKDesc& commandBufferVKDesc) {
-    m_CommandPool = VK_NULL_HANDLE;
+    m_CommandAllocator = nullptr;
     m_Handle = (VkCommandBuffer)commandBufferVKDesc.vkCommandBuffer;
     m_Type = commandBufferVKDesc.queueType;
 
     return Result::SUCCESS;
 }
 
+void CommandBufferVK::BindShaderObjects(const ShaderObjectState& state) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+    const ShaderObjectDesc& shaderObjectDesc = m_Device.GetShaderObjectDesc();
+    const RasterizationDesc& r = state.rasterization;
+    const MultisampleDesc& ms = state.multisample;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdBindShadersEXT(m_Handle, state.stageNum, state.stages.data(), state.shaders.data());
+
+    // There is no pipeline state, so everything not marked as "dynamic" in the pipeline is emitted here
+    if (state.hasVertexStage) {
+        uint32_t bindingNum = (uint32_t)state.vertexBindings.size();
+        Scratch<VkVertexInputBindingDescription2EXT> bindings = AllocateScratch(m_Device, VkVertexInputBindingDescription2EXT, bindingNum);
+
+        for (uint32_t i = 0; i < bindingNum; i++) {
+            bindings[i] = state.vertexBindings[i];
+            if (bindings[i].binding < m_VertexBufferStrides.size())
+                bindings[i].stride = m_VertexBufferStrides[bindings[i].binding];
+        }
+
+        vk.CmdSetVertexInputEXT(m_Handle, bindingNum, bindings, (uint32_t)state.vertexAttributes.size(), state.vertexAttributes.data());
+        vk.CmdSetPrimitiveRestartEnable(m_Handle, state.inputAssembly.primitiveRestart != PrimitiveRestart::DISABLED);
+
+        if (!(state.dynamicState & DynamicStateBits::TOPOLOGY))
+            SetTopology(state.inputAssembly.topology);
+    }
+
+    if (state.hasTessellationStages) {
+        vk.CmdSetPatchControlPointsEXT(m_Handle, state.inputAssembly.tessControlPointNum);
+        vk.CmdSetTessellationDomainOriginEXT(m_Handle, VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT);
+    }
+
+    // Rasterization
+    vk.CmdSetRasterizerDiscardEnable(m_Handle, VK_FALSE);
+    vk.CmdSetPolygonModeEXT(m_Handle, GetPolygonMode(r.fillMode));
+    vk.CmdSetDepthBiasEnable(m_Handle, IsDepthBiasEnabled(r.depthBias));
+    vk.CmdSetLineWidth(m_Handle, 1.0f); // pipelines bake in the same value
+
+    if (!(state.dynamicState & DynamicStateBits::CULL_MODE))
+        SetCullMode(r.cullMode, r.frontCounterClockwise);
+
+    if (shaderObjectDesc.depthClamp)
+        vk.CmdSetDepthClampEnableEXT(m_Handle, r.depthClamp);
+
+    if (deviceDesc.tiers.conservativeRaster)
+        vk.CmdSetConservativeRasterizationModeEXT(m_Handle, r.conservativeRaster ? VK_CONSERVATIVE_RASTERIZATION_MODE_OVERESTIMATE_EXT : VK_CONSERVATIVE_RASTERIZATION_MODE_DISABLED_EXT);
+
+    if (shaderObjectDesc.lineRasterization) {
+        vk.CmdSetLineRasterizationModeEXT(m_Handle, r.lineSmoothing ? VK_LINE_RASTERIZATION_MODE_RECTANGULAR_SMOOTH_KHR : VK_LINE_RASTERIZATION_MODE_DEFAULT_KHR);
+        vk.CmdSetLineStippleEnableEXT(m_Handle, VK_FALSE);
+    }
+
+    // Shading rate is set by the app if enabled in the pipeline, otherwise it's reset to defaults
+    if (deviceDesc.tiers.shadingRate && !r.shadingRate) {
+        VkExtent2D shadingRate = {1, 1};
+        VkFragmentShadingRateCombinerOpKHR combiners[2] = {VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR};
+        vk.CmdSetFragmentShadingRateKHR(m_Handle, &shadingRate, combiners);
+    }
+
+    // Multisample
+    VkSampleCountFlagBits sampleNum = (VkSampleCountFlagBits)ms.sampleNum;
+    VkSampleMask sampleMask = ms.sampleMask != ALL ? ms.sampleMask : ~0u; // "ALL" means "no mask", as in pipelines
+    vk.CmdSetRasterizationSamplesEXT(m_Handle, sampleNum);
+    vk.CmdSetSampleMaskEXT(m_Handle, sampleNum, &sampleMask);
+    vk.CmdSetAlphaToCoverageEnableEXT(m_Handle, ms.alphaToCoverage);
+
+    if (shaderObjectDesc.alphaToOne)
+        vk.CmdSetAlphaToOneEnableEXT(m_Handle, VK_FALSE);
+
+    if (shaderObjectDesc.sampleLocations)
+        vk.CmdSetSampleLocationsEnableEXT(m_Handle, ms.sampleLocations);
+
+    // Depth-stencil
+    if (!(state.dynamicState & DynamicStateBits::DEPTH))
+        SetDepthState(state.depth);
+
+    if (!(state.dynamicState & DynamicStateBits::STENCIL))
+        SetStencilState(state.stencil);
+
+    // Blending
+    if (deviceDesc.features.logicOp) {
+        vk.CmdSetLogicOpEnableEXT(m_Handle, state.logicOp != LogicOp::NONE);
+        if (state.logicOp != LogicOp::NONE)
+            vk.CmdSetLogicOpEXT(m_Handle, GetLogicOp(state.logicOp));
+    }
+
+    if (!(state.dynamicState & DynamicStateBits::BLEND) && !state.colors.empty())
+        SetBlendState(0, state.colors.data(), (uint32_t)state.colors.size());
+}
+
+void CommandBufferVK::InvalidateState() {
+    m_PipelineLayout = nullptr;
+    m_PipelineBindPoint = BindPoint::INHERIT;
+    m_VertexBufferStrides = {};
+    m_RootDescriptorValidMask = 0;
+    m_RootDescriptorDirtyMask = 0;
+
+    // The native state is undefined
+    m_Pipeline = nullptr;
+    m_IndexBuffer = VK_NULL_HANDLE;
+    m_VertexBufferValidMask = 0;
+    m_DescriptorSetValidMask = 0;
+    m_ViewportNum = 0;
+    m_ScissorNum = 0;
+    m_StencilReference = uint32_t(-1);
+    m_IsDepthBiasValid = false;
+}
+
+void CommandBufferVK::UpdateRenderArea(const AttachmentsDesc& attachmentsDesc) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    // TODO: if there are no attachments, render area has max dimensions. It can be suboptimal even on desktop. It's a no-go on tiled architectures
+    m_RenderLayerNum = deviceDesc.dimensions.attachmentLayerMaxNum;
+    m_RenderWidth = deviceDesc.dimensions.attachmentMaxDim;
+    m_RenderHeight = deviceDesc.dimensions.attachmentMaxDim;
+
+    for (uint32_t i = 0; i <= attachmentsDesc.colorNum; i++) {
+        const Descriptor* attachment = i < attachmentsDesc.colorNum ? attachmentsDesc.colors[i] : attachmentsDesc.depthStencil;
+        if (!attachment)
+            continue;
+
+        const DescriptorTexDesc& desc = ((DescriptorVK*)attachment)->GetTexDesc();
+
+        Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
+        Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
+
+        m_RenderLayerNum = std::min(m_RenderLayerNum, desc.layerNum);
+        m_RenderWidth = std::min(m_RenderWidth, w);
+        m_RenderHeight = std::min(m_RenderHeight, h);
+    }
+
+    bool hasAttachment = attachmentsDesc.depthStencil || attachmentsDesc.colors;
+    if (!hasAttachment)
+        m_RenderLayerNum = 1;
+
+    m_DepthStencil = (DescriptorVK*)attachmentsDesc.depthStencil;
+    m_ViewMask = attachmentsDesc.viewMask;
+}
+
 NRI_INLINE void CommandBufferVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)m_Handle, name);
 }
 
-NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
+NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool* descriptorPool) {
     VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
@@ -46,17 +169,91 @@ NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
     VkResult vkResult = vk.BeginCommandBuffer(m_Handle, &info);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkBeginCommandBuffer");
 
-    m_PipelineLayout = nullptr;
-    m_PipelineBindPoint = BindPoint::INHERIT;
+    InvalidateState();
+    m_Stats = {};
+    m_RecordingStart = std::chrono::steady_clock::now();
+
+    m_GlobalBarrier = {};
+    m_BufferBarriers.clear();
+    m_TextureBarriers.clear();
+    m_HasPendingBarriers = false;
+
+    if (descriptorPool)
+        SetDescriptorPool(*descriptorPool);
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result CommandBufferVK::BeginSecondary(const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool) {
+    // Formats must match the attachments of the render pass, which is continued by this command buffer
+    Scratch<VkFormat> colorFormats = AllocateScratch(m_Device, VkFormat, attachmentsDesc.colorNum);
+    VkSampleCountFlagBits sampleNum = VK_SAMPLE_COUNT_1_BIT;
+    for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
+        const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.colors[i];
+
+        colorFormats[i] = descriptor.GetTexDesc().format;
+        sampleNum = (VkSampleCountFlagBits)descriptor.GetTexture().GetDesc().sampleNum;
+    }
+
+    VkFormat depthFormat = VK_FORMAT_UNDEFINED;
+    VkFormat stencilFormat = VK_FORMAT_UNDEFINED;
+    if (attachmentsDesc.depthStencil) {
+        const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.depthStencil;
+        const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
+
+        depthFormat = descriptor.GetTexDesc().format;
+        stencilFormat = formatProps.isStencil ? depthFormat : VK_FORMAT_UNDEFINED;
+        sampleNum = (VkSampleCountFlagBits)descriptor.GetTexture().GetDesc().sampleNum;
+    }
+
+    VkCommandBufferInheritanceRenderingInfo renderingInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO};
+    renderingInfo.viewMask = attachmentsDesc.viewMask;
+    renderingInfo.colorAttachmentCount = attachmentsDesc.colorNum;
+    renderingInfo.pColorAttachmentFormats = colorFormats;
+    renderingInfo.depthAttachmentFormat = depthFormat;
+    renderingInfo.stencilAttachmentFormat = stencilFormat;
+    renderingInfo.rasterizationSamples = sampleNum;
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO};
+    inheritanceInfo.pNext = &renderingInfo;
+
+    VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    info.pInheritanceInfo = &inheritanceInfo;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.BeginCommandBuffer(m_Handle, &info);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkBeginCommandBuffer");
+
+    InvalidateState();
+    m_Stats = {};
+    m_RecordingStart = std::chrono::steady_clock::now();
+
+    m_GlobalBarrier = {};
+    m_BufferBarriers.clear();
+    m_TextureBarriers.clear();
+    m_HasPendingBarriers = false;
+
+    // Needed for "ClearAttachments"
+    UpdateRenderArea(attachmentsDesc);
+
+    if (descriptorPool)
+        SetDescriptorPool(*descriptorPool);
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result CommandBufferVK::End() {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.EndCommandBuffer(m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkEndCommandBuffer");
 
+    auto recordingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_RecordingStart);
+    m_Stats.recordingTime = (uint64_t)recordingTime.count();
+
     return Result::SUCCESS;
 }
 
@@ -79,6 +276,18 @@ NRI_INLINE void CommandBufferVK::SetViewports(const Viewport* viewports, uint32_
         }
     }
 
+    // Skip if nothing changed
+    if (viewportNum && viewportNum == m_ViewportNum && !memcmp(m_Viewports.data(), vkViewports, viewportNum * sizeof(VkViewport))) {
+        m_Stats.skippedViewportNum++;
+        return;
+    }
+
+    if (viewportNum <= m_Viewports.size()) {
+        memcpy(m_Viewports.data(), vkViewports, viewportNum * sizeof(VkViewport));
+        m_ViewportNum = viewportNum;
+    } else
+        m_ViewportNum = 0;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdSetViewportWithCount(m_Handle, viewportNum, vkViewports);
 }
@@ -94,6 +303,18 @@ NRI_INLINE void CommandBufferVK::SetScissors(const Rect* rects, uint32_t rectNum
         out.extent.height = in.height;
     }
 
+    // Skip if nothing changed
+    if (rectNum && rectNum == m_ScissorNum && !memcmp(m_Scissors.data(), vkRects, rectNum * sizeof(VkRect2D))) {
+        m_Stats.skippedScissorNum++;
+        return;
+    }
+
+    if (rectNum <= m_Scissors.size()) {
+        memcpy(m_Scissors.data(), vkRects, rectNum * sizeof(VkRect2D));
+        m_ScissorNum = rectNum;
+    } else
+        m_ScissorNum = 0;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdSetScissorWithCount(m_Handle, rectNum, vkRects);
 }
@@ -104,6 +325,14 @@ NRI_INLINE void CommandBufferVK::SetDepthBounds(float boundsMin, float boundsMax
 }
 
 NRI_INLINE void CommandBufferVK::SetStencilReference(uint8_t frontRef, uint8_t backRef) {
+    uint32_t stencilReference = frontRef | (backRef << 8);
+    if (stencilReference == m_StencilReference) {
+        m_Stats.skippedStencilReferenceNum++;
+        return;
+    }
+
+    m_StencilReference = stencilReference;
+
     const auto& vk = m_Device.GetDispatchTable();
 
     if (frontRef == backRef)
@@ -148,16 +377,90 @@ NRI_INLINE void CommandBufferVK::SetShadingRate(const ShadingRateDesc& shadingRa
 }
 
 NRI_INLINE void CommandBufferVK::SetDepthBias(const DepthBiasDesc& depthBiasDesc) {
+    if (m_IsDepthBiasValid && depthBiasDesc.constant == m_DepthBias.constant && depthBiasDesc.clamp == m_DepthBias.clamp && depthBiasDesc.slope == m_DepthBias.slope) {
+        m_Stats.skippedDepthBiasNum++;
+        return;
+    }
+
+    m_DepthBias = depthBiasDesc;
+    m_IsDepthBiasValid = true;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdSetDepthBias(m_Handle, depthBiasDesc.constant, depthBiasDesc.clamp, depthBiasDesc.slope);
 }
 
+NRI_INLINE void CommandBufferVK::SetTopology(Topology topology) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetPrimitiveTopology(m_Handle, GetTopology(topology));
+}
+
+NRI_INLINE void CommandBufferVK::SetCullMode(CullMode cullMode, bool frontCounterClockwise) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetCullMode(m_Handle, GetCullMode(cullMode));
+    vk.CmdSetFrontFace(m_Handle, frontCounterClockwise ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+}
+
+NRI_INLINE void CommandBufferVK::SetDepthState(const DepthAttachmentDesc& depthAttachmentDesc) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetDepthTestEnable(m_Handle, depthAttachmentDesc.compareOp != CompareOp::NONE);
+    vk.CmdSetDepthWriteEnable(m_Handle, depthAttachmentDesc.write);
+    vk.CmdSetDepthCompareOp(m_Handle, GetCompareOp(depthAttachmentDesc.compareOp));
+
+    if (m_Device.GetDesc().features.depthBoundsTest)
+        vk.CmdSetDepthBoundsTestEnable(m_Handle, depthAttachmentDesc.boundsTest);
+}
+
+NRI_INLINE void CommandBufferVK::SetStencilState(const StencilAttachmentDesc& stencilAttachmentDesc) {
+    const StencilDesc& front = stencilAttachmentDesc.front;
+    const StencilDesc& back = stencilAttachmentDesc.back;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetStencilTestEnable(m_Handle, front.compareOp != CompareOp::NONE || back.compareOp != CompareOp::NONE);
+    vk.CmdSetStencilOp(m_Handle, VK_STENCIL_FACE_FRONT_BIT, GetStencilOp(front.failOp), GetStencilOp(front.passOp), GetStencilOp(front.depthFailOp), GetCompareOp(front.compareOp));
+    vk.CmdSetStencilOp(m_Handle, VK_STENCIL_FACE_BACK_BIT, GetStencilOp(back.failOp), GetStencilOp(back.passOp), GetStencilOp(back.depthFailOp), GetCompareOp(back.compareOp));
+    vk.CmdSetStencilCompareMask(m_Handle, VK_STENCIL_FACE_FRONT_BIT, front.compareMask);
+    vk.CmdSetStencilCompareMask(m_Handle, VK_STENCIL_FACE_BACK_BIT, back.compareMask);
+    vk.CmdSetStencilWriteMask(m_Handle, VK_STENCIL_FACE_FRONT_BIT, front.writeMask);
+    vk.CmdSetStencilWriteMask(m_Handle, VK_STENCIL_FACE_BACK_BIT, back.writeMask);
+}
+
+NRI_INLINE void CommandBufferVK::SetBlendState(uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum) {
+    Scratch<VkBool32> blendEnables = AllocateScratch(m_Device, VkBool32, colorAttachmentNum);
+    Scratch<VkColorBlendEquationEXT> blendEquations = AllocateScratch(m_Device, VkColorBlendEquationEXT, colorAttachmentNum);
+    Scratch<VkColorComponentFlags> writeMasks = AllocateScratch(m_Device, VkColorComponentFlags, colorAttachmentNum);
+
+    for (uint32_t i = 0; i < colorAttachmentNum; i++) {
+        const ColorAttachmentDesc& attachmentDesc = colorAttachmentDescs[i];
+
+        blendEnables[i] = attachmentDesc.blendEnabled;
+        blendEquations[i] = {
+            GetBlendFactor(attachmentDesc.colorBlend.srcFactor),
+            GetBlendFactor(attachmentDesc.colorBlend.dstFactor),
+            GetBlendOp(attachmentDesc.colorBlend.op),
+            GetBlendFactor(attachmentDesc.alphaBlend.srcFactor),
+            GetBlendFactor(attachmentDesc.alphaBlend.dstFactor),
+            GetBlendOp(attachmentDesc.alphaBlend.op),
+        };
+        writeMasks[i] = GetColorComponent(attachmentDesc.colorWriteMask);
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetColorBlendEnableEXT(m_Handle, baseAttachment, colorAttachmentNum, blendEnables);
+    vk.CmdSetColorBlendEquationEXT(m_Handle, baseAttachment, colorAttachmentNum, blendEquations);
+    vk.CmdSetColorWriteMaskEXT(m_Handle, baseAttachment, colorAttachmentNum, writeMasks);
+}
+
 NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
     static_assert(sizeof(VkClearValue) == sizeof(ClearValue), "Sizeof mismatch");
 
+    m_Stats.clearNum += clearDescNum;
+
     if (!clearDescNum)
         return;
 
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     // Attachments
     uint32_t attachmentNum = 0;
     Scratch<VkClearAttachment> attachments = AllocateScratch(m_Device, VkClearAttachment, clearDescNum);
@@ -212,6 +515,11 @@ NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearDesc* clearDescs, u
 }
 
 NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearDesc) {
+    m_Stats.clearNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const DescriptorVK& storage = *(DescriptorVK*)clearDesc.storage;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -227,19 +535,100 @@ NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearDesc)
     }
 }
 
+NRI_INLINE void CommandBufferVK::ClearStorages(const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    m_Stats.clearNum += clearDescNum;
+
+    if (!clearDescNum)
+        return;
+
+    // Pending barriers get flushed once for the whole batch
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    static_assert(sizeof(VkClearColorValue) == sizeof(clearDescs->value), "Unexpected sizeof");
+
+    auto getHandle = [](const DescriptorVK& storage) -> uint64_t {
+        return storage.GetType() == DescriptorTypeVK::BUFFER_VIEW ? (uint64_t)storage.GetBufDesc().handle : (uint64_t)storage.GetImage();
+    };
+
+    auto isSameGroup = [&](const ClearStorageDesc& a, const ClearStorageDesc& b) {
+        const DescriptorVK& storageA = *(DescriptorVK*)a.storage;
+        const DescriptorVK& storageB = *(DescriptorVK*)b.storage;
+
+        return storageA.GetType() == storageB.GetType() && getHandle(storageA) == getHandle(storageB) && !memcmp(&a.value, &b.value, sizeof(a.value));
+    };
+
+    // Group clears by resource and value, buffer ranges are sorted by offset to be merged
+    Scratch<const ClearStorageDesc*> sortedClearDescs = AllocateScratch(m_Device, const ClearStorageDesc*, clearDescNum);
+    for (uint32_t i = 0; i < clearDescNum; i++)
+        sortedClearDescs[i] = clearDescs + i;
+
+    std::sort(sortedClearDescs + 0, sortedClearDescs + clearDescNum, [&](const ClearStorageDesc* a, const ClearStorageDesc* b) {
+        const DescriptorVK& storageA = *(DescriptorVK*)a->storage;
+        const DescriptorVK& storageB = *(DescriptorVK*)b->storage;
+
+        if (storageA.GetType() != storageB.GetType())
+            return storageA.GetType() < storageB.GetType();
+
+        uint64_t handleA = getHandle(storageA);
+        uint64_t handleB = getHandle(storageB);
+        if (handleA != handleB)
+            return handleA < handleB;
+
+        int32_t valueOrder = memcmp(&a->value, &b->value, sizeof(a->value));
+        if (valueOrder)
+            return valueOrder < 0;
+
+        if (storageA.GetType() == DescriptorTypeVK::BUFFER_VIEW)
+            return storageA.GetBufDesc().offset < storageB.GetBufDesc().offset;
+
+        return false;
+    });
+
+    // One command per group
+    const auto& vk = m_Device.GetDispatchTable();
+    Scratch<VkImageSubresourceRange> ranges = AllocateScratch(m_Device, VkImageSubresourceRange, clearDescNum);
+
+    for (uint32_t i = 0; i < clearDescNum;) {
+        const ClearStorageDesc& clearDesc = *sortedClearDescs[i];
+        const DescriptorVK& storage = *(DescriptorVK*)clearDesc.storage;
+
+        if (storage.GetType() == DescriptorTypeVK::BUFFER_VIEW) {
+            const DescriptorBufDesc& bufDesc = storage.GetBufDesc();
+            uint64_t begin = bufDesc.offset;
+            uint64_t end = bufDesc.offset + bufDesc.size;
+
+            // Merge overlapping and adjacent ranges
+            for (i++; i < clearDescNum && isSameGroup(clearDesc, *sortedClearDescs[i]); i++) {
+                const DescriptorBufDesc& nextBufDesc = ((DescriptorVK*)sortedClearDescs[i]->storage)->GetBufDesc();
+                if (nextBufDesc.offset > end)
+                    break;
+
+                end = std::max(end, nextBufDesc.offset + nextBufDesc.size);
+            }
+
+            vk.CmdFillBuffer(m_Handle, bufDesc.handle, begin, end - begin, clearDesc.value.ui.x);
+        } else {
+            uint32_t rangeNum = 0;
+            for (; i < clearDescNum && isSameGroup(clearDesc, *sortedClearDescs[i]); i++)
+                ranges[rangeNum++] = ((DescriptorVK*)sortedClearDescs[i]->storage)->GetImageSubresourceRange();
+
+            const VkClearColorValue* value = (VkClearColorValue*)&clearDesc.value;
+            vk.CmdClearColorImage(m_Handle, storage.GetImage(), VK_IMAGE_LAYOUT_GENERAL, value, rangeNum, ranges);
+        }
+    }
+}
+
 NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
-    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+    if (m_HasPendingBarriers)
+        FlushBarriers();
 
-    // TODO: if there are no attachments, render area has max dimensions. It can be suboptimal even on desktop. It's a no-go on tiled architectures
-    m_RenderLayerNum = deviceDesc.dimensions.attachmentLayerMaxNum;
-    m_RenderWidth = deviceDesc.dimensions.attachmentMaxDim;
-    m_RenderHeight = deviceDesc.dimensions.attachmentMaxDim;
+    UpdateRenderArea(attachmentsDesc);
 
     // Color
     Scratch<VkRenderingAttachmentInfo> colors = AllocateScratch(m_Device, VkRenderingAttachmentInfo, attachmentsDesc.colorNum);
     for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.colors[i];
-        const DescriptorTexDesc& desc = descriptor.GetTexDesc();
 
         VkRenderingAttachmentInfo& color = colors[i];
         color = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
@@ -251,13 +640,6 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         color.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
         color.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
         color.clearValue = {};
-
-        Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
-        Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
-
-        m_RenderLayerNum = std::min(m_RenderLayerNum, desc.layerNum);
-        m_RenderWidth = std::min(m_RenderWidth, w);
-        m_RenderHeight = std::min(m_RenderHeight, h);
     }
 
     // Depth-stencil
@@ -276,19 +658,9 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         depthStencil.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
         depthStencil.clearValue = {};
 
-        Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
-        Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
-
-        m_RenderLayerNum = std::min(m_RenderLayerNum, desc.layerNum);
-        m_RenderWidth = std::min(m_RenderWidth, w);
-        m_RenderHeight = std::min(m_RenderHeight, h);
-
         const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
         hasStencil = formatProps.isStencil != 0;
-
-        m_DepthStencil = &descriptor;
-    } else
-        m_DepthStencil = nullptr;
+    }
 
     // Shading rate
     VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRate = {VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR};
@@ -301,12 +673,8 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         shadingRate.shadingRateAttachmentTexelSize = {tileSize, tileSize};
     }
 
-    bool hasAttachment = attachmentsDesc.depthStencil || attachmentsDesc.colors;
-    if (!hasAttachment)
-        m_RenderLayerNum = 1;
-
     VkRenderingInfo renderingInfo = {VK_STRUCTURE_TYPE_RENDERING_INFO};
-    renderingInfo.flags = 0;
+    renderingInfo.flags = attachmentsDesc.secondaryCommandBuffers ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0;
     renderingInfo.renderArea = {{0, 0}, {m_RenderWidth, m_RenderHeight}};
     renderingInfo.layerCount = m_RenderLayerNum;
     renderingInfo.viewMask = attachmentsDesc.viewMask;
@@ -320,17 +688,33 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginRendering(m_Handle, &renderingInfo);
-
-    m_ViewMask = attachmentsDesc.viewMask;
 }
 
 NRI_INLINE void CommandBufferVK::EndRendering() {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdEndRendering(m_Handle);
 
     m_DepthStencil = nullptr;
 }
 
+NRI_INLINE void CommandBufferVK::ExecuteCommandBuffers(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    Scratch<VkCommandBuffer> handles = AllocateScratch(m_Device, VkCommandBuffer, commandBufferNum);
+    for (uint32_t i = 0; i < commandBufferNum; i++)
+        handles[i] = *(CommandBufferVK*)commandBuffers[i];
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteCommands(m_Handle, commandBufferNum, handles);
+
+    // Secondary command buffers leave the bound state undefined
+    InvalidateState();
+}
+
 NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
     Scratch<uint8_t> scratch = AllocateScratch(m_Device, uint8_t, vertexBufferNum * (sizeof(VkBuffer) + sizeof(VkDeviceSize) * 3));
     uint8_t* ptr = scratch;
@@ -363,6 +747,33 @@ NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const Verte
         }
     }
 
+    // Skip if all slots are already bound to the same buffers
+    if (baseSlot + vertexBufferNum <= m_VertexBuffers.size()) {
+        bool isRedundant = vertexBufferNum != 0;
+        for (uint32_t i = 0; i < vertexBufferNum; i++) {
+            uint32_t bit = 1u << (baseSlot + i);
+
+            BoundVertexBuffer& bound = m_VertexBuffers[baseSlot + i];
+            if (!(m_VertexBufferValidMask & bit) || bound.handle != handles[i] || bound.offset != offsets[i] || bound.stride != strides[i])
+                isRedundant = false;
+
+            bound = {handles[i], offsets[i], strides[i]};
+            m_VertexBufferValidMask |= bit;
+        }
+
+        if (isRedundant) {
+            m_Stats.skippedVertexBufferNum++;
+            return;
+        }
+    } else
+        m_VertexBufferValidMask = 0;
+
+    // Strides are also needed by "vkCmdSetVertexInputEXT" in "shader object" mode
+    if (m_Device.m_IsSupported.shaderObject) {
+        for (uint32_t i = 0; i < vertexBufferNum && baseSlot + i < m_VertexBufferStrides.size(); i++)
+            m_VertexBufferStrides[baseSlot + i] = (uint32_t)strides[i];
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBindVertexBuffers2(m_Handle, baseSlot, vertexBufferNum, handles, offsets, sizes, strides);
 }
@@ -370,6 +781,15 @@ NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const Verte
 NRI_INLINE void CommandBufferVK::SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType) {
     const BufferVK& bufferVK = (BufferVK&)buffer;
 
+    if (bufferVK.GetHandle() == m_IndexBuffer && offset == m_IndexBufferOffset && indexType == m_IndexType) {
+        m_Stats.skippedIndexBufferNum++;
+        return;
+    }
+
+    m_IndexBuffer = bufferVK.GetHandle();
+    m_IndexBufferOffset = offset;
+    m_IndexType = indexType;
+
     const auto& vk = m_Device.GetDispatchTable();
     if (m_Device.m_IsSupported.maintenance5) {
         uint64_t size = bufferVK.GetDesc().size - offset;
@@ -378,43 +798,82 @@ NRI_INLINE void CommandBufferVK::SetIndexBuffer(const Buffer& buffer, uint64_t o
         vk.CmdBindIndexBuffer(m_Handle, bufferVK.GetHandle(), offset, GetIndexType(indexType));
 }
 
-NRI_INLINE void CommandBufferVK::SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
-    m_PipelineLayout = (PipelineLayoutVK*)&pipelineLayout;
-    m_PipelineBindPoint = bindPoint;
+NRI_INLINE void CommandBufferVK::SetDescriptorPool(const DescriptorPool& descriptorPool) {
+    // Only descriptor buffers need to be bound (like D3D12 descriptor heaps)
+    if (!m_Device.m_IsSupported.descriptorBuffer)
+        return;
 
-    { // Push immutable samplers
-        const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+    const DescriptorPoolVK& descriptorPoolVK = (DescriptorPoolVK&)descriptorPool;
 
-        for (uint32_t i = bindingInfo.rootSamplerBindingOffset; i < (uint32_t)bindingInfo.pushDescriptors.size(); i++) {
-            // https://registry.khronos.org/vulkan/specs/latest/html/vkspec.html#descriptorsets-push-descriptors
-            // To push an immutable sampler...
-            VkDescriptorImageInfo imageInfo = {};
+    VkDescriptorBufferBindingPushDescriptorBufferHandleEXT pushDescriptorBuffer = {VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT};
+    pushDescriptorBuffer.buffer = descriptorPoolVK.GetDescriptorBuffer();
 
-            VkWriteDescriptorSet descriptorWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-            descriptorWrite.dstBinding = bindingInfo.pushDescriptors[i];
-            descriptorWrite.dstArrayElement = 0;
-            descriptorWrite.descriptorCount = 1;
-            descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
-            descriptorWrite.pImageInfo = &imageInfo;
+    VkDescriptorBufferBindingInfoEXT info = {VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT};
+    info.pNext = m_Device.GetDescriptorBufferDesc().bufferlessPushDescriptors ? nullptr : &pushDescriptorBuffer;
+    info.address = descriptorPoolVK.GetDescriptorBufferAddress();
+    info.usage = descriptorPoolVK.GetDescriptorBufferUsage();
 
-            VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdBindDescriptorBuffersEXT(m_Handle, 1, &info);
 
-            const auto& vk = m_Device.GetDispatchTable();
-            vk.CmdPushDescriptorSet(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, bindingInfo.rootRegisterSpace, 1, &descriptorWrite);
-        }
+    // Bound offsets now point to another buffer
+    m_DescriptorSetValidMask = 0;
+}
+
+NRI_INLINE void CommandBufferVK::SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
+    // Bound descriptor sets and root descriptors stay valid if the layout is the same
+    if (m_PipelineLayout == (PipelineLayoutVK*)&pipelineLayout && m_PipelineBindPoint == bindPoint) {
+        m_Stats.skippedPipelineLayoutNum++;
+        return;
+    }
+
+    // Root descriptors set for the previous layout
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
+    m_PipelineLayout = (PipelineLayoutVK*)&pipelineLayout;
+    m_PipelineBindPoint = bindPoint;
+    m_RootDescriptorValidMask = 0;
+    m_DescriptorSetValidMask = 0;
+
+    // Push immutable samplers
+    // https://registry.khronos.org/vulkan/specs/latest/html/vkspec.html#descriptorsets-push-descriptors
+    // To push an immutable sampler...
+    VkDescriptorUpdateTemplate rootSamplerTemplate = m_PipelineLayout->GetRootSamplerTemplate(bindPoint);
+    if (rootSamplerTemplate) {
+        const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+        const DescriptorUpdateData dummy = {};
+
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.CmdPushDescriptorSetWithTemplate(m_Handle, rootSamplerTemplate, *m_PipelineLayout, bindingInfo.rootRegisterSpace, &dummy);
     }
 }
 
 NRI_INLINE void CommandBufferVK::SetPipeline(const Pipeline& pipeline) {
     const PipelineVK& pipelineVK = (PipelineVK&)pipeline;
 
-    const auto& vk = m_Device.GetDispatchTable();
-    vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
+    if (&pipelineVK == m_Pipeline)
+        m_Stats.skippedPipelineNum++;
+    else {
+        const ShaderObjectState* shaderObjectState = pipelineVK.GetShaderObjectState();
+        if (shaderObjectState)
+            BindShaderObjects(*shaderObjectState);
+        else {
+            const auto& vk = m_Device.GetDispatchTable();
+            vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
+        }
+
+        m_Pipeline = &pipelineVK;
+
+        // Static state of the new pipeline overwrites dynamic state set before
+        m_StencilReference = uint32_t(-1);
+        m_IsDepthBiasValid = false;
+    }
 
     // Set depth bias provided at pipeline creation time to match D3D12 behavior
     const DepthBiasDesc& depthBias = pipelineVK.GetDepthBias();
     if (IsDepthBiasEnabled(depthBias))
-        vk.CmdSetDepthBias(m_Handle, depthBias.constant, depthBias.clamp, depthBias.slope);
+        SetDepthBias(depthBias);
 }
 
 NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
@@ -426,7 +885,35 @@ NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& se
 
     BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetDesc.bindPoint;
 
+    // Skip if the set is already bound
+    if (registerSpace < m_DescriptorSets.size()) {
+        uint64_t handle = m_Device.m_IsSupported.descriptorBuffer ? descriptorSetVK.GetDescriptorBufferOffset() : (uint64_t)vkDescriptorSet;
+        uint32_t bit = 1u << registerSpace;
+
+        BoundDescriptorSet& bound = m_DescriptorSets[registerSpace];
+        if ((m_DescriptorSetValidMask & bit) && bound.handle == handle && bound.bindPoint == bindPoint) {
+            m_Stats.skippedDescriptorSetNum++;
+            return;
+        }
+
+        bound = {handle, bindPoint};
+        m_DescriptorSetValidMask |= bit;
+    }
+
+    m_Stats.descriptorBindNum++;
+
     const auto& vk = m_Device.GetDispatchTable();
+    if (m_Device.m_IsSupported.descriptorBuffer) {
+        // Descriptor buffer: a set is an offset in the buffer bound by "SetDescriptorPool"
+        VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+        uint32_t bufferIndex = 0;
+        VkDeviceSize offset = descriptorSetVK.GetDescriptorBufferOffset();
+
+        vk.CmdSetDescriptorBufferOffsetsEXT(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, registerSpace, 1, &bufferIndex, &offset);
+
+        return;
+    }
+
 #if 0 // TODO: NV driver can crash if VVL is enabled...
     if (m_Device.m_IsSupported.maintenance6) {
         StageBits shaderStages = StageBits::NONE;
@@ -460,7 +947,63 @@ NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& se
     }
 }
 
+NRI_INLINE void CommandBufferVK::SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    m_Stats.descriptorBindNum += setDescriptorSetsDesc.descriptorSetNum;
+
+    const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+
+    BindPoint bindPoint = setDescriptorSetsDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetsDesc.bindPoint;
+    VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+
+    Scratch<VkDescriptorSet> vkDescriptorSets = AllocateScratch(m_Device, VkDescriptorSet, setDescriptorSetsDesc.descriptorSetNum);
+    Scratch<VkDeviceSize> offsets = AllocateScratch(m_Device, VkDeviceSize, setDescriptorSetsDesc.descriptorSetNum);
+    Scratch<uint32_t> bufferIndices = AllocateScratch(m_Device, uint32_t, setDescriptorSetsDesc.descriptorSetNum);
+
+    // Sets with consecutive register spaces get bound by a single call
+    const auto& vk = m_Device.GetDispatchTable();
+    const uint32_t* dynamicOffsets = setDescriptorSetsDesc.dynamicOffsets;
+    uint32_t firstRegisterSpace = 0;
+    uint32_t setNum = 0;
+    uint32_t dynamicOffsetNum = 0;
+
+    for (uint32_t i = 0; i <= setDescriptorSetsDesc.descriptorSetNum; i++) {
+        uint32_t setIndex = setDescriptorSetsDesc.baseSetIndex + i;
+        uint32_t registerSpace = i < setDescriptorSetsDesc.descriptorSetNum ? bindingInfo.sets[setIndex].registerSpace : 0;
+
+        if (setNum && (i == setDescriptorSetsDesc.descriptorSetNum || registerSpace != firstRegisterSpace + setNum)) {
+            if (m_Device.m_IsSupported.descriptorBuffer)
+                vk.CmdSetDescriptorBufferOffsetsEXT(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, firstRegisterSpace, setNum, bufferIndices, offsets);
+            else
+                vk.CmdBindDescriptorSets(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, firstRegisterSpace, setNum, vkDescriptorSets, dynamicOffsetNum, dynamicOffsets);
+
+            dynamicOffsets += dynamicOffsetNum;
+            setNum = 0;
+            dynamicOffsetNum = 0;
+        }
+
+        if (i == setDescriptorSetsDesc.descriptorSetNum)
+            break;
+
+        if (!setNum)
+            firstRegisterSpace = registerSpace;
+
+        // Not filtered (dynamic offsets are not tracked), but overwrites what "SetDescriptorSet" has bound
+        if (registerSpace < m_DescriptorSets.size())
+            m_DescriptorSetValidMask &= ~(1u << registerSpace);
+
+        const DescriptorSetVK& descriptorSetVK = *(DescriptorSetVK*)setDescriptorSetsDesc.descriptorSets[i];
+        vkDescriptorSets[setNum] = descriptorSetVK.GetHandle();
+        offsets[setNum] = descriptorSetVK.GetDescriptorBufferOffset();
+        bufferIndices[setNum] = 0; // descriptor buffer mode: a set is an offset in the buffer bound by "SetDescriptorPool"
+
+        setNum++;
+        dynamicOffsetNum += m_PipelineLayout->GetDynamicOffsetNum(setIndex);
+    }
+}
+
 NRI_INLINE void CommandBufferVK::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
+    m_Stats.rootConstantSize += setRootConstantsDesc.size;
+
     const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
     const PushConstantBindingDesc& pushConstantBindingDesc = bindingInfo.pushConstants[setRootConstantsDesc.rootConstantIndex];
     uint32_t offset = pushConstantBindingDesc.offset + setRootConstantsDesc.offset;
@@ -480,54 +1023,206 @@ NRI_INLINE void CommandBufferVK::SetRootConstants(const SetRootConstantsDesc& se
 }
 
 NRI_INLINE void CommandBufferVK::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
-    const DescriptorVK& descriptorVK = *(DescriptorVK*)setRootDescriptorDesc.descriptor;
+    m_Stats.descriptorBindNum++;
 
+    const DescriptorVK& descriptorVK = *(DescriptorVK*)setRootDescriptorDesc.descriptor;
     DescriptorTypeVK descriptorType = descriptorVK.GetType();
-    VkAccelerationStructureKHR accelerationStructure = descriptorVK.GetAccelerationStructure();
-
-    const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
 
-    VkDescriptorBufferInfo bufferInfo = descriptorVK.GetBufferInfo();
-    bufferInfo.offset += setRootDescriptorDesc.offset; // TODO: adjust "size"?
-
-    VkWriteDescriptorSetAccelerationStructureKHR accelerationStructureWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR};
-    accelerationStructureWrite.accelerationStructureCount = 1;
-    accelerationStructureWrite.pAccelerationStructures = &accelerationStructure;
-
-    VkWriteDescriptorSet descriptorWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    descriptorWrite.dstBinding = bindingInfo.pushDescriptors[setRootDescriptorDesc.rootDescriptorIndex];
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorCount = 1;
+    // Root descriptors set for another bind point
+    BindPoint bindPoint = setRootDescriptorDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setRootDescriptorDesc.bindPoint;
+    if (m_RootDescriptorDirtyMask && bindPoint != m_RootDescriptorBindPoint)
+        FlushRootDescriptors();
 
     // Let's match D3D12 spec (no textures, no typed buffers)
+    DescriptorUpdateData& data = m_RootDescriptorData[setRootDescriptorDesc.rootDescriptorIndex];
     if (descriptorType == DescriptorTypeVK::BUFFER_VIEW) {
-        const DescriptorBufDesc& bufDesc = descriptorVK.GetBufDesc();
-        descriptorWrite.descriptorType = bufDesc.viewType == BufferViewType::CONSTANT ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        descriptorWrite.pBufferInfo = &bufferInfo;
-    } else if (descriptorType == DescriptorTypeVK::ACCELERATION_STRUCTURE) {
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
-        descriptorWrite.pNext = &accelerationStructureWrite;
-    } else
+        data.buffer = descriptorVK.GetBufferInfo();
+        data.buffer.offset += setRootDescriptorDesc.offset; // TODO: adjust "size"?
+    } else if (descriptorType == DescriptorTypeVK::ACCELERATION_STRUCTURE)
+        data.accelerationStructure = descriptorVK.GetAccelerationStructure();
+    else
         CHECK(false, "Unexpected");
 
-    BindPoint bindPoint = setRootDescriptorDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setRootDescriptorDesc.bindPoint;
-    VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+    uint32_t bit = 1u << setRootDescriptorDesc.rootDescriptorIndex;
+    m_RootDescriptorValidMask |= bit;
+    m_RootDescriptorDirtyMask |= bit;
+    m_RootDescriptorBindPoint = bindPoint;
+}
 
+NRI_INLINE void CommandBufferVK::FlushRootDescriptors() {
+    const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
     const auto& vk = m_Device.GetDispatchTable();
-    vk.CmdPushDescriptorSet(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, bindingInfo.rootRegisterSpace, 1, &descriptorWrite);
+
+    // All root descriptors are known: push them at once using a template
+    uint32_t rootDescriptorNum = bindingInfo.rootSamplerBindingOffset;
+    uint32_t allMask = rootDescriptorNum == ROOT_DESCRIPTOR_MAX_NUM ? ~0u : (1u << rootDescriptorNum) - 1;
+
+    VkDescriptorUpdateTemplate rootDescriptorTemplate = m_PipelineLayout->GetRootDescriptorTemplate(m_RootDescriptorBindPoint);
+    if (rootDescriptorTemplate && m_RootDescriptorValidMask == allMask) {
+        vk.CmdPushDescriptorSetWithTemplate(m_Handle, rootDescriptorTemplate, *m_PipelineLayout, bindingInfo.rootRegisterSpace, m_RootDescriptorData.data());
+        m_RootDescriptorDirtyMask = 0;
+
+        return;
+    }
+
+    // Otherwise push only changed root descriptors, but still in one call
+    std::array<VkWriteDescriptorSet, ROOT_DESCRIPTOR_MAX_NUM> descriptorWrites;
+    std::array<VkWriteDescriptorSetAccelerationStructureKHR, ROOT_DESCRIPTOR_MAX_NUM> accelerationStructureWrites;
+    uint32_t descriptorWriteNum = 0;
+
+    for (uint32_t i = 0; i < rootDescriptorNum; i++) {
+        if (!(m_RootDescriptorDirtyMask & (1u << i)))
+            continue;
+
+        VkWriteDescriptorSet& descriptorWrite = descriptorWrites[descriptorWriteNum];
+        descriptorWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        descriptorWrite.dstBinding = bindingInfo.pushDescriptors[i];
+        descriptorWrite.dstArrayElement = 0;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.descriptorType = m_PipelineLayout->GetRootDescriptorType(i);
+
+        if (descriptorWrite.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+            VkWriteDescriptorSetAccelerationStructureKHR& accelerationStructureWrite = accelerationStructureWrites[descriptorWriteNum];
+            accelerationStructureWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR};
+            accelerationStructureWrite.accelerationStructureCount = 1;
+            accelerationStructureWrite.pAccelerationStructures = &m_RootDescriptorData[i].accelerationStructure;
+
+            descriptorWrite.pNext = &accelerationStructureWrite;
+        } else
+            descriptorWrite.pBufferInfo = &m_RootDescriptorData[i].buffer;
+
+        descriptorWriteNum++;
+    }
+
+    VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(m_RootDescriptorBindPoint);
+    vk.CmdPushDescriptorSet(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, bindingInfo.rootRegisterSpace, descriptorWriteNum, descriptorWrites.data());
+
+    m_RootDescriptorDirtyMask = 0;
 }
 
 NRI_INLINE void CommandBufferVK::Draw(const DrawDesc& drawDesc) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferVK::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    m_Stats.drawNum += drawNum;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
+    if (!stride)
+        stride = sizeof(DrawDesc);
+
+    const uint8_t* ptr = (uint8_t*)drawDescs;
+    const auto& vk = m_Device.GetDispatchTable();
+
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawDesc& drawDesc = *(DrawDesc*)(ptr + i * stride);
+            vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // Instancing parameters are shared by all draws in "vkCmdDrawMultiEXT", i.e. draws are batched while they match
+    uint32_t batchMaxNum = std::min(drawNum, m_Device.GetMultiDrawMaxNum());
+    Scratch<VkMultiDrawInfoEXT> drawInfos = AllocateScratch(m_Device, VkMultiDrawInfoEXT, batchMaxNum);
+
+    for (uint32_t i = 0; i < drawNum;) {
+        const DrawDesc& first = *(DrawDesc*)(ptr + i * stride);
+
+        uint32_t batchNum = 0;
+        for (; i < drawNum && batchNum < batchMaxNum; i++) {
+            const DrawDesc& drawDesc = *(DrawDesc*)(ptr + i * stride);
+            if (drawDesc.instanceNum != first.instanceNum || drawDesc.baseInstance != first.baseInstance)
+                break;
+
+            drawInfos[batchNum++] = {drawDesc.baseVertex, drawDesc.vertexNum};
+        }
+
+        vk.CmdDrawMultiEXT(m_Handle, batchNum, drawInfos, first.instanceNum, first.baseInstance, sizeof(VkMultiDrawInfoEXT));
+    }
+}
+
+NRI_INLINE void CommandBufferVK::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    m_Stats.drawNum += drawNum;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
+    if (!stride)
+        stride = sizeof(DrawIndexedDesc);
+
+    const uint8_t* ptr = (uint8_t*)drawIndexedDescs;
+    const auto& vk = m_Device.GetDispatchTable();
+
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(ptr + i * stride);
+            vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // Instancing parameters are shared by all draws in "vkCmdDrawMultiIndexedEXT", i.e. draws are batched while they match
+    uint32_t batchMaxNum = std::min(drawNum, m_Device.GetMultiDrawMaxNum());
+    Scratch<VkMultiDrawIndexedInfoEXT> drawInfos = AllocateScratch(m_Device, VkMultiDrawIndexedInfoEXT, batchMaxNum);
+
+    for (uint32_t i = 0; i < drawNum;) {
+        const DrawIndexedDesc& first = *(DrawIndexedDesc*)(ptr + i * stride);
+
+        uint32_t batchNum = 0;
+        for (; i < drawNum && batchNum < batchMaxNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(ptr + i * stride);
+            if (drawIndexedDesc.instanceNum != first.instanceNum || drawIndexedDesc.baseInstance != first.baseInstance)
+                break;
+
+            drawInfos[batchNum++] = {drawIndexedDesc.baseIndex, drawIndexedDesc.indexNum, drawIndexedDesc.baseVertex};
+        }
+
+        vk.CmdDrawMultiIndexedEXT(m_Handle, batchNum, drawInfos, first.instanceNum, first.baseInstance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+    }
+}
+
 NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const BufferVK& bufferVK = (BufferVK&)buffer;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -539,6 +1234,14 @@ NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t off
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const BufferVK& bufferVK = (BufferVK&)buffer;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -550,6 +1253,11 @@ NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint6
 }
 
 NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const BufferVK& src = (BufferVK&)srcBuffer;
     const BufferVK& dstBufferVK = (BufferVK&)dstBuffer;
 
@@ -568,7 +1276,46 @@ NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffse
     vk.CmdCopyBuffer2(m_Handle, &info);
 }
 
+NRI_INLINE void CommandBufferVK::CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    m_Stats.copyNum += regionNum;
+
+    if (!regionNum)
+        return;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    const BufferVK& src = (BufferVK&)srcBuffer;
+    const BufferVK& dstBufferVK = (BufferVK&)dstBuffer;
+
+    Scratch<VkBufferCopy2> copyRegions = AllocateScratch(m_Device, VkBufferCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const BufferCopyRegionDesc& in = regions[i];
+
+        VkBufferCopy2& out = copyRegions[i];
+        out = {VK_STRUCTURE_TYPE_BUFFER_COPY_2};
+        out.srcOffset = in.srcOffset;
+        out.dstOffset = in.dstOffset;
+        out.size = in.size == WHOLE_SIZE ? src.GetDesc().size : in.size;
+    }
+
+    // A single command for all regions
+    VkCopyBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2};
+    info.srcBuffer = src.GetHandle();
+    info.dstBuffer = dstBufferVK.GetHandle();
+    info.regionCount = regionNum;
+    info.pRegions = copyRegions;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdCopyBuffer2(m_Handle, &info);
+}
+
 NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -645,6 +1392,11 @@ NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureR
 }
 
 NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -721,6 +1473,11 @@ NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const Textu
 }
 
 NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const BufferVK& src = (BufferVK&)srcBuffer;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const FormatProps& formatProps = GetFormatProps(dst.GetDesc().format);
@@ -768,6 +1525,11 @@ NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, cons
 }
 
 NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const BufferVK& dst = (BufferVK&)dstBuffer;
     const FormatProps& formatProps = GetFormatProps(src.GetDesc().format);
@@ -815,6 +1577,11 @@ NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, cons
 }
 
 NRI_INLINE void CommandBufferVK::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    m_Stats.copyNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     BufferVK& dst = (BufferVK&)buffer;
 
     if (size == WHOLE_SIZE)
@@ -825,11 +1592,27 @@ NRI_INLINE void CommandBufferVK::ZeroBuffer(Buffer& buffer, uint64_t offset, uin
 }
 
 NRI_INLINE void CommandBufferVK::Dispatch(const DispatchDesc& dispatchDesc) {
+    m_Stats.dispatchNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDispatch(m_Handle, dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     static_assert(sizeof(DispatchDesc) == sizeof(VkDispatchIndirectCommand));
 
     const BufferVK& bufferVK = (BufferVK&)buffer;
@@ -897,28 +1680,90 @@ static inline VkAccessFlags2 GetAccessFlags(AccessBits accessBits) {
     return flags;
 }
 
+static inline uint32_t GetRangeEnd(uint32_t offset, uint32_t num) {
+    static_assert(VK_REMAINING_MIP_LEVELS == VK_REMAINING_ARRAY_LAYERS, "Unexpected");
+
+    return num == VK_REMAINING_MIP_LEVELS ? uint32_t(-1) : offset + num;
+}
+
+static inline bool IsOverlapped(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b) {
+    if (!(a.aspectMask & b.aspectMask))
+        return false;
+
+    bool isMipOverlapped = a.baseMipLevel < GetRangeEnd(b.baseMipLevel, b.levelCount) && b.baseMipLevel < GetRangeEnd(a.baseMipLevel, a.levelCount);
+    bool isLayerOverlapped = a.baseArrayLayer < GetRangeEnd(b.baseArrayLayer, b.layerCount) && b.baseArrayLayer < GetRangeEnd(a.baseArrayLayer, a.layerCount);
+
+    return isMipOverlapped && isLayerOverlapped;
+}
+
+static inline bool IsOverlapped(const VkBufferMemoryBarrier2& a, const VkBufferMemoryBarrier2& b) {
+    uint64_t aEnd = a.size == VK_WHOLE_SIZE ? uint64_t(-1) : a.offset + a.size;
+    uint64_t bEnd = b.size == VK_WHOLE_SIZE ? uint64_t(-1) : b.offset + b.size;
+
+    return a.buffer == b.buffer && a.offset < bEnd && b.offset < aEnd;
+}
+
+// Barriers in one "vkCmdPipelineBarrier2" don't chain with each other, i.e. a barrier, which "before" scope intersects
+// "after" scope of a pending barrier, can't share a batch with it. "ALL" stages are conservatively treated as intersecting everything
+template <typename T, typename U>
+static inline bool IsChained(const T& pending, const U& barrier) {
+    constexpr VkPipelineStageFlags2 allStages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT | VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT;
+
+    bool isStageOverlapped = (pending.dstStageMask & barrier.srcStageMask) || ((pending.dstStageMask | barrier.srcStageMask) & allStages);
+    bool isAccessOverlapped = (pending.dstAccessMask & barrier.srcAccessMask) != 0;
+
+    return isStageOverlapped || isAccessOverlapped;
+}
+
+// There is no work in between, so "before" and "after" scopes of both barriers can be united
+template <typename T>
+static inline void MergeBarrier(T& pending, const T& barrier) {
+    pending.srcStageMask |= barrier.srcStageMask;
+    pending.srcAccessMask |= barrier.srcAccessMask;
+    pending.dstStageMask |= barrier.dstStageMask;
+    pending.dstAccessMask |= barrier.dstAccessMask;
+}
+
 NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
-    // Global
-    Scratch<VkMemoryBarrier2> memoryBarriers = AllocateScratch(m_Device, VkMemoryBarrier2, barrierDesc.globalNum);
+    uint32_t barrierNum = barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum;
+    if (!barrierNum)
+        return;
+
+    m_Stats.requestedBarrierNum += barrierNum;
+
+    // Global: all merged into one
     for (uint32_t i = 0; i < barrierDesc.globalNum; i++) {
         const GlobalBarrierDesc& in = barrierDesc.globals[i];
 
-        VkMemoryBarrier2& out = memoryBarriers[i];
-        out = {VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+        VkMemoryBarrier2 out = {VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
         out.srcStageMask = GetPipelineStageFlags(in.before.stages);
         out.srcAccessMask = GetAccessFlags(in.before.access);
         out.dstStageMask = GetPipelineStageFlags(in.after.stages);
         out.dstAccessMask = GetAccessFlags(in.after.access);
+
+        // A global barrier covers all memory, i.e. it must not be chained to any pending buffer or texture barrier. The pending
+        // global barrier covers the same "range", i.e. it can be merged
+        bool isChained = false;
+        for (size_t j = 0; j < m_BufferBarriers.size() && !isChained; j++)
+            isChained = IsChained(m_BufferBarriers[j], out);
+        for (size_t j = 0; j < m_TextureBarriers.size() && !isChained; j++)
+            isChained = IsChained(m_TextureBarriers[j], out);
+
+        if (isChained)
+            FlushBarriers();
+
+        if (m_GlobalBarrier.sType)
+            MergeBarrier(m_GlobalBarrier, out);
+        else
+            m_GlobalBarrier = out;
     }
 
-    // Buffer
-    Scratch<VkBufferMemoryBarrier2> bufferBarriers = AllocateScratch(m_Device, VkBufferMemoryBarrier2, barrierDesc.bufferNum);
+    // Buffer: barriers of the same buffer range are merged
     for (uint32_t i = 0; i < barrierDesc.bufferNum; i++) {
         const BufferBarrierDesc& in = barrierDesc.buffers[i];
         const BufferVK& bufferVK = *(const BufferVK*)in.buffer;
 
-        VkBufferMemoryBarrier2& out = bufferBarriers[i];
-        out = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2};
+        VkBufferMemoryBarrier2 out = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2};
         out.srcStageMask = GetPipelineStageFlags(in.before.stages);
         out.srcAccessMask = GetAccessFlags(in.before.access);
         out.dstStageMask = GetPipelineStageFlags(in.after.stages);
@@ -926,12 +1771,37 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
         out.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // "VK_SHARING_MODE_CONCURRENT" is intentionally used for buffers to match D3D12 spec
         out.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         out.buffer = bufferVK.GetHandle();
-        out.offset = 0;
-        out.size = VK_WHOLE_SIZE;
+        out.offset = in.offset;
+        out.size = in.size == WHOLE_SIZE ? VK_WHOLE_SIZE : in.size;
+
+        if (m_GlobalBarrier.sType && IsChained(m_GlobalBarrier, out))
+            FlushBarriers();
+
+        // A barrier of the same range is merged with the pending one, a barrier of a different overlapping range must wait for it.
+        // Pending barriers never overlap, i.e. only one can be found
+        bool isMerged = false;
+        bool isOverlapped = false;
+        for (VkBufferMemoryBarrier2& pending : m_BufferBarriers) {
+            if (!IsOverlapped(pending, out))
+                continue;
+
+            if (pending.offset == out.offset && pending.size == out.size) {
+                MergeBarrier(pending, out);
+                isMerged = true;
+            } else
+                isOverlapped = true;
+
+            break;
+        }
+
+        if (isOverlapped)
+            FlushBarriers();
+
+        if (!isMerged)
+            m_BufferBarriers.push_back(out);
     }
 
-    // Texture
-    Scratch<VkImageMemoryBarrier2> textureBarriers = AllocateScratch(m_Device, VkImageMemoryBarrier2, barrierDesc.textureNum);
+    // Texture: a transition of the same subresources is chained to the pending one, other overlapping transitions can't share a batch
     for (uint32_t i = 0; i < barrierDesc.textureNum; i++) {
         const TextureBarrierDesc& in = barrierDesc.textures[i];
         const TextureVK& textureVK = *(TextureVK*)in.texture;
@@ -942,8 +1812,7 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
         if (in.planes == PlaneBits::ALL)
             aspectFlags = textureVK.GetImageAspectFlags();
 
-        VkImageMemoryBarrier2& out = textureBarriers[i];
-        out = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2};
+        VkImageMemoryBarrier2 out = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2};
         out.srcStageMask = GetPipelineStageFlags(in.before.stages);
         out.srcAccessMask = GetAccessFlags(in.before.access);
         out.dstStageMask = GetPipelineStageFlags(in.after.stages);
@@ -960,28 +1829,84 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
             in.layerOffset,
             (in.layerNum == REMAINING) ? VK_REMAINING_ARRAY_LAYERS : in.layerNum,
         };
+
+        if (m_GlobalBarrier.sType && IsChained(m_GlobalBarrier, out))
+            FlushBarriers();
+
+        bool isMerged = false;
+        bool isOverlapped = false;
+        for (VkImageMemoryBarrier2& pending : m_TextureBarriers) {
+            if (pending.image != out.image || !IsOverlapped(pending.subresourceRange, out.subresourceRange))
+                continue;
+
+            // Pending barriers never overlap, i.e. only one can be found
+            bool isSameRange = !memcmp(&pending.subresourceRange, &out.subresourceRange, sizeof(VkImageSubresourceRange));
+            bool isOwnershipTransfer = pending.srcQueueFamilyIndex != VK_QUEUE_FAMILY_IGNORED || pending.dstQueueFamilyIndex != VK_QUEUE_FAMILY_IGNORED
+                || out.srcQueueFamilyIndex != VK_QUEUE_FAMILY_IGNORED || out.dstQueueFamilyIndex != VK_QUEUE_FAMILY_IGNORED;
+            bool isChained = out.oldLayout == pending.newLayout || out.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED;
+
+            if (isSameRange && !isOwnershipTransfer && isChained) {
+                MergeBarrier(pending, out);
+                pending.newLayout = out.newLayout;
+                isMerged = true;
+            } else
+                isOverlapped = true;
+
+            break;
+        }
+
+        if (isOverlapped)
+            FlushBarriers();
+
+        if (!isMerged)
+            m_TextureBarriers.push_back(out);
     }
 
-    // Submit
+    m_HasPendingBarriers = true;
+
+    // Wrapped command buffers can get native commands at any time
+    if (!m_CommandAllocator)
+        FlushBarriers();
+}
+
+NRI_INLINE void CommandBufferVK::FlushBarriers() {
+    uint32_t globalNum = m_GlobalBarrier.sType ? 1 : 0;
+    uint32_t bufferNum = (uint32_t)m_BufferBarriers.size();
+    uint32_t textureNum = (uint32_t)m_TextureBarriers.size();
+
     VkDependencyInfo dependencyInfo = {VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
-    dependencyInfo.memoryBarrierCount = barrierDesc.globalNum;
-    dependencyInfo.pMemoryBarriers = memoryBarriers;
-    dependencyInfo.bufferMemoryBarrierCount = barrierDesc.bufferNum;
-    dependencyInfo.pBufferMemoryBarriers = bufferBarriers;
-    dependencyInfo.imageMemoryBarrierCount = barrierDesc.textureNum;
-    dependencyInfo.pImageMemoryBarriers = textureBarriers;
+    dependencyInfo.memoryBarrierCount = globalNum;
+    dependencyInfo.pMemoryBarriers = &m_GlobalBarrier;
+    dependencyInfo.bufferMemoryBarrierCount = bufferNum;
+    dependencyInfo.pBufferMemoryBarriers = m_BufferBarriers.data();
+    dependencyInfo.imageMemoryBarrierCount = textureNum;
+    dependencyInfo.pImageMemoryBarriers = m_TextureBarriers.data();
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
+
+    m_Stats.emittedBarrierNum += globalNum + bufferNum + textureNum;
+    m_Stats.barrierBatchNum++;
+
+    m_GlobalBarrier = {};
+    m_BufferBarriers.clear();
+    m_TextureBarriers.clear();
+    m_HasPendingBarriers = false;
 }
 
 NRI_INLINE void CommandBufferVK::BeginQuery(QueryPool& queryPool, uint32_t offset) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginQuery(m_Handle, queryPoolVK.GetHandle(), offset, (VkQueryControlFlagBits)0);
 }
 
 NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -994,6 +1919,9 @@ NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset)
 }
 
 NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     const QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const BufferVK& bufferVK = (BufferVK&)dstBuffer;
 
@@ -1005,6 +1933,9 @@ NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_
 }
 
 NRI_INLINE void CommandBufferVK::ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -1044,6 +1975,9 @@ NRI_INLINE void CommandBufferVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     static_assert(sizeof(VkAccelerationStructureInstanceKHR) == sizeof(TopLevelInstance), "Mismatched sizeof");
 
     Scratch<VkAccelerationStructureBuildGeometryInfoKHR> infos = AllocateScratch(m_Device, VkAccelerationStructureBuildGeometryInfoKHR, buildTopLevelAccelerationStructureDescNum);
@@ -1095,6 +2029,9 @@ NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const Build
 }
 
 NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     // Count
     uint32_t geometryTotalNum = 0;
     uint32_t micromapTotalNum = 0;
@@ -1164,6 +2101,9 @@ NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const Bu
 }
 
 NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     static_assert(sizeof(MicromapTriangle) == sizeof(VkMicromapTriangleEXT), "Mismatched sizeof");
 
     Scratch<VkMicromapBuildInfoEXT> infos = AllocateScratch(m_Device, VkMicromapBuildInfoEXT, buildMicromapDescNum);
@@ -1194,6 +2134,9 @@ NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMi
 }
 
 NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     VkAccelerationStructureKHR dstHandle = ((AccelerationStructureVK&)dst).GetHandle();
     VkAccelerationStructureKHR srcHandle = ((AccelerationStructureVK&)src).GetHandle();
 
@@ -1207,6 +2150,9 @@ NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure
 }
 
 NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src, CopyMode copyMode) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     VkMicromapEXT dstHandle = ((MicromapVK&)dst).GetHandle();
     VkMicromapEXT srcHandle = ((MicromapVK&)src).GetHandle();
 
@@ -1220,6 +2166,9 @@ NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src
 }
 
 NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const AccelerationStructure* const* accelerationStructures, uint32_t accelerationStructureNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     Scratch<VkAccelerationStructureKHR> handles = AllocateScratch(m_Device, VkAccelerationStructureKHR, accelerationStructureNum);
     for (uint32_t i = 0; i < accelerationStructureNum; i++)
         handles[i] = ((AccelerationStructureVK*)accelerationStructures[i])->GetHandle();
@@ -1231,6 +2180,9 @@ NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const Accelera
 }
 
 NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micromaps, uint32_t micromapNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
     Scratch<VkMicromapEXT> handles = AllocateScratch(m_Device, VkMicromapEXT, micromapNum);
     for (uint32_t i = 0; i < micromapNum; i++)
         handles[i] = ((MicromapVK*)micromaps[i])->GetHandle();
@@ -1242,6 +2194,14 @@ NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micr
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRaysDesc) {
+    m_Stats.dispatchNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     VkStridedDeviceAddressRegionKHR raygen = {};
     raygen.deviceAddress = GetBufferDeviceAddress(dispatchRaysDesc.raygenShader.buffer, dispatchRaysDesc.raygenShader.offset);
     raygen.size = dispatchRaysDesc.raygenShader.size;
@@ -1267,6 +2227,14 @@ NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRa
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint64_t offset) {
+    m_Stats.dispatchNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     static_assert(sizeof(DispatchRaysIndirectDesc) == sizeof(VkTraceRaysIndirectCommand2KHR));
 
     VkDeviceAddress deviceAddress = GetBufferDeviceAddress(&buffer, offset);
@@ -1276,11 +2244,27 @@ NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawMeshTasksEXT(m_Handle, drawMeshTasksDesc.x, drawMeshTasksDesc.y, drawMeshTasksDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    m_Stats.drawNum++;
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
     static_assert(sizeof(DrawMeshTasksDesc) == sizeof(VkDrawMeshTasksIndirectCommandEXT));
 
     const BufferVK& bufferVK = (BufferVK&)buffer;
@@ -1292,3 +2276,138 @@ NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uin
     } else
         vk.CmdDrawMeshTasksIndirectEXT(m_Handle, bufferVK.GetHandle(), offset, drawNum, stride);
 }
+
+NRI_INLINE void CommandBufferVK::ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    const IndirectCommandLayoutVK& indirectCommandLayoutVK = *(IndirectCommandLayoutVK*)executeIndirectCommandsDesc.indirectCommandLayout;
+    if (!(VkIndirectCommandsLayoutEXT)indirectCommandLayoutVK) {
+        EmulateIndirectCommands(executeIndirectCommandsDesc);
+        return;
+    }
+
+    if (m_HasPendingBarriers)
+        FlushBarriers();
+
+    if (m_RootDescriptorDirtyMask)
+        FlushRootDescriptors();
+
+    static_assert(sizeof(IndirectVertexBufferDesc) == sizeof(VkBindVertexBufferIndirectCommandEXT), "Type mismatch");
+    static_assert(sizeof(IndirectIndexBufferDesc) == sizeof(VkBindIndexBufferIndirectCommandEXT), "Type mismatch");
+    static_assert(VK_INDEX_TYPE_UINT16 == 0 && VK_INDEX_TYPE_UINT32 == 1, "Type mismatch");
+
+    CHECK(m_Pipeline, "A pipeline must be bound");
+
+    const BufferVK& bufferVK = *(BufferVK*)executeIndirectCommandsDesc.buffer;
+    const BufferVK* preprocessBufferVK = (BufferVK*)executeIndirectCommandsDesc.preprocessBuffer;
+
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    pipelineInfo.pipeline = *m_Pipeline;
+
+    VkGeneratedCommandsInfoEXT info = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_EXT};
+    info.pNext = &pipelineInfo;
+    info.shaderStages = indirectCommandLayoutVK.GetShaderStages();
+    info.indirectCommandsLayout = indirectCommandLayoutVK;
+    info.indirectAddress = bufferVK.GetDeviceAddress() + executeIndirectCommandsDesc.offset;
+    info.indirectAddressSize = (VkDeviceSize)executeIndirectCommandsDesc.sequenceMaxNum * indirectCommandLayoutVK.GetStride();
+    info.preprocessAddress = preprocessBufferVK ? preprocessBufferVK->GetDeviceAddress() : 0;
+    info.preprocessSize = preprocessBufferVK ? preprocessBufferVK->GetDesc().size : 0;
+    info.maxSequenceCount = executeIndirectCommandsDesc.sequenceMaxNum;
+    info.sequenceCountAddress = GetBufferDeviceAddress(executeIndirectCommandsDesc.countBuffer, executeIndirectCommandsDesc.countBufferOffset);
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteGeneratedCommandsEXT(m_Handle, VK_FALSE, &info);
+
+    if (m_PipelineBindPoint == BindPoint::COMPUTE)
+        m_Stats.dispatchNum++;
+    else
+        m_Stats.drawNum++;
+
+    // The state set by the sequences is undefined
+    m_IndexBuffer = VK_NULL_HANDLE;
+    m_VertexBufferValidMask = 0;
+}
+
+void CommandBufferVK::EmulateIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    const IndirectCommandLayoutVK& indirectCommandLayoutVK = *(IndirectCommandLayoutVK*)executeIndirectCommandsDesc.indirectCommandLayout;
+    const BufferVK& bufferVK = *(BufferVK*)executeIndirectCommandsDesc.buffer;
+
+    // Sequences are read at record time, i.e. the buffers must be CPU-visible and filled
+    const uint8_t* sequences = bufferVK.GetMappedMemory();
+    CHECK(sequences, "'buffer' must be CPU-visible if indirect commands are emulated");
+    if (!sequences)
+        return;
+
+    sequences += executeIndirectCommandsDesc.offset;
+
+    uint32_t sequenceNum = executeIndirectCommandsDesc.sequenceMaxNum;
+    if (executeIndirectCommandsDesc.countBuffer) {
+        const BufferVK& countBufferVK = *(BufferVK*)executeIndirectCommandsDesc.countBuffer;
+
+        const uint8_t* count = countBufferVK.GetMappedMemory();
+        CHECK(count, "'countBuffer' must be CPU-visible if indirect commands are emulated");
+        if (!count)
+            return;
+
+        sequenceNum = std::min(sequenceNum, *(uint32_t*)(count + executeIndirectCommandsDesc.countBufferOffset));
+    }
+
+    const IndirectCommandDesc* commands = indirectCommandLayoutVK.GetCommands();
+    uint32_t commandNum = indirectCommandLayoutVK.GetCommandNum();
+    uint32_t stride = indirectCommandLayoutVK.GetStride();
+
+    for (uint32_t i = 0; i < sequenceNum; i++) {
+        const uint8_t* sequence = sequences + (size_t)i * stride;
+
+        // A sequence referencing an unknown buffer is skipped, instead of drawing with a null or stale binding
+        bool isValid = true;
+        for (uint32_t j = 0; j < commandNum && isValid; j++) {
+            const IndirectCommandDesc& command = commands[j];
+            const uint8_t* data = sequence + command.offset;
+
+            switch (command.type) {
+                case IndirectCommandType::ROOT_CONSTANTS: {
+                    SetRootConstantsDesc setRootConstantsDesc = {};
+                    setRootConstantsDesc.rootConstantIndex = command.rootConstantIndex;
+                    setRootConstantsDesc.data = data;
+                    setRootConstantsDesc.size = command.rootConstantSize;
+
+                    SetRootConstants(setRootConstantsDesc);
+                } break;
+                case IndirectCommandType::VERTEX_BUFFER: {
+                    const IndirectVertexBufferDesc& indirectVertexBufferDesc = *(IndirectVertexBufferDesc*)data;
+
+                    VertexBufferDesc vertexBufferDesc = {};
+                    vertexBufferDesc.buffer = (Buffer*)m_Device.FindBufferByDeviceAddress(indirectVertexBufferDesc.deviceAddress, vertexBufferDesc.offset);
+                    vertexBufferDesc.stride = indirectVertexBufferDesc.stride;
+                    CHECK(vertexBufferDesc.buffer, "Unknown vertex buffer address");
+
+                    isValid = vertexBufferDesc.buffer != nullptr;
+                    if (isValid)
+                        SetVertexBuffers(command.vertexBufferSlot, &vertexBufferDesc, 1);
+                } break;
+                case IndirectCommandType::INDEX_BUFFER: {
+                    const IndirectIndexBufferDesc& indirectIndexBufferDesc = *(IndirectIndexBufferDesc*)data;
+
+                    uint64_t offset = 0;
+                    const BufferVK* indexBufferVK = m_Device.FindBufferByDeviceAddress(indirectIndexBufferDesc.deviceAddress, offset);
+                    CHECK(indexBufferVK, "Unknown index buffer address");
+
+                    isValid = indexBufferVK != nullptr;
+                    if (isValid)
+                        SetIndexBuffer(*(Buffer*)indexBufferVK, offset, indirectIndexBufferDesc.indexType ? IndexType::UINT32 : IndexType::UINT16);
+                } break;
+                case IndirectCommandType::DRAW:
+                    Draw(*(DrawDesc*)data);
+                    break;
+                case IndirectCommandType::DRAW_INDEXED:
+                    DrawIndexed(*(DrawIndexedDesc*)data);
+                    break;
+                case IndirectCommandType::DISPATCH:
+                    Dispatch(*(DispatchDesc*)data);
+                    break;
+                default:
+                    CHECK(false, "Unexpected");
+                    break;
+            }
+        }
+    }
+}
@@ -60,6 +60,30 @@ constexpr VkDescriptorType GetDescriptorType(DescriptorType type) {
     return g_DescriptorTypes[(size_t)type];
 }
 
+constexpr VkDescriptorType GetDescriptorType(const DescriptorRangeDesc& range) {
+    VkDescriptorType descriptorType = GetDescriptorType(range.descriptorType);
+
+    if (range.flags & DescriptorRangeBits::DYNAMIC_OFFSET) {
+        if (descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+            return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        if (descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    }
+
+    return descriptorType;
+}
+
+constexpr VkPipelineBindPoint GetPipelineBindPoint(BindPoint bindPoint) {
+    switch (bindPoint) {
+        case BindPoint::COMPUTE:
+            return VK_PIPELINE_BIND_POINT_COMPUTE;
+        case BindPoint::RAY_TRACING:
+            return VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR;
+        default:
+            return VK_PIPELINE_BIND_POINT_GRAPHICS;
+    }
+}
+
 constexpr std::array<VkPrimitiveTopology, (size_t)Topology::MAX_NUM> g_Topologies = {
     VK_PRIMITIVE_TOPOLOGY_POINT_LIST,                    // POINT_LIST
     VK_PRIMITIVE_TOPOLOGY_LINE_LIST,                     // LINE_LIST
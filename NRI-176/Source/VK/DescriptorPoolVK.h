@@ -6,20 +6,41 @@
 
 namespace nri {
 
+struct PipelineLayoutVK;
+
+// Descriptor set objects must not move, since pointers to them are returned to the user
+struct ChainedDescriptorPoolVK {
+    VkDescriptorPool handle;
+    Vector<DescriptorSetVK> descriptorSets;
+    uint32_t descriptorSetNum;
+};
+
 struct DescriptorPoolVK final : public DebugNameBase {
     inline DescriptorPoolVK(DeviceVK& device)
         : m_Device(device)
-        , m_DescriptorSets(device.GetStdAllocator()) {
+        , m_Pools(device.GetStdAllocator()) {
     }
 
     inline operator VkDescriptorPool() const {
-        return m_Handle;
+        return m_Pools.empty() ? VK_NULL_HANDLE : m_Pools[0].handle;
     }
 
     inline DeviceVK& GetDevice() const {
         return m_Device;
     }
 
+    inline VkBuffer GetDescriptorBuffer() const {
+        return m_DescriptorBuffer;
+    }
+
+    inline VkDeviceAddress GetDescriptorBufferAddress() const {
+        return m_DescriptorBufferAddress;
+    }
+
+    inline VkBufferUsageFlags GetDescriptorBufferUsage() const {
+        return m_DescriptorBufferUsage;
+    }
+
     ~DescriptorPoolVK();
 
     Result Create(const DescriptorPoolDesc& descriptorPoolDesc);
@@ -37,12 +58,35 @@ struct DescriptorPoolVK final : public DebugNameBase {
 
     void Reset();
     Result AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
+    void GetStats(DescriptorPoolStats& descriptorPoolStats);
+
+private:
+    Result CreateDescriptorBuffer(const DescriptorPoolDesc& descriptorPoolDesc);
+    Result AllocateDescriptorBufferSets(const PipelineLayoutVK& pipelineLayoutVK, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
+    Result ChainPool(const DescriptorSetDesc* descriptorSetDesc, uint32_t instanceNum, uint32_t variableDescriptorNum);
+    void AccumulateUsage(const DescriptorSetDesc& descriptorSetDesc, uint32_t instanceNum, uint32_t variableDescriptorNum);
 
 private:
     DeviceVK& m_Device;
-    VkDescriptorPool m_Handle = VK_NULL_HANDLE;
-    Vector<DescriptorSetVK> m_DescriptorSets;
-    uint32_t m_DescriptorSetNum = 0;
+    Vector<ChainedDescriptorPoolVK> m_Pools; // the first one is the pool itself, others are chained in "GROWABLE" mode
+    std::array<VkDescriptorPoolSize, 16> m_PoolSizes = {};
+    DescriptorPoolDesc m_Usage = {};     // since the last reset
+    DescriptorPoolDesc m_PeakUsage = {}; // till the last reset
+    VkDescriptorPoolCreateFlags m_PoolFlags = 0;
+    uint32_t m_PoolSizeNum = 0;
+    uint32_t m_DescriptorSetMaxNum = 0;
+    uint32_t m_PoolIndex = 0;
+    bool m_IsGrowable = false;
+
+    // "Descriptor buffer" mode
+    VkBuffer m_DescriptorBuffer = VK_NULL_HANDLE;
+    VmaAllocation m_VmaAllocation = nullptr;
+    uint8_t* m_DescriptorBufferData = nullptr;
+    VkDeviceAddress m_DescriptorBufferAddress = 0;
+    VkBufferUsageFlags m_DescriptorBufferUsage = 0;
+    uint64_t m_DescriptorBufferSize = 0;
+    uint64_t m_DescriptorBufferOffset = 0;
+
     bool m_OwnsNativeObjects = true;
     Lock m_Lock;
 };
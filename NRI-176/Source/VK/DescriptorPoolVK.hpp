@@ -3,7 +3,11 @@
 DescriptorPoolVK::~DescriptorPoolVK() {
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
-        vk.DestroyDescriptorPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+        for (const ChainedDescriptorPoolVK& pool : m_Pools)
+            vk.DestroyDescriptorPool(m_Device, pool.handle, m_Device.GetVkAllocationCallbacks());
+
+        if (m_VmaAllocation)
+            vmaDestroyBuffer(m_Device.GetVma(), m_DescriptorBuffer, m_VmaAllocation);
     }
 }
 
@@ -15,52 +19,309 @@ static inline void AddDescriptorPoolSize(std::array<VkDescriptorPoolSize, 16>& p
     }
 }
 
+static inline uint32_t MulSaturated(uint32_t a, uint32_t b) {
+    uint64_t result = (uint64_t)a * b;
+
+    return result > UINT32_MAX ? UINT32_MAX : (uint32_t)result;
+}
+
+static inline uint32_t AddSaturated(uint32_t a, uint32_t b) {
+    uint64_t result = (uint64_t)a + b;
+
+    return result > UINT32_MAX ? UINT32_MAX : (uint32_t)result;
+}
+
+// "isSum = false" raises the count of the type to "descriptorCount" (if lower)
+static inline void MergeDescriptorPoolSize(std::array<VkDescriptorPoolSize, 16>& poolSizes, uint32_t& poolSizeNum, VkDescriptorType type, uint32_t descriptorCount, bool isSum) {
+    for (uint32_t i = 0; i < poolSizeNum; i++) {
+        VkDescriptorPoolSize& poolSize = poolSizes[i];
+        if (poolSize.type == type) {
+            poolSize.descriptorCount = isSum ? AddSaturated(poolSize.descriptorCount, descriptorCount) : std::max(poolSize.descriptorCount, descriptorCount);
+            return;
+        }
+    }
+
+    AddDescriptorPoolSize(poolSizes, poolSizeNum, type, descriptorCount);
+}
+
+static inline void MaxDescriptorPoolUsage(DescriptorPoolDesc& dst, const DescriptorPoolDesc& src) {
+    dst.descriptorSetMaxNum = std::max(dst.descriptorSetMaxNum, src.descriptorSetMaxNum);
+    dst.samplerMaxNum = std::max(dst.samplerMaxNum, src.samplerMaxNum);
+    dst.constantBufferMaxNum = std::max(dst.constantBufferMaxNum, src.constantBufferMaxNum);
+    dst.textureMaxNum = std::max(dst.textureMaxNum, src.textureMaxNum);
+    dst.storageTextureMaxNum = std::max(dst.storageTextureMaxNum, src.storageTextureMaxNum);
+    dst.bufferMaxNum = std::max(dst.bufferMaxNum, src.bufferMaxNum);
+    dst.storageBufferMaxNum = std::max(dst.storageBufferMaxNum, src.storageBufferMaxNum);
+    dst.structuredBufferMaxNum = std::max(dst.structuredBufferMaxNum, src.structuredBufferMaxNum);
+    dst.storageStructuredBufferMaxNum = std::max(dst.storageStructuredBufferMaxNum, src.storageStructuredBufferMaxNum);
+    dst.accelerationStructureMaxNum = std::max(dst.accelerationStructureMaxNum, src.accelerationStructureMaxNum);
+    dst.mutableMaxNum = std::max(dst.mutableMaxNum, src.mutableMaxNum);
+    dst.dynamicConstantBufferMaxNum = std::max(dst.dynamicConstantBufferMaxNum, src.dynamicConstantBufferMaxNum);
+    dst.dynamicStructuredBufferMaxNum = std::max(dst.dynamicStructuredBufferMaxNum, src.dynamicStructuredBufferMaxNum);
+    dst.flags |= src.flags;
+}
+
 Result DescriptorPoolVK::Create(const DescriptorPoolDesc& descriptorPoolDesc) {
-    std::array<VkDescriptorPoolSize, 16> poolSizes = {};
-    uint32_t poolSizeNum = 0;
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        return CreateDescriptorBuffer(descriptorPoolDesc);
 
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_SAMPLER, descriptorPoolDesc.samplerMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_SAMPLER, descriptorPoolDesc.samplerMaxNum);
 
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptorPoolDesc.constantBufferMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, descriptorPoolDesc.textureMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, descriptorPoolDesc.storageTextureMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, descriptorPoolDesc.bufferMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, descriptorPoolDesc.storageBufferMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptorPoolDesc.structuredBufferMaxNum + descriptorPoolDesc.storageStructuredBufferMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, descriptorPoolDesc.accelerationStructureMaxNum);
-    AddDescriptorPoolSize(poolSizes, poolSizeNum, VK_DESCRIPTOR_TYPE_MUTABLE_EXT, descriptorPoolDesc.mutableMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptorPoolDesc.constantBufferMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, descriptorPoolDesc.textureMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, descriptorPoolDesc.storageTextureMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, descriptorPoolDesc.bufferMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, descriptorPoolDesc.storageBufferMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptorPoolDesc.structuredBufferMaxNum + descriptorPoolDesc.storageStructuredBufferMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, descriptorPoolDesc.accelerationStructureMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_MUTABLE_EXT, descriptorPoolDesc.mutableMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, descriptorPoolDesc.dynamicConstantBufferMaxNum);
+    AddDescriptorPoolSize(m_PoolSizes, m_PoolSizeNum, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, descriptorPoolDesc.dynamicStructuredBufferMaxNum);
+
+    m_PoolFlags = (descriptorPoolDesc.flags & DescriptorPoolBits::ALLOW_UPDATE_AFTER_SET) ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT : 0;
+    m_DescriptorSetMaxNum = descriptorPoolDesc.descriptorSetMaxNum;
+    m_IsGrowable = descriptorPoolDesc.flags & DescriptorPoolBits::GROWABLE;
+
+    return ChainPool(nullptr, 0, 0);
+}
+
+Result DescriptorPoolVK::ChainPool(const DescriptorSetDesc* descriptorSetDesc, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    // Geometric growth: each chained pool is twice bigger than the previous one
+    uint32_t scale = 1u << std::min((uint32_t)m_Pools.size(), 16u);
+
+    std::array<VkDescriptorPoolSize, 16> poolSizes = m_PoolSizes;
+    uint32_t poolSizeNum = m_PoolSizeNum;
+    for (uint32_t i = 0; i < poolSizeNum; i++)
+        poolSizes[i].descriptorCount = MulSaturated(poolSizes[i].descriptorCount, scale);
+
+    // The new pool must fit the failed request, which may need types or counts the pool has not been created with
+    if (descriptorSetDesc) {
+        std::array<VkDescriptorPoolSize, 16> requestSizes = {};
+        uint32_t requestSizeNum = 0;
+
+        for (uint32_t i = 0; i < descriptorSetDesc->rangeNum; i++) {
+            const DescriptorRangeDesc& rangeDesc = descriptorSetDesc->ranges[i];
+            uint32_t descriptorNum = (rangeDesc.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY) ? variableDescriptorNum : rangeDesc.descriptorNum;
+            VkDescriptorType type = (rangeDesc.flags & DescriptorRangeBits::MUTABLE) ? VK_DESCRIPTOR_TYPE_MUTABLE_EXT : GetDescriptorType(rangeDesc);
+
+            MergeDescriptorPoolSize(requestSizes, requestSizeNum, type, MulSaturated(descriptorNum, instanceNum), true);
+        }
+
+        for (uint32_t i = 0; i < requestSizeNum; i++)
+            MergeDescriptorPoolSize(poolSizes, poolSizeNum, requestSizes[i].type, requestSizes[i].descriptorCount, false);
+    }
+
+    uint32_t descriptorSetMaxNum = std::max(MulSaturated(m_DescriptorSetMaxNum, scale), instanceNum);
 
     VkDescriptorPoolCreateInfo info = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
-    info.flags = (descriptorPoolDesc.flags & DescriptorPoolBits::ALLOW_UPDATE_AFTER_SET) ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT : 0;
-    info.maxSets = descriptorPoolDesc.descriptorSetMaxNum;
+    info.flags = m_PoolFlags;
+    info.maxSets = descriptorSetMaxNum;
     info.poolSizeCount = poolSizeNum;
     info.pPoolSizes = poolSizes.data();
 
+    VkDescriptorPool handle = VK_NULL_HANDLE;
+
     const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateDescriptorPool(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    VkResult vkResult = vk.CreateDescriptorPool(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateDescriptorPool");
 
-    m_DescriptorSets.resize(descriptorPoolDesc.descriptorSetMaxNum);
+    // Moving "Vector" keeps its storage, so previously returned descriptor sets stay valid
+    m_Pools.push_back({handle, Vector<DescriptorSetVK>(descriptorSetMaxNum, m_Device.GetStdAllocator()), 0});
+
+    return Result::SUCCESS;
+}
+
+Result DescriptorPoolVK::CreateDescriptorBuffer(const DescriptorPoolDesc& descriptorPoolDesc) {
+    const DescriptorBufferDesc& descriptorBufferDesc = m_Device.GetDescriptorBufferDesc();
+    const auto& sizes = descriptorBufferDesc.descriptorSizes;
+
+    // Descriptors are tightly packed, but each set may need alignment padding
+    uint64_t size = (uint64_t)descriptorPoolDesc.descriptorSetMaxNum * descriptorBufferDesc.offsetAlignment;
+    size += (uint64_t)descriptorPoolDesc.samplerMaxNum * sizes[(size_t)DescriptorType::SAMPLER];
+    size += (uint64_t)descriptorPoolDesc.constantBufferMaxNum * sizes[(size_t)DescriptorType::CONSTANT_BUFFER];
+    size += (uint64_t)descriptorPoolDesc.textureMaxNum * sizes[(size_t)DescriptorType::TEXTURE];
+    size += (uint64_t)descriptorPoolDesc.storageTextureMaxNum * sizes[(size_t)DescriptorType::STORAGE_TEXTURE];
+    size += (uint64_t)descriptorPoolDesc.bufferMaxNum * sizes[(size_t)DescriptorType::BUFFER];
+    size += (uint64_t)descriptorPoolDesc.storageBufferMaxNum * sizes[(size_t)DescriptorType::STORAGE_BUFFER];
+    size += (uint64_t)descriptorPoolDesc.structuredBufferMaxNum * sizes[(size_t)DescriptorType::STRUCTURED_BUFFER];
+    size += (uint64_t)descriptorPoolDesc.storageStructuredBufferMaxNum * sizes[(size_t)DescriptorType::STORAGE_STRUCTURED_BUFFER];
+    size += (uint64_t)descriptorPoolDesc.accelerationStructureMaxNum * sizes[(size_t)DescriptorType::ACCELERATION_STRUCTURE];
+    size += (uint64_t)descriptorPoolDesc.mutableMaxNum * descriptorBufferDesc.mutableDescriptorSize;
+
+    if (!size)
+        size = descriptorBufferDesc.offsetAlignment;
+
+    m_DescriptorBufferUsage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    if (descriptorPoolDesc.samplerMaxNum)
+        m_DescriptorBufferUsage |= VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+    if (!descriptorBufferDesc.bufferlessPushDescriptors)
+        m_DescriptorBufferUsage |= VK_BUFFER_USAGE_PUSH_DESCRIPTORS_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = size;
+
+    VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    VkBufferUsageFlags2CreateInfo usageInfo = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO};
+    m_Device.FillCreateInfo(bufferDesc, info, usageInfo);
+    info.usage = m_DescriptorBufferUsage;
+
+    // Prefer "device local & host visible" memory, descriptors are written by the CPU and read by the GPU
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    allocationCreateInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    VmaAllocationInfo allocationInfo = {};
+
+    VkResult vkResult = vmaCreateBuffer(m_Device.GetVma(), &info, &allocationCreateInfo, &m_DescriptorBuffer, &m_VmaAllocation, &allocationInfo);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vmaCreateBuffer");
+
+    VkBufferDeviceAddressInfo bufferDeviceAddressInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    bufferDeviceAddressInfo.buffer = m_DescriptorBuffer;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    m_DescriptorBufferAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+    m_DescriptorBufferData = (uint8_t*)allocationInfo.pMappedData;
+    m_DescriptorBufferSize = size;
+
+    m_Pools.push_back({VK_NULL_HANDLE, Vector<DescriptorSetVK>(descriptorPoolDesc.descriptorSetMaxNum, m_Device.GetStdAllocator()), 0});
 
     return Result::SUCCESS;
 }
 
 Result DescriptorPoolVK::Create(const DescriptorPoolVKDesc& descriptorPoolVKDesc) {
+    RETURN_ON_FAILURE(&m_Device, !m_Device.m_IsSupported.descriptorBuffer, Result::UNSUPPORTED, "Native descriptor pools can't be wrapped in \"descriptor buffer\" mode");
+
     m_OwnsNativeObjects = false;
-    m_Handle = (VkDescriptorPool)descriptorPoolVKDesc.vkDescriptorPool;
+    m_DescriptorSetMaxNum = descriptorPoolVKDesc.descriptorSetMaxNum;
+    m_Pools.push_back({(VkDescriptorPool)descriptorPoolVKDesc.vkDescriptorPool, Vector<DescriptorSetVK>(m_DescriptorSetMaxNum, m_Device.GetStdAllocator()), 0});
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE void DescriptorPoolVK::SetDebugName(const char* name) {
-    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)m_Handle, name);
+    if (m_DescriptorBuffer)
+        m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_DescriptorBuffer, name);
+    else {
+        for (const ChainedDescriptorPoolVK& pool : m_Pools)
+            m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)pool.handle, name);
+    }
 }
 
-NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+void DescriptorPoolVK::AccumulateUsage(const DescriptorSetDesc& descriptorSetDesc, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    m_Usage.descriptorSetMaxNum += instanceNum;
+
+    if (descriptorSetDesc.flags & DescriptorSetBits::ALLOW_UPDATE_AFTER_SET)
+        m_Usage.flags |= DescriptorPoolBits::ALLOW_UPDATE_AFTER_SET;
+
+    for (uint32_t i = 0; i < descriptorSetDesc.rangeNum; i++) {
+        const DescriptorRangeDesc& rangeDesc = descriptorSetDesc.ranges[i];
+
+        uint32_t descriptorNum = (rangeDesc.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY) ? variableDescriptorNum : rangeDesc.descriptorNum;
+        descriptorNum *= instanceNum;
+
+        if (rangeDesc.flags & DescriptorRangeBits::MUTABLE)
+            m_Usage.mutableMaxNum += descriptorNum;
+        else if (rangeDesc.flags & DescriptorRangeBits::DYNAMIC_OFFSET) {
+            if (rangeDesc.descriptorType == DescriptorType::CONSTANT_BUFFER)
+                m_Usage.dynamicConstantBufferMaxNum += descriptorNum;
+            else
+                m_Usage.dynamicStructuredBufferMaxNum += descriptorNum;
+        } else {
+            switch (rangeDesc.descriptorType) {
+                case DescriptorType::SAMPLER:
+                    m_Usage.samplerMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::CONSTANT_BUFFER:
+                    m_Usage.constantBufferMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::TEXTURE:
+                    m_Usage.textureMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::STORAGE_TEXTURE:
+                    m_Usage.storageTextureMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::BUFFER:
+                    m_Usage.bufferMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::STORAGE_BUFFER:
+                    m_Usage.storageBufferMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::STRUCTURED_BUFFER:
+                    m_Usage.structuredBufferMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+                    m_Usage.storageStructuredBufferMaxNum += descriptorNum;
+                    break;
+                case DescriptorType::ACCELERATION_STRUCTURE:
+                    m_Usage.accelerationStructureMaxNum += descriptorNum;
+                    break;
+                default:
+                    CHECK(false, "Unexpected");
+                    break;
+            }
+        }
+    }
+}
+
+Result DescriptorPoolVK::AllocateDescriptorBufferSets(const PipelineLayoutVK& pipelineLayoutVK, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    const DescriptorBufferDesc& descriptorBufferDesc = m_Device.GetDescriptorBufferDesc();
+    const DescriptorSetDesc* descriptorSetDesc = &pipelineLayoutVK.GetBindingInfo().sets[setIndex];
+    const uint64_t* bindingOffsets = pipelineLayoutVK.GetBindingOffsets(setIndex);
+
+    // The layout size assumes the max size of a variable sized array, which is the last binding
+    uint64_t setSize = pipelineLayoutVK.GetDescriptorSetSize(setIndex);
+    if (descriptorSetDesc->rangeNum) {
+        uint32_t lastRangeIndex = descriptorSetDesc->rangeNum - 1;
+        const DescriptorRangeDesc& lastRange = descriptorSetDesc->ranges[lastRangeIndex];
+
+        if (lastRange.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY) {
+            uint32_t descriptorSize = (lastRange.flags & DescriptorRangeBits::MUTABLE) ? descriptorBufferDesc.mutableDescriptorSize : descriptorBufferDesc.descriptorSizes[(size_t)lastRange.descriptorType];
+
+            uint32_t lastBindingIndex = 0;
+            for (uint32_t i = 0; i < lastRangeIndex; i++) {
+                const DescriptorRangeDesc& rangeDesc = descriptorSetDesc->ranges[i];
+                bool isArray = rangeDesc.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+
+                lastBindingIndex += isArray ? 1 : rangeDesc.descriptorNum;
+            }
+
+            setSize = bindingOffsets[lastBindingIndex] + (uint64_t)variableDescriptorNum * descriptorSize;
+        }
+    }
+
+    setSize = Align(setSize, descriptorBufferDesc.offsetAlignment);
+
     ExclusiveScope lock(m_Lock);
 
+    uint64_t offset = Align(m_DescriptorBufferOffset, descriptorBufferDesc.offsetAlignment);
+    RETURN_ON_FAILURE(&m_Device, offset + setSize * instanceNum <= m_DescriptorBufferSize, Result::OUT_OF_MEMORY, "Descriptor pool is out of memory");
+
+    ChainedDescriptorPoolVK& pool = m_Pools[0];
+    RETURN_ON_FAILURE(&m_Device, pool.descriptorSetNum + instanceNum <= pool.descriptorSets.size(), Result::OUT_OF_MEMORY, "Descriptor pool is out of descriptor sets");
+
+    for (uint32_t i = 0; i < instanceNum; i++) {
+        DescriptorSetVK* descriptorSet = &pool.descriptorSets[pool.descriptorSetNum++];
+        descriptorSet->Create(&m_Device, descriptorSetDesc, m_DescriptorBufferData + offset, offset, bindingOffsets);
+
+        descriptorSets[i] = (DescriptorSet*)descriptorSet;
+        offset += setSize;
+    }
+
+    m_DescriptorBufferOffset = offset;
+
+    AccumulateUsage(*descriptorSetDesc, instanceNum, variableDescriptorNum);
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     const PipelineLayoutVK& pipelineLayoutVK = (PipelineLayoutVK&)pipelineLayout;
+    if (m_DescriptorBuffer)
+        return AllocateDescriptorBufferSets(pipelineLayoutVK, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
+
     VkDescriptorSetLayout setLayout = pipelineLayoutVK.GetDescriptorSetLayout(setIndex);
+    VkDescriptorUpdateTemplate updateTemplate = pipelineLayoutVK.GetUpdateTemplate(setIndex);
 
     const auto& bindingInfo = pipelineLayoutVK.GetBindingInfo();
     const DescriptorSetDesc* descriptorSetDesc = &bindingInfo.sets[setIndex];
@@ -73,37 +334,104 @@ NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout&
         }
     }
 
+    // All instances are allocated by a single driver call
+    Scratch<VkDescriptorSetLayout> setLayouts = AllocateScratch(m_Device, VkDescriptorSetLayout, instanceNum);
+    Scratch<uint32_t> variableDescriptorNums = AllocateScratch(m_Device, uint32_t, instanceNum);
+    Scratch<VkDescriptorSet> handles = AllocateScratch(m_Device, VkDescriptorSet, instanceNum);
+
+    for (uint32_t i = 0; i < instanceNum; i++) {
+        setLayouts[i] = setLayout;
+        variableDescriptorNums[i] = variableDescriptorNum;
+    }
+
     VkDescriptorSetVariableDescriptorCountAllocateInfo variableDescriptorCountInfo = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO};
-    variableDescriptorCountInfo.descriptorSetCount = 1;
-    variableDescriptorCountInfo.pDescriptorCounts = &variableDescriptorNum;
+    variableDescriptorCountInfo.descriptorSetCount = instanceNum;
+    variableDescriptorCountInfo.pDescriptorCounts = variableDescriptorNums;
 
     VkDescriptorSetAllocateInfo info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
     info.pNext = hasVariableDescriptorNum ? &variableDescriptorCountInfo : nullptr;
-    info.descriptorPool = m_Handle;
-    info.descriptorSetCount = 1;
-    info.pSetLayouts = &setLayout;
+    info.descriptorSetCount = instanceNum;
+    info.pSetLayouts = setLayouts;
+
+    ExclusiveScope lock(m_Lock);
 
     const auto& vk = m_Device.GetDispatchTable();
-    for (uint32_t i = 0; i < instanceNum; i++) {
-        VkDescriptorSet handle = VK_NULL_HANDLE;
-        VkResult vkResult = vk.AllocateDescriptorSets(m_Device, &info, &handle);
-        RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateDescriptorSets");
+    VkResult vkResult = VK_ERROR_OUT_OF_POOL_MEMORY;
+    bool isChained = false;
+
+    for (;;) {
+        ChainedDescriptorPoolVK& pool = m_Pools[m_PoolIndex];
+        if (pool.descriptorSetNum + instanceNum <= pool.descriptorSets.size()) {
+            info.descriptorPool = pool.handle;
+            vkResult = vk.AllocateDescriptorSets(m_Device, &info, handles);
+        } else
+            vkResult = VK_ERROR_OUT_OF_POOL_MEMORY;
+
+        bool isExhausted = vkResult == VK_ERROR_OUT_OF_POOL_MEMORY || vkResult == VK_ERROR_FRAGMENTED_POOL;
+        if (!m_IsGrowable || !isExhausted)
+            break;
+
+        // Even a new pool, sized for the request, can't fit it. No more pools get chained
+        RETURN_ON_FAILURE(&m_Device, !isChained, Result::OUT_OF_MEMORY, "A new chained descriptor pool can't fit the request");
+
+        // Switch to the next chained pool (recycled after "Reset"), chaining a bigger one if there are no more
+        if (m_PoolIndex + 1 == m_Pools.size()) {
+            Result result = ChainPool(descriptorSetDesc, instanceNum, variableDescriptorNum);
+            if (result != Result::SUCCESS)
+                return result;
+
+            isChained = true;
+        }
+
+        m_PoolIndex++;
+    }
+
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateDescriptorSets");
 
-        DescriptorSetVK* descriptorSet = &m_DescriptorSets[m_DescriptorSetNum++];
-        descriptorSet->Create(&m_Device, handle, descriptorSetDesc);
+    ChainedDescriptorPoolVK& pool = m_Pools[m_PoolIndex];
+    for (uint32_t i = 0; i < instanceNum; i++) {
+        DescriptorSetVK* descriptorSet = &pool.descriptorSets[pool.descriptorSetNum++];
+        descriptorSet->Create(&m_Device, handles[i], descriptorSetDesc, updateTemplate);
 
         descriptorSets[i] = (DescriptorSet*)descriptorSet;
     }
 
+    AccumulateUsage(*descriptorSetDesc, instanceNum, variableDescriptorNum);
+
     return Result::SUCCESS;
 }
 
 NRI_INLINE void DescriptorPoolVK::Reset() {
     ExclusiveScope lock(m_Lock);
 
+    MaxDescriptorPoolUsage(m_PeakUsage, m_Usage);
+    m_Usage = {};
+
+    if (m_DescriptorBuffer) {
+        m_DescriptorBufferOffset = 0;
+        m_Pools[0].descriptorSetNum = 0;
+
+        return;
+    }
+
+    // All chained pools get recycled
     const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.ResetDescriptorPool(m_Device, m_Handle, (VkDescriptorPoolResetFlags)0);
-    RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkResetDescriptorPool");
+    for (ChainedDescriptorPoolVK& pool : m_Pools) {
+        VkResult vkResult = vk.ResetDescriptorPool(m_Device, pool.handle, (VkDescriptorPoolResetFlags)0);
+        RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkResetDescriptorPool");
+
+        pool.descriptorSetNum = 0;
+    }
+
+    m_PoolIndex = 0;
+}
+
+NRI_INLINE void DescriptorPoolVK::GetStats(DescriptorPoolStats& descriptorPoolStats) {
+    ExclusiveScope lock(m_Lock);
+
+    descriptorPoolStats = {};
+    descriptorPoolStats.peakUsage = m_PeakUsage;
+    descriptorPoolStats.chainedPoolNum = (uint32_t)m_Pools.size();
 
-    m_DescriptorSetNum = 0;
+    MaxDescriptorPoolUsage(descriptorPoolStats.peakUsage, m_Usage);
 }
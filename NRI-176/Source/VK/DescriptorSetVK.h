@@ -20,22 +20,50 @@ struct DescriptorSetVK final : public DebugNameBase {
         return m_Desc;
     }
 
-    inline void Create(DeviceVK* device, VkDescriptorSet handle, const DescriptorSetDesc* desc) {
+    inline uint64_t GetDescriptorBufferOffset() const {
+        return m_DescriptorBufferOffset;
+    }
+
+    inline void Create(DeviceVK* device, VkDescriptorSet handle, const DescriptorSetDesc* desc, VkDescriptorUpdateTemplate updateTemplate) {
         m_Device = device;
         m_Handle = handle;
         m_Desc = desc;
+        m_UpdateTemplate = updateTemplate;
+    }
+
+    inline void Create(DeviceVK* device, const DescriptorSetDesc* desc, uint8_t* descriptorData, uint64_t descriptorBufferOffset, const uint64_t* bindingOffsets) {
+        m_Device = device;
+        m_Handle = VK_NULL_HANDLE;
+        m_Desc = desc;
+        m_UpdateTemplate = VK_NULL_HANDLE;
+        m_DescriptorData = descriptorData;
+        m_DescriptorBufferOffset = descriptorBufferOffset;
+        m_BindingOffsets = bindingOffsets;
     }
 
+    uint8_t* GetDescriptorData(uint32_t rangeIndex, uint32_t descriptorIndex) const;
+    uint32_t GetDescriptorSize(uint32_t rangeIndex) const;
+
     //================================================================================================================
     // DebugNameBase
     //================================================================================================================
 
     void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    void UpdateDescriptorSet(const Descriptor* const* descriptors);
+
 private:
     DeviceVK* m_Device = nullptr;
     VkDescriptorSet m_Handle = VK_NULL_HANDLE;
     const DescriptorSetDesc* m_Desc = nullptr;
+    VkDescriptorUpdateTemplate m_UpdateTemplate = VK_NULL_HANDLE; // owned by the pipeline layout
+    uint8_t* m_DescriptorData = nullptr; // "descriptor buffer" mode only, mapped memory of the descriptor pool
+    uint64_t m_DescriptorBufferOffset = 0;
+    const uint64_t* m_BindingOffsets = nullptr; // owned by the pipeline layout
 };
 
 } // namespace nri
\ No newline at end of file
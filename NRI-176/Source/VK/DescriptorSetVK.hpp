@@ -1,5 +1,126 @@
 // © 2021 NVIDIA Corporation
 
 NRI_INLINE void DescriptorSetVK::SetDebugName(const char* name) {
-    m_Device->SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_SET, (uint64_t)m_Handle, name);
+    if (m_Handle)
+        m_Device->SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_SET, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE uint32_t DescriptorSetVK::GetDescriptorSize(uint32_t rangeIndex) const {
+    const DescriptorBufferDesc& descriptorBufferDesc = m_Device->GetDescriptorBufferDesc();
+    const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[rangeIndex];
+
+    if (rangeDesc.flags & DescriptorRangeBits::MUTABLE)
+        return descriptorBufferDesc.mutableDescriptorSize;
+
+    return descriptorBufferDesc.descriptorSizes[(size_t)rangeDesc.descriptorType];
+}
+
+NRI_INLINE uint8_t* DescriptorSetVK::GetDescriptorData(uint32_t rangeIndex, uint32_t descriptorIndex) const {
+    // An array range occupies one binding, a non-array range occupies "descriptorNum" bindings
+    uint32_t bindingIndex = 0;
+    for (uint32_t i = 0; i < rangeIndex; i++) {
+        const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[i];
+        bool isArray = rangeDesc.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+
+        bindingIndex += isArray ? 1 : rangeDesc.descriptorNum;
+    }
+
+    const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[rangeIndex];
+    bool isArray = rangeDesc.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+
+    uint64_t offset = 0;
+    if (isArray)
+        offset = m_BindingOffsets[bindingIndex] + descriptorIndex * GetDescriptorSize(rangeIndex);
+    else
+        offset = m_BindingOffsets[bindingIndex + descriptorIndex];
+
+    return m_DescriptorData + offset;
+}
+
+NRI_INLINE void DescriptorSetVK::UpdateDescriptorSet(const Descriptor* const* descriptors) {
+    // Descriptor buffer: just CPU writes into mapped memory
+    if (m_DescriptorData) {
+        uint32_t n = 0;
+
+        for (uint32_t i = 0; i < m_Desc->rangeNum; i++) {
+            const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[i];
+            bool isMutable = rangeDesc.flags & DescriptorRangeBits::MUTABLE;
+
+            for (uint32_t j = 0; j < rangeDesc.descriptorNum; j++, n++) {
+                const DescriptorVK& descriptorVK = *(DescriptorVK*)descriptors[n];
+                descriptorVK.GetDescriptorData(isMutable ? descriptorVK.GetDescriptorType() : rangeDesc.descriptorType, GetDescriptorData(i, j));
+            }
+        }
+
+        return;
+    }
+
+    // No template (i.e. "MUTABLE" ranges): a write per range
+    if (!m_UpdateTemplate) {
+        Scratch<UpdateDescriptorRangeDesc> rangeUpdateDescs = AllocateScratch(*m_Device, UpdateDescriptorRangeDesc, m_Desc->rangeNum);
+        uint32_t n = 0;
+
+        for (uint32_t i = 0; i < m_Desc->rangeNum; i++) {
+            const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[i];
+            CHECK(!(rangeDesc.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY), "Unexpected");
+
+            UpdateDescriptorRangeDesc& rangeUpdateDesc = rangeUpdateDescs[i];
+            rangeUpdateDesc.descriptorSet = (DescriptorSet*)this;
+            rangeUpdateDesc.rangeIndex = i;
+            rangeUpdateDesc.baseDescriptor = 0;
+            rangeUpdateDesc.descriptors = descriptors + n;
+            rangeUpdateDesc.descriptorNum = rangeDesc.descriptorNum;
+
+            n += rangeDesc.descriptorNum;
+        }
+
+        m_Device->UpdateDescriptorRanges(rangeUpdateDescs, m_Desc->rangeNum);
+
+        return;
+    }
+
+    uint32_t descriptorNum = 0;
+    for (uint32_t i = 0; i < m_Desc->rangeNum; i++)
+        descriptorNum += m_Desc->ranges[i].descriptorNum;
+
+    // Pack descriptors in the order expected by the template
+    Scratch<DescriptorUpdateData> data = AllocateScratch(*m_Device, DescriptorUpdateData, descriptorNum);
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < m_Desc->rangeNum; i++) {
+        const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[i];
+
+        for (uint32_t j = 0; j < rangeDesc.descriptorNum; j++, n++) {
+            const DescriptorVK& descriptorVK = *(DescriptorVK*)descriptors[n];
+            DescriptorUpdateData& entry = data[n];
+
+            switch (rangeDesc.descriptorType) {
+                case DescriptorType::SAMPLER:
+                    entry.image = {descriptorVK.GetSampler(), VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED};
+                    break;
+                case DescriptorType::TEXTURE:
+                case DescriptorType::STORAGE_TEXTURE:
+                    entry.image = {VK_NULL_HANDLE, descriptorVK.GetImageView(), descriptorVK.GetTexDesc().layout};
+                    break;
+                case DescriptorType::CONSTANT_BUFFER:
+                case DescriptorType::STRUCTURED_BUFFER:
+                case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+                    entry.buffer = descriptorVK.GetBufferInfo();
+                    break;
+                case DescriptorType::BUFFER:
+                case DescriptorType::STORAGE_BUFFER:
+                    entry.bufferView = descriptorVK.GetBufferView();
+                    break;
+                case DescriptorType::ACCELERATION_STRUCTURE:
+                    entry.accelerationStructure = descriptorVK.GetAccelerationStructure();
+                    break;
+                default:
+                    CHECK(false, "Unexpected");
+                    break;
+            }
+        }
+    }
+
+    const auto& vk = m_Device->GetDispatchTable();
+    vk.UpdateDescriptorSetWithTemplate(*m_Device, m_Handle, m_UpdateTemplate, data);
 }
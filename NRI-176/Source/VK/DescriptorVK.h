@@ -18,6 +18,8 @@ struct DescriptorBufDesc {
     VkBuffer handle;
     uint64_t offset;
     uint64_t size;
+    VkDeviceAddress deviceAddress; // "descriptor buffer" mode only, also used by acceleration structures
+    VkFormat format;
     BufferViewType viewType;
 };
 
@@ -26,6 +28,7 @@ struct DescriptorTexDesc {
     const TextureVK* texture;
     VkImageLayout layout;
     VkImageAspectFlags aspectFlags;
+    VkFormat format;
     Dim_t layerOffset;
     Dim_t layerNum;
     Dim_t sliceOffset;
@@ -75,6 +78,26 @@ struct DescriptorVK final : public DebugNameBase {
         return m_Type;
     }
 
+    // The descriptor type this object is written as into "MUTABLE" ranges
+    inline DescriptorType GetDescriptorType() const {
+        switch (m_Type) {
+            case DescriptorTypeVK::IMAGE_VIEW:
+                return m_TextureDesc.layout == VK_IMAGE_LAYOUT_GENERAL ? DescriptorType::STORAGE_TEXTURE : DescriptorType::TEXTURE;
+            case DescriptorTypeVK::BUFFER_VIEW:
+                if (m_BufferDesc.viewType == BufferViewType::CONSTANT)
+                    return DescriptorType::CONSTANT_BUFFER;
+                if (m_BufferDesc.viewType == BufferViewType::SHADER_RESOURCE_STORAGE)
+                    return m_BufferDesc.format == VK_FORMAT_UNDEFINED ? DescriptorType::STORAGE_STRUCTURED_BUFFER : DescriptorType::STORAGE_BUFFER;
+                return m_BufferDesc.format == VK_FORMAT_UNDEFINED ? DescriptorType::STRUCTURED_BUFFER : DescriptorType::BUFFER;
+            case DescriptorTypeVK::SAMPLER:
+                return DescriptorType::SAMPLER;
+            case DescriptorTypeVK::ACCELERATION_STRUCTURE:
+                return DescriptorType::ACCELERATION_STRUCTURE;
+            default:
+                return DescriptorType::MAX_NUM;
+        }
+    }
+
     inline const DescriptorTexDesc& GetTexDesc() const {
         return m_TextureDesc;
     }
@@ -118,7 +141,7 @@ struct DescriptorVK final : public DebugNameBase {
     Result Create(const Texture2DViewDesc& textureViewDesc);
     Result Create(const Texture3DViewDesc& textureViewDesc);
     Result Create(const SamplerDesc& samplerDesc);
-    Result Create(VkAccelerationStructureKHR accelerationStructure);
+    Result Create(VkAccelerationStructureKHR accelerationStructure, VkDeviceAddress deviceAddress);
 
     //================================================================================================================
     // DebugNameBase
@@ -126,10 +149,18 @@ struct DescriptorVK final : public DebugNameBase {
 
     void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    void GetDescriptorData(DescriptorType descriptorType, uint8_t* dst) const;
+
 private:
     template <typename T>
     Result CreateTextureView(const T& textureViewDesc);
 
+    Result CreateImageView(const TextureVK& texture, const VkImageViewCreateInfo& createInfo, const VkImageViewUsageCreateInfo& usageInfo, const VkImageViewSlicedCreateInfoEXT* slicesInfo);
+
 private:
     DeviceVK& m_Device;
 
@@ -145,6 +176,7 @@ private:
         DescriptorBufDesc m_BufferDesc;
     };
 
+    uint64_t m_CacheKey = 0; // in the device descriptor object cache, 0 if the native object is not cached
     DescriptorTypeVK m_Type = DescriptorTypeVK::NONE;
 };
 
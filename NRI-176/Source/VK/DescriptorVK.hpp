@@ -41,6 +41,11 @@ constexpr VkImageViewType GetImageViewType(Texture3DViewType, uint32_t) {
 }
 
 DescriptorVK::~DescriptorVK() {
+    if (m_CacheKey) {
+        m_Device.ReleaseDescriptorObject(m_Type == DescriptorTypeVK::SAMPLER ? VK_OBJECT_TYPE_SAMPLER : VK_OBJECT_TYPE_IMAGE_VIEW, m_CacheKey);
+        return;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
 
     switch (m_Type) {
@@ -62,6 +67,37 @@ DescriptorVK::~DescriptorVK() {
     }
 }
 
+Result DescriptorVK::CreateImageView(const TextureVK& texture, const VkImageViewCreateInfo& createInfo, const VkImageViewUsageCreateInfo& usageInfo, const VkImageViewSlicedCreateInfoEXT* slicesInfo) {
+    // Image and buffer views share a cache, so the type goes first
+    Vector<uint8_t> desc(m_Device.GetStdAllocator());
+    AppendValue(desc, VK_OBJECT_TYPE_IMAGE_VIEW);
+    AppendValue(desc, texture.GetUniqueId()); // not the handle, which can be reused
+    AppendValue(desc, createInfo.viewType);
+    AppendValue(desc, createInfo.format);
+    AppendValue(desc, createInfo.subresourceRange.aspectMask);
+    AppendValue(desc, createInfo.subresourceRange.baseMipLevel);
+    AppendValue(desc, createInfo.subresourceRange.levelCount);
+    AppendValue(desc, createInfo.subresourceRange.baseArrayLayer);
+    AppendValue(desc, createInfo.subresourceRange.layerCount);
+    AppendValue(desc, usageInfo.usage);
+
+    if (slicesInfo) {
+        AppendValue(desc, slicesInfo->sliceOffset);
+        AppendValue(desc, slicesInfo->sliceCount);
+    }
+
+    uint64_t handle = 0;
+    uint64_t key = 0;
+    Result result = m_Device.GetDescriptorObject(desc, VK_OBJECT_TYPE_IMAGE_VIEW, &createInfo, handle, key);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_ImageView = (VkImageView)handle;
+    m_CacheKey = key;
+
+    return Result::SUCCESS;
+}
+
 template <typename T>
 Result DescriptorVK::CreateTextureView(const T& textureViewDesc) {
     const TextureVK& texture = *(const TextureVK*)textureViewDesc.texture;
@@ -87,15 +123,16 @@ Result DescriptorVK::CreateTextureView(const T& textureViewDesc) {
     createInfo.subresourceRange = subresource;
     createInfo.image = texture.GetHandle();
 
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateImageView(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_ImageView);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateImageView");
+    Result result = CreateImageView(texture, createInfo, usageInfo, nullptr);
+    if (result != Result::SUCCESS)
+        return result;
 
     m_Type = DescriptorTypeVK::IMAGE_VIEW;
     m_TextureDesc.handle = texture.GetHandle();
     m_TextureDesc.texture = &texture;
     m_TextureDesc.layout = GetImageLayoutForView(textureViewDesc.viewType);
     m_TextureDesc.aspectFlags = GetImageAspectFlags(textureViewDesc.format);
+    m_TextureDesc.format = createInfo.format;
     m_TextureDesc.layerOffset = textureViewDesc.layerOffset;
     m_TextureDesc.layerNum = (Dim_t)subresource.layerCount;
     m_TextureDesc.sliceOffset = 0;
@@ -138,15 +175,16 @@ Result DescriptorVK::CreateTextureView(const Texture3DViewDesc& textureViewDesc)
     createInfo.subresourceRange = subresource;
     createInfo.image = texture.GetHandle();
 
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateImageView(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_ImageView);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateImageView");
+    Result result = CreateImageView(texture, createInfo, usageInfo, usageInfo.pNext ? &slicesInfo : nullptr);
+    if (result != Result::SUCCESS)
+        return result;
 
     m_Type = DescriptorTypeVK::IMAGE_VIEW;
     m_TextureDesc.handle = texture.GetHandle();
     m_TextureDesc.texture = &texture;
     m_TextureDesc.layout = GetImageLayoutForView(textureViewDesc.viewType);
     m_TextureDesc.aspectFlags = GetImageAspectFlags(textureViewDesc.format);
+    m_TextureDesc.format = createInfo.format;
     m_TextureDesc.layerOffset = 0;
     m_TextureDesc.layerNum = 1;
     m_TextureDesc.sliceOffset = textureViewDesc.sliceOffset;
@@ -165,6 +203,8 @@ Result DescriptorVK::Create(const BufferViewDesc& bufferViewDesc) {
     m_BufferDesc.offset = bufferViewDesc.offset;
     m_BufferDesc.size = (bufferViewDesc.size == WHOLE_SIZE) ? bufferDesc.size : bufferViewDesc.size;
     m_BufferDesc.handle = buffer.GetHandle();
+    m_BufferDesc.deviceAddress = buffer.GetDeviceAddress() + bufferViewDesc.offset;
+    m_BufferDesc.format = GetVkFormat(bufferViewDesc.format);
     m_BufferDesc.viewType = bufferViewDesc.viewType;
 
     if (bufferViewDesc.format == Format::UNKNOWN)
@@ -177,9 +217,21 @@ Result DescriptorVK::Create(const BufferViewDesc& bufferViewDesc) {
     createInfo.offset = bufferViewDesc.offset;
     createInfo.range = m_BufferDesc.size;
 
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateBufferView(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_BufferView);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateBufferView");
+    Vector<uint8_t> desc(m_Device.GetStdAllocator());
+    AppendValue(desc, VK_OBJECT_TYPE_BUFFER_VIEW);
+    AppendValue(desc, buffer.GetUniqueId()); // not the handle, which can be reused
+    AppendValue(desc, createInfo.format);
+    AppendValue(desc, createInfo.offset);
+    AppendValue(desc, createInfo.range);
+
+    uint64_t handle = 0;
+    uint64_t key = 0;
+    Result result = m_Device.GetDescriptorObject(desc, VK_OBJECT_TYPE_BUFFER_VIEW, &createInfo, handle, key);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_BufferView = (VkBufferView)handle;
+    m_CacheKey = key;
 
     return Result::SUCCESS;
 }
@@ -190,17 +242,25 @@ Result DescriptorVK::Create(const SamplerDesc& samplerDesc) {
     VkSamplerCustomBorderColorCreateInfoEXT borderColorInfo = {VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT};
     m_Device.FillCreateInfo(samplerDesc, info, reductionModeInfo, borderColorInfo);
 
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateSampler(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Sampler);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateSampler");
+    Vector<uint8_t> desc(m_Device.GetStdAllocator());
+    SerializeSamplerDesc(desc, samplerDesc);
 
+    uint64_t handle = 0;
+    uint64_t key = 0;
+    Result result = m_Device.GetDescriptorObject(desc, VK_OBJECT_TYPE_SAMPLER, &info, handle, key);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Sampler = (VkSampler)handle;
+    m_CacheKey = key;
     m_Type = DescriptorTypeVK::SAMPLER;
 
     return Result::SUCCESS;
 }
 
-Result DescriptorVK::Create(VkAccelerationStructureKHR accelerationStructure) {
+Result DescriptorVK::Create(VkAccelerationStructureKHR accelerationStructure, VkDeviceAddress deviceAddress) {
     m_AccelerationStructure = accelerationStructure;
+    m_BufferDesc.deviceAddress = deviceAddress;
     m_Type = DescriptorTypeVK::ACCELERATION_STRUCTURE;
 
     return Result::SUCCESS;
@@ -219,6 +279,10 @@ Result DescriptorVK::Create(const Texture3DViewDesc& textureViewDesc) {
 }
 
 NRI_INLINE void DescriptorVK::SetDebugName(const char* name) {
+    // Cached objects are shared between descriptors, so they are left unnamed (see "SetDebugName")
+    if (m_CacheKey)
+        return;
+
     switch (m_Type) {
         case DescriptorTypeVK::BUFFER_VIEW:
             m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_BUFFER_VIEW, (uint64_t)m_BufferView, name);
@@ -241,3 +305,57 @@ NRI_INLINE void DescriptorVK::SetDebugName(const char* name) {
             break;
     }
 }
+
+NRI_INLINE void DescriptorVK::GetDescriptorData(DescriptorType descriptorType, uint8_t* dst) const {
+    VkDescriptorImageInfo imageInfo = {};
+    VkDescriptorAddressInfoEXT addressInfo = {VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT};
+
+    VkDescriptorGetInfoEXT info = {VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT};
+    info.type = GetDescriptorType(descriptorType);
+
+    switch (descriptorType) {
+        case DescriptorType::SAMPLER:
+            info.data.pSampler = &m_Sampler;
+            break;
+        case DescriptorType::TEXTURE:
+        case DescriptorType::STORAGE_TEXTURE:
+            imageInfo.imageView = m_ImageView;
+            imageInfo.imageLayout = m_TextureDesc.layout;
+
+            if (descriptorType == DescriptorType::TEXTURE)
+                info.data.pSampledImage = &imageInfo;
+            else
+                info.data.pStorageImage = &imageInfo;
+            break;
+        case DescriptorType::CONSTANT_BUFFER:
+        case DescriptorType::BUFFER:
+        case DescriptorType::STORAGE_BUFFER:
+        case DescriptorType::STRUCTURED_BUFFER:
+        case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+            addressInfo.address = m_BufferDesc.deviceAddress;
+            addressInfo.range = m_BufferDesc.size;
+            addressInfo.format = m_BufferDesc.format;
+
+            if (descriptorType == DescriptorType::CONSTANT_BUFFER)
+                info.data.pUniformBuffer = &addressInfo;
+            else if (descriptorType == DescriptorType::BUFFER)
+                info.data.pUniformTexelBuffer = &addressInfo;
+            else if (descriptorType == DescriptorType::STORAGE_BUFFER)
+                info.data.pStorageTexelBuffer = &addressInfo;
+            else
+                info.data.pStorageBuffer = &addressInfo;
+            break;
+        case DescriptorType::ACCELERATION_STRUCTURE:
+            info.data.accelerationStructure = m_BufferDesc.deviceAddress;
+            break;
+        default:
+            CHECK(false, "Unexpected");
+            return;
+    }
+
+    const DescriptorBufferDesc& descriptorBufferDesc = m_Device.GetDescriptorBufferDesc();
+    size_t descriptorSize = descriptorBufferDesc.descriptorSizes[(size_t)descriptorType];
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetDescriptorEXT(m_Device, &info, descriptorSize, dst);
+}
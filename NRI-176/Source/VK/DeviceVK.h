@@ -4,28 +4,78 @@
 
 namespace nri {
 
+struct BufferVK;
 struct QueueVK;
+struct PipelineLayoutVK;
 
 struct IsSupported {
-    uint32_t deviceAddress          : 1;
-    uint32_t swapChainMutableFormat : 1;
-    uint32_t presentId              : 1;
-    uint32_t memoryPriority         : 1;
-    uint32_t memoryBudget           : 1;
-    uint32_t maintenance4           : 1;
-    uint32_t maintenance5           : 1;
-    uint32_t maintenance6           : 1;
-    uint32_t imageSlicedView        : 1;
-    uint32_t customBorderColor      : 1;
-    uint32_t robustness             : 1;
-    uint32_t robustness2            : 1;
-    uint32_t pipelineRobustness     : 1;
-    uint32_t swapChainMaintenance1  : 1;
-    uint32_t fifoLatestReady        : 1;
+    uint32_t deviceAddress            : 1;
+    uint32_t swapChainMutableFormat   : 1;
+    uint32_t presentId                : 1;
+    uint32_t memoryPriority           : 1;
+    uint32_t memoryBudget             : 1;
+    uint32_t maintenance4             : 1;
+    uint32_t maintenance5             : 1;
+    uint32_t maintenance6             : 1;
+    uint32_t imageSlicedView          : 1;
+    uint32_t customBorderColor        : 1;
+    uint32_t robustness               : 1;
+    uint32_t robustness2              : 1;
+    uint32_t pipelineRobustness       : 1;
+    uint32_t swapChainMaintenance1    : 1;
+    uint32_t fifoLatestReady          : 1;
+    uint32_t graphicsPipelineLibrary  : 1;
+    uint32_t shaderObject             : 1;
+    uint32_t pipelineCreationFeedback : 1;
+    uint32_t descriptorBuffer         : 1;
+    uint32_t multiDraw                : 1;
+    uint32_t deviceGeneratedCommands  : 1;
 };
 
 static_assert(sizeof(IsSupported) == sizeof(uint32_t), "4 bytes expected");
 
+struct DescriptorObject {
+    uint64_t handle; // "VkImageView", "VkBufferView" or "VkSampler"
+    VkObjectType type;
+};
+
+// A native object shared between NRI objects (ref-counted)
+template <typename T>
+struct CachedObject {
+    T object;
+    uint32_t refCount;
+    Vector<uint8_t> desc; // serialized creation parameters, compared on a hit, since hashes can collide
+};
+
+template <typename T>
+struct ObjectCache {
+    inline ObjectCache(StdAllocator<uint8_t>& allocator)
+        : objects(allocator) {
+    }
+
+    UnorderedMap<uint64_t, CachedObject<T>> objects; // lock
+    uint64_t hitNum = 0;                             // lock
+    Lock lock;
+};
+
+// There is no pipeline state in "shader object" mode, so all state enabled on the device must be set dynamically
+struct ShaderObjectDesc {
+    std::array<VkShaderStageFlagBits, 7> stages; // all enabled graphics stages, bound (or unbound) together
+    uint32_t stageNum;
+    bool alphaToOne;
+    bool depthClamp;
+    bool sampleLocations;
+    bool lineRasterization;
+};
+
+// Descriptor sets are sub-allocations of descriptor pool buffers in "descriptor buffer" mode
+struct DescriptorBufferDesc {
+    std::array<uint32_t, (size_t)DescriptorType::MAX_NUM> descriptorSizes;
+    uint32_t mutableDescriptorSize;
+    uint32_t offsetAlignment;
+    bool bufferlessPushDescriptors;
+};
+
 struct DeviceVK final : public DeviceBase {
     inline operator VkDevice() const {
         return m_Device;
@@ -59,6 +109,27 @@ struct DeviceVK final : public DeviceBase {
         return (m_MemoryProps.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
     }
 
+    inline const ShaderObjectDesc& GetShaderObjectDesc() const {
+        return m_ShaderObjectDesc;
+    }
+
+    inline const DescriptorBufferDesc& GetDescriptorBufferDesc() const {
+        return m_DescriptorBufferDesc;
+    }
+
+    inline uint32_t GetMultiDrawMaxNum() const {
+        return m_MultiDrawMaxNum;
+    }
+
+    inline VkShaderStageFlags GetIndirectCommandsShaderStages() const {
+        return m_IndirectCommandsShaderStages;
+    }
+
+    // Unlike handles, never reused during the device lifetime
+    inline uint64_t GenerateUniqueId() {
+        return m_UniqueIdCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     inline bool IsMemoryZeroInitializationEnabled() const {
         return m_IsMemoryZeroInitializationEnabled;
     }
@@ -81,11 +152,14 @@ struct DeviceVK final : public DeviceBase {
         return result;
     }
 
+    template <typename PipelineDesc>
+    Result CreatePipeline(Pipeline*& pipeline, const PipelineDesc& pipelineDesc);
+
     DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks);
     ~DeviceVK();
 
     Result Create(const DeviceCreationDesc& desc, const DeviceCreationVKDesc& descVK);
-    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const;
+    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfo& usageInfo) const;
     void FillCreateInfo(const TextureDesc& bufferDesc, VkImageCreateInfo& info) const;
     void FillCreateInfo(const SamplerDesc& samplerDesc, VkSamplerCreateInfo& info, VkSamplerReductionModeCreateInfo& reductionModeInfo, VkSamplerCustomBorderColorCreateInfoEXT& borderColorInfo) const;
     void GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
@@ -97,6 +171,20 @@ struct DeviceVK final : public DeviceBase {
     void GetAccelerationStructureBuildSizesInfo(const AccelerationStructureDesc& accelerationStructureDesc, VkAccelerationStructureBuildSizesInfoKHR& sizesInfo);
     void GetMicromapBuildSizesInfo(const MicromapDesc& micromapDesc, VkMicromapBuildSizesInfoEXT& sizesInfo);
     void SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t handle, const char* name);
+    Result GetShaderModule(const VkShaderModuleCreateInfo& moduleInfo, VkShaderModule& module, uint64_t& key);
+    void ReleaseShaderModule(uint64_t key);
+    Result GetPipelineLibrary(Vector<uint8_t>& desc, const VkGraphicsPipelineCreateInfo& info, VkPipeline& library, uint64_t& key);
+    void ReleasePipelineLibrary(uint64_t key);
+    Result GetShaderObject(Vector<uint8_t>& desc, const VkShaderCreateInfoEXT& info, VkShaderEXT& shader, uint64_t& key);
+    void ReleaseShaderObject(uint64_t key);
+    Result GetPipelineLayout(const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout);
+    void ReleasePipelineLayout(PipelineLayoutVK& pipelineLayout);
+    Result GetDescriptorObject(Vector<uint8_t>& desc, VkObjectType type, const void* createInfo, uint64_t& handle, uint64_t& key);
+    void ReleaseDescriptorObject(VkObjectType type, uint64_t key);
+    void RecordPipelineStats(const PipelineStats& pipelineStats);
+    void RegisterBufferDeviceAddress(const BufferVK& buffer);
+    void UnregisterBufferDeviceAddress(const BufferVK& buffer);
+    const BufferVK* FindBufferByDeviceAddress(VkDeviceAddress deviceAddress, uint64_t& offset);
 
     //================================================================================================================
     // DebugNameBase
@@ -114,7 +202,10 @@ struct DeviceVK final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(BindlessHeapInterface& table) const override;
+    Result FillFunctionTable(DescriptorAllocatorInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
@@ -141,9 +232,12 @@ struct DeviceVK final : public DeviceBase {
     Result BindAccelerationStructureMemory(const BindAccelerationStructureMemoryDesc* bindAccelerationStructureMemoryDescs, uint32_t bindAccelerationStructureMemoryDescNum);
     Result BindMicromapMemory(const BindMicromapMemoryDesc* bindMicromapMemoryDescs, uint32_t bindMicromapMemoryDescNum);
     FormatSupportBits GetFormatSupport(Format format) const;
+    void GetPipelineCreationStats(PipelineCreationStats& pipelineCreationStats);
+    void GetDescriptorCacheStats(DescriptorCacheStats& descriptorCacheStats);
 
 private:
     VkResult CreateVma();
+    void DestroyDescriptorObject(uint64_t handle, VkObjectType type);
     void FilterInstanceLayers(Vector<const char*>& layers);
     void ProcessInstanceExtensions(Vector<const char*>& desiredInstanceExts);
     void ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing);
@@ -163,12 +257,22 @@ private:
     VkPhysicalDevice m_PhysicalDevice = nullptr;
     std::array<uint32_t, (size_t)QueueType::MAX_NUM> m_ActiveQueueFamilyIndices = {};
     std::array<Vector<QueueVK*>, (size_t)QueueType::MAX_NUM> m_QueueFamilies;
+    ObjectCache<VkShaderModule> m_ShaderModules; // one reference per pipeline using a module
+    ObjectCache<VkPipeline> m_PipelineLibraries; // one reference per pipeline linked from a library
+    ObjectCache<VkShaderEXT> m_ShaderObjects;    // one reference per pipeline using a shader
+    ObjectCache<PipelineLayoutVK*> m_PipelineLayouts;
+    ObjectCache<DescriptorObject> m_Views; // image and buffer views
+    ObjectCache<DescriptorObject> m_Samplers;
+    Map<VkDeviceAddress, const BufferVK*> m_BufferDeviceAddresses; // m_BufferDeviceAddressLock
     DispatchTable m_VK = {};
     VkPhysicalDeviceMemoryProperties m_MemoryProps = {};
     VkAllocationCallbacks m_AllocationCallbacks = {};
     VKBindingOffsets m_BindingOffsets = {};
     CoreInterface m_iCore = {};
     DeviceDesc m_Desc = {};
+    ShaderObjectDesc m_ShaderObjectDesc = {};
+    DescriptorBufferDesc m_DescriptorBufferDesc = {};
+    PipelineCreationStats m_PipelineCreationStats = {}; // m_PipelineCreationStatsLock
     Library* m_Loader = nullptr;
     VkDevice m_Device = VK_NULL_HANDLE;
     VkInstance m_Instance = VK_NULL_HANDLE;
@@ -177,10 +281,15 @@ private:
     VmaAllocator_T* m_Vma = nullptr;
     uint32_t m_NumActiveFamilyIndices = 0;
     uint32_t m_MinorVersion = 0;
+    uint32_t m_MultiDrawMaxNum = 0; // "VK_EXT_multi_draw" only
+    VkShaderStageFlags m_IndirectCommandsShaderStages = 0; // "VK_EXT_device_generated_commands" only
+    std::atomic_uint64_t m_UniqueIdCounter{0};
     bool m_OwnsNativeObjects = true;
     bool m_IsMemoryZeroInitializationEnabled = false;
 
     Lock m_Lock;
+    Lock m_PipelineCreationStatsLock;
+    Lock m_BufferDeviceAddressLock;
 };
 
 } // namespace nri
@@ -259,6 +259,7 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME); // TODO: there are 2 and 3 versions...
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+    APPEND_EXT(m_MinorVersion < 3, VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
 
     APPEND_EXT(m_MinorVersion < 4, VK_KHR_LINE_RASTERIZATION_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 4, VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
@@ -288,16 +289,22 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(true, VK_KHR_SWAPCHAIN_MUTABLE_FORMAT_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MESH_SHADER_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_MULTI_DRAW_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_PRESENT_MODE_FIFO_LATEST_READY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_ROBUSTNESS_2_EXTENSION_NAME); // TODO: use KHR
     APPEND_EXT(true, VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_ZERO_INITIALIZE_DEVICE_MEMORY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME);
@@ -312,7 +319,14 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
-      } {
+      }
+    , m_ShaderModules(GetStdAllocator())
+    , m_PipelineLibraries(GetStdAllocator())
+    , m_ShaderObjects(GetStdAllocator())
+    , m_PipelineLayouts(GetStdAllocator())
+    , m_Views(GetStdAllocator())
+    , m_Samplers(GetStdAllocator())
+    , m_BufferDeviceAddresses(GetStdAllocator()) {
     m_AllocationCallbacks.pUserData = (void*)&GetAllocationCallbacks();
     m_AllocationCallbacks.pfnAllocation = vkAllocateHostMemory;
     m_AllocationCallbacks.pfnReallocation = vkReallocateHostMemory;
@@ -331,6 +345,21 @@ DeviceVK::~DeviceVK() {
             Destroy<QueueVK>(queueFamily[i]);
     }
 
+    for (auto& it : m_ShaderModules.objects)
+        m_VK.DestroyShaderModule(m_Device, it.second.object, m_AllocationCallbackPtr);
+
+    for (auto& it : m_PipelineLibraries.objects)
+        m_VK.DestroyPipeline(m_Device, it.second.object, m_AllocationCallbackPtr);
+
+    for (auto& it : m_ShaderObjects.objects)
+        m_VK.DestroyShaderEXT(m_Device, it.second.object, m_AllocationCallbackPtr);
+
+    for (auto& it : m_Views.objects)
+        DestroyDescriptorObject(it.second.object.handle, it.second.object.type);
+
+    for (auto& it : m_Samplers.objects)
+        DestroyDescriptorObject(it.second.object.handle, it.second.object.type);
+
     if (m_Messenger) {
         typedef PFN_vkDestroyDebugUtilsMessengerEXT Func;
         Func destroyCallback = (Func)m_VK.GetInstanceProcAddr(m_Instance, "vkDestroyDebugUtilsMessengerEXT");
@@ -574,15 +603,21 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     APPEND_FEATURES(true, KHR, RayTracingPositionFetch, RAY_TRACING_POSITION_FETCH);
     APPEND_FEATURES(true, KHR, ShaderClock, SHADER_CLOCK);
     APPEND_FEATURES(true, EXT, CustomBorderColor, CUSTOM_BORDER_COLOR);
+    APPEND_FEATURES(desc.enableVKDescriptorBuffer, EXT, DescriptorBuffer, DESCRIPTOR_BUFFER);
+    APPEND_FEATURES(true, EXT, DeviceGeneratedCommands, DEVICE_GENERATED_COMMANDS);
+    APPEND_FEATURES(true, EXT, ExtendedDynamicState3, EXTENDED_DYNAMIC_STATE_3);
     APPEND_FEATURES(true, EXT, FragmentShaderInterlock, FRAGMENT_SHADER_INTERLOCK);
+    APPEND_FEATURES(desc.enableVKGraphicsPipelineLibrary, EXT, GraphicsPipelineLibrary, GRAPHICS_PIPELINE_LIBRARY);
     APPEND_FEATURES(true, EXT, ImageSlicedViewOf3D, IMAGE_SLICED_VIEW_OF_3D);
     APPEND_FEATURES(true, EXT, MemoryPriority, MEMORY_PRIORITY);
     APPEND_FEATURES(true, EXT, MeshShader, MESH_SHADER);
+    APPEND_FEATURES(true, EXT, MultiDraw, MULTI_DRAW);
     APPEND_FEATURES(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
     APPEND_FEATURES(true, EXT, PresentModeFifoLatestReady, PRESENT_MODE_FIFO_LATEST_READY);
     APPEND_FEATURES(true, EXT, Robustness2, ROBUSTNESS_2);
     APPEND_FEATURES(true, EXT, ShaderAtomicFloat, SHADER_ATOMIC_FLOAT);
     APPEND_FEATURES(true, EXT, ShaderAtomicFloat2, SHADER_ATOMIC_FLOAT_2);
+    APPEND_FEATURES(desc.enableVKShaderObject, EXT, ShaderObject, SHADER_OBJECT);
     APPEND_FEATURES(true, EXT, SwapchainMaintenance1, SWAPCHAIN_MAINTENANCE_1);
     APPEND_FEATURES(true, EXT, ZeroInitializeDeviceMemory, ZERO_INITIALIZE_DEVICE_MEMORY);
     APPEND_FEATURES(true, EXT, MutableDescriptorType, MUTABLE_DESCRIPTOR_TYPE);
@@ -630,6 +665,33 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.pipelineRobustness = features14.pipelineRobustness;
     m_IsSupported.swapChainMaintenance1 = SwapchainMaintenance1Features.swapchainMaintenance1;
     m_IsSupported.fifoLatestReady = PresentModeFifoLatestReadyFeatures.presentModeFifoLatestReady;
+    m_IsSupported.graphicsPipelineLibrary = GraphicsPipelineLibraryFeatures.graphicsPipelineLibrary;
+    m_IsSupported.shaderObject = ShaderObjectFeatures.shaderObject;
+    m_IsSupported.multiDraw = MultiDrawFeatures.multiDraw;
+    m_IsSupported.pipelineCreationFeedback = m_MinorVersion >= 3 || IsExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME, desiredDeviceExts);
+    m_IsSupported.descriptorBuffer = DescriptorBufferFeatures.descriptorBuffer && DescriptorBufferFeatures.descriptorBufferPushDescriptors && features12.bufferDeviceAddress; // root descriptors are push descriptors
+    m_IsSupported.deviceGeneratedCommands = DeviceGeneratedCommandsFeatures.deviceGeneratedCommands && features12.bufferDeviceAddress && features14.maintenance5 && !m_IsSupported.shaderObject; // shader objects need an "indirect execution set"
+
+    if (m_IsSupported.shaderObject) {
+        // Stages of enabled features must be explicitly bound, even if unused
+        m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_VERTEX_BIT;
+        if (features.features.tessellationShader) {
+            m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+            m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        }
+        if (features.features.geometryShader)
+            m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_GEOMETRY_BIT;
+        if (MeshShaderFeatures.taskShader)
+            m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_TASK_BIT_EXT;
+        if (MeshShaderFeatures.meshShader)
+            m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_MESH_BIT_EXT;
+        m_ShaderObjectDesc.stages[m_ShaderObjectDesc.stageNum++] = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        m_ShaderObjectDesc.alphaToOne = features.features.alphaToOne;
+        m_ShaderObjectDesc.depthClamp = features.features.depthClamp;
+        m_ShaderObjectDesc.sampleLocations = IsExtensionSupported(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME, desiredDeviceExts);
+        m_ShaderObjectDesc.lineRasterization = m_MinorVersion >= 4 || IsExtensionSupported(VK_KHR_LINE_RASTERIZATION_EXTENSION_NAME, desiredDeviceExts);
+    }
 
     m_IsMemoryZeroInitializationEnabled = desc.enableMemoryZeroInitialization && ZeroInitializeDeviceMemoryFeatures.zeroInitializeDeviceMemory;
 
@@ -776,7 +838,10 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         APPEND_PROPS(true, KHR, Maintenance9, MAINTENANCE_9);
         APPEND_PROPS(true, KHR, RayTracingPipeline, RAY_TRACING_PIPELINE);
         APPEND_PROPS(true, EXT, ConservativeRasterization, CONSERVATIVE_RASTERIZATION);
+        APPEND_PROPS(m_IsSupported.descriptorBuffer, EXT, DescriptorBuffer, DESCRIPTOR_BUFFER);
+        APPEND_PROPS(m_IsSupported.deviceGeneratedCommands, EXT, DeviceGeneratedCommands, DEVICE_GENERATED_COMMANDS);
         APPEND_PROPS(true, EXT, MeshShader, MESH_SHADER);
+        APPEND_PROPS(m_IsSupported.multiDraw, EXT, MultiDraw, MULTI_DRAW);
         APPEND_PROPS(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
         APPEND_PROPS(true, EXT, SampleLocations, SAMPLE_LOCATIONS);
 
@@ -792,6 +857,35 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
             props14.maxPushDescriptors = PushDescriptorProps.maxPushDescriptors;
         }
 
+        if (m_IsSupported.descriptorBuffer) {
+            // Buffer descriptors get bigger if "robustBufferAccess" is enabled
+            bool isRobust = features.features.robustBufferAccess != 0;
+
+            auto& sizes = m_DescriptorBufferDesc.descriptorSizes;
+            sizes[(size_t)DescriptorType::SAMPLER] = (uint32_t)DescriptorBufferProps.samplerDescriptorSize;
+            sizes[(size_t)DescriptorType::CONSTANT_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustUniformBufferDescriptorSize : DescriptorBufferProps.uniformBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::TEXTURE] = (uint32_t)DescriptorBufferProps.sampledImageDescriptorSize;
+            sizes[(size_t)DescriptorType::STORAGE_TEXTURE] = (uint32_t)DescriptorBufferProps.storageImageDescriptorSize;
+            sizes[(size_t)DescriptorType::BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustUniformTexelBufferDescriptorSize : DescriptorBufferProps.uniformTexelBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STORAGE_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustStorageTexelBufferDescriptorSize : DescriptorBufferProps.storageTexelBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STRUCTURED_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustStorageBufferDescriptorSize : DescriptorBufferProps.storageBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STORAGE_STRUCTURED_BUFFER] = sizes[(size_t)DescriptorType::STRUCTURED_BUFFER];
+            sizes[(size_t)DescriptorType::ACCELERATION_STRUCTURE] = (uint32_t)DescriptorBufferProps.accelerationStructureDescriptorSize;
+
+            // A mutable descriptor is as big as the biggest resource descriptor
+            for (size_t i = (size_t)DescriptorType::CONSTANT_BUFFER; i < sizes.size(); i++)
+                m_DescriptorBufferDesc.mutableDescriptorSize = std::max(m_DescriptorBufferDesc.mutableDescriptorSize, sizes[i]);
+
+            m_DescriptorBufferDesc.offsetAlignment = (uint32_t)DescriptorBufferProps.descriptorBufferOffsetAlignment;
+            m_DescriptorBufferDesc.bufferlessPushDescriptors = DescriptorBufferProps.bufferlessPushDescriptors;
+        }
+
+        if (m_IsSupported.multiDraw)
+            m_MultiDrawMaxNum = MultiDrawProps.maxMultiDrawCount;
+
+        if (m_IsSupported.deviceGeneratedCommands)
+            m_IndirectCommandsShaderStages = DeviceGeneratedCommandsProps.supportedIndirectCommandsShaderStages;
+
         // Fill desc
         const VkPhysicalDeviceLimits& limits = props.properties.limits;
 
@@ -844,7 +938,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
 
         m_Desc.pipelineLayout.descriptorSetMaxNum = limits.maxBoundDescriptorSets;
         m_Desc.pipelineLayout.rootConstantMaxSize = limits.maxPushConstantsSize;
-        m_Desc.pipelineLayout.rootDescriptorMaxNum = props14.maxPushDescriptors;
+        m_Desc.pipelineLayout.rootDescriptorMaxNum = std::min(props14.maxPushDescriptors, ROOT_DESCRIPTOR_MAX_NUM);
 
         m_Desc.descriptorSet.samplerMaxNum = limits.maxDescriptorSetSamplers;
         m_Desc.descriptorSet.constantBufferMaxNum = limits.maxDescriptorSetUniformBuffers;
@@ -1026,6 +1120,8 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.copyQueueTimestamp = limits.timestampComputeAndGraphics;
         m_Desc.features.meshShaderPipelineStats = MeshShaderFeatures.meshShaderQueries == VK_TRUE;
         m_Desc.features.dynamicDepthBias = true;
+        m_Desc.features.dynamicState = true;
+        m_Desc.features.dynamicBlendState = ExtendedDynamicState3Features.extendedDynamicState3ColorBlendEnable && ExtendedDynamicState3Features.extendedDynamicState3ColorBlendEquation && ExtendedDynamicState3Features.extendedDynamicState3ColorWriteMask;
         m_Desc.features.viewportOriginBottomLeft = true;
         m_Desc.features.regionResolve = true;
         m_Desc.features.layerBasedMultiview = features11.multiview;
@@ -1036,6 +1132,8 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.rootConstantsOffset = true;
         m_Desc.features.nonConstantBufferRootDescriptorOffset = true;
         m_Desc.features.mutableDescriptorType = MutableDescriptorTypeFeatures.mutableDescriptorType;
+        m_Desc.features.dynamicDescriptorOffset = !m_IsSupported.descriptorBuffer; // dynamic descriptors can't live in a descriptor buffer
+        m_Desc.features.secondaryCommandBuffer = true;
 
         m_Desc.shaderFeatures.nativeI16 = features.features.shaderInt16;
         m_Desc.shaderFeatures.nativeF16 = features12.shaderFloat16;
@@ -1094,13 +1192,20 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     return FillFunctionTable(m_iCore);
 }
 
-void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const {
+void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfo& usageInfo) const {
     info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO}; // should be already set
     info.size = bufferDesc.size;
     info.usage = GetBufferUsageFlags(bufferDesc.usage, bufferDesc.structureStride, m_IsSupported.deviceAddress);
     info.sharingMode = m_NumActiveFamilyIndices <= 1 ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
     info.queueFamilyIndexCount = m_NumActiveFamilyIndices;
     info.pQueueFamilyIndices = m_ActiveQueueFamilyIndices.data();
+
+    // There is no legacy "VkBufferUsageFlagBits" for preprocess buffers
+    usageInfo = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO}; // should be already set
+    if ((bufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER) && m_IsSupported.deviceGeneratedCommands) {
+        usageInfo.usage = info.usage | VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT;
+        info.pNext = &usageInfo;
+    }
 }
 
 void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo& info) const {
@@ -1187,7 +1292,8 @@ void DeviceVK::FillCreateInfo(const SamplerDesc& samplerDesc, VkSamplerCreateInf
 
 void DeviceVK::GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const {
     VkBufferCreateInfo createInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    FillCreateInfo(bufferDesc, createInfo);
+    VkBufferUsageFlags2CreateInfo usageInfo = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO};
+    FillCreateInfo(bufferDesc, createInfo, usageInfo);
 
     VkMemoryDedicatedRequirements dedicatedRequirements = {VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS};
 
@@ -1467,6 +1573,345 @@ void DeviceVK::SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t han
     RETURN_VOID_ON_BAD_VKRESULT(this, vkResult, "vkSetDebugUtilsObjectNameEXT");
 }
 
+// Returns the cached object created from "desc" (moved into the cache on a miss) or creates a new one. "key" identifies the object
+// in the cache, colliding descs go to the next keys (linear probing)
+template <typename T, typename CreateFunc, typename DestroyFunc>
+static Result GetCachedObject(ObjectCache<T>& cache, Vector<uint8_t>& desc, CreateFunc create, DestroyFunc destroy, T& object, uint64_t& key) {
+    const uint64_t hash = ComputeHash(desc.data(), desc.size());
+
+    auto find = [&]() -> CachedObject<T>* {
+        for (key = hash;; key++) {
+            auto it = cache.objects.find(key);
+            if (it == cache.objects.end())
+                return nullptr;
+
+            if (it->second.desc == desc)
+                return &it->second;
+        }
+    };
+
+    {
+        ExclusiveScope lock(cache.lock);
+
+        CachedObject<T>* cachedObject = find();
+        if (cachedObject) {
+            cachedObject->refCount++;
+            cache.hitNum++;
+            object = cachedObject->object;
+
+            return Result::SUCCESS;
+        }
+    }
+
+    // Create outside of the lock, the loser of a potential race destroys its copy
+    Result result = create(object);
+    if (result != Result::SUCCESS)
+        return result;
+
+    ExclusiveScope lock(cache.lock);
+
+    CachedObject<T>* cachedObject = find();
+    if (cachedObject) {
+        destroy(object);
+
+        cachedObject->refCount++;
+        cache.hitNum++;
+        object = cachedObject->object;
+    } else
+        cache.objects.emplace(key, CachedObject<T>{object, 1, std::move(desc)});
+
+    return Result::SUCCESS;
+}
+
+// Returns "true" if the last reference is released, i.e. the caller must destroy "object" (outside of the lock)
+template <typename T>
+static bool ReleaseCachedObject(ObjectCache<T>& cache, uint64_t key, T& object) {
+    ExclusiveScope lock(cache.lock);
+
+    auto it = cache.objects.find(key);
+    if (it == cache.objects.end() || --it->second.refCount)
+        return false;
+
+    object = it->second.object;
+    cache.objects.erase(it);
+
+    return true;
+}
+
+Result DeviceVK::GetShaderModule(const VkShaderModuleCreateInfo& moduleInfo, VkShaderModule& module, uint64_t& key) {
+    // Permutations tend to share stages, so each unique SPIR-V blob gets only one module
+    const uint8_t* code = (const uint8_t*)moduleInfo.pCode;
+    Vector<uint8_t> desc(code, code + moduleInfo.codeSize, GetStdAllocator());
+
+    auto create = [&](VkShaderModule& handle) {
+        VkResult vkResult = m_VK.CreateShaderModule(m_Device, &moduleInfo, m_AllocationCallbackPtr, &handle);
+        RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateShaderModule");
+
+        return Result::SUCCESS;
+    };
+
+    auto destroy = [&](VkShaderModule handle) {
+        m_VK.DestroyShaderModule(m_Device, handle, m_AllocationCallbackPtr);
+    };
+
+    return GetCachedObject(m_ShaderModules, desc, create, destroy, module, key);
+}
+
+void DeviceVK::ReleaseShaderModule(uint64_t key) {
+    VkShaderModule module = VK_NULL_HANDLE;
+    if (ReleaseCachedObject(m_ShaderModules, key, module))
+        m_VK.DestroyShaderModule(m_Device, module, m_AllocationCallbackPtr);
+}
+
+Result DeviceVK::GetPipelineLibrary(Vector<uint8_t>& desc, const VkGraphicsPipelineCreateInfo& info, VkPipeline& library, uint64_t& key) {
+    // Pipelines usually differ in a single part only, so the remaining parts are compiled once and reused
+    auto create = [&](VkPipeline& handle) {
+        VkResult vkResult = m_VK.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_AllocationCallbackPtr, &handle);
+        RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateGraphicsPipelines");
+
+        return Result::SUCCESS;
+    };
+
+    auto destroy = [&](VkPipeline handle) {
+        m_VK.DestroyPipeline(m_Device, handle, m_AllocationCallbackPtr);
+    };
+
+    return GetCachedObject(m_PipelineLibraries, desc, create, destroy, library, key);
+}
+
+void DeviceVK::ReleasePipelineLibrary(uint64_t key) {
+    // Linked pipelines don't need libraries, but "Optimize" links again, so a library lives as long as any pipeline created from it
+    VkPipeline library = VK_NULL_HANDLE;
+    if (ReleaseCachedObject(m_PipelineLibraries, key, library))
+        m_VK.DestroyPipeline(m_Device, library, m_AllocationCallbackPtr);
+}
+
+Result DeviceVK::GetShaderObject(Vector<uint8_t>& desc, const VkShaderCreateInfoEXT& info, VkShaderEXT& shader, uint64_t& key) {
+    // Pipelines usually share shaders, so each unique shader is compiled once and reused
+    auto create = [&](VkShaderEXT& handle) {
+        VkResult vkResult = m_VK.CreateShadersEXT(m_Device, 1, &info, m_AllocationCallbackPtr, &handle);
+        RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateShadersEXT");
+
+        return Result::SUCCESS;
+    };
+
+    auto destroy = [&](VkShaderEXT handle) {
+        m_VK.DestroyShaderEXT(m_Device, handle, m_AllocationCallbackPtr);
+    };
+
+    return GetCachedObject(m_ShaderObjects, desc, create, destroy, shader, key);
+}
+
+void DeviceVK::ReleaseShaderObject(uint64_t key) {
+    VkShaderEXT shader = VK_NULL_HANDLE;
+    if (ReleaseCachedObject(m_ShaderObjects, key, shader))
+        m_VK.DestroyShaderEXT(m_Device, shader, m_AllocationCallbackPtr);
+}
+
+static void SerializePipelineLayoutDesc(const PipelineLayoutDesc& pipelineLayoutDesc, Vector<uint8_t>& blob) {
+    // Field by field, since structs have padding
+    AppendValue(blob, pipelineLayoutDesc.rootRegisterSpace);
+    AppendValue(blob, pipelineLayoutDesc.shaderStages);
+    AppendValue(blob, pipelineLayoutDesc.flags);
+
+    AppendValue(blob, pipelineLayoutDesc.rootConstantNum);
+    for (uint32_t i = 0; i < pipelineLayoutDesc.rootConstantNum; i++) {
+        const RootConstantDesc& rootConstantDesc = pipelineLayoutDesc.rootConstants[i];
+        AppendValue(blob, rootConstantDesc.registerIndex);
+        AppendValue(blob, rootConstantDesc.size);
+        AppendValue(blob, rootConstantDesc.shaderStages);
+    }
+
+    AppendValue(blob, pipelineLayoutDesc.rootDescriptorNum);
+    for (uint32_t i = 0; i < pipelineLayoutDesc.rootDescriptorNum; i++) {
+        const RootDescriptorDesc& rootDescriptorDesc = pipelineLayoutDesc.rootDescriptors[i];
+        AppendValue(blob, rootDescriptorDesc.registerIndex);
+        AppendValue(blob, rootDescriptorDesc.descriptorType);
+        AppendValue(blob, rootDescriptorDesc.shaderStages);
+    }
+
+    AppendValue(blob, pipelineLayoutDesc.rootSamplerNum);
+    for (uint32_t i = 0; i < pipelineLayoutDesc.rootSamplerNum; i++) {
+        const RootSamplerDesc& rootSamplerDesc = pipelineLayoutDesc.rootSamplers[i];
+        AppendValue(blob, rootSamplerDesc.registerIndex);
+        AppendValue(blob, rootSamplerDesc.shaderStages);
+
+        SerializeSamplerDesc(blob, rootSamplerDesc.desc);
+    }
+
+    AppendValue(blob, pipelineLayoutDesc.descriptorSetNum);
+    for (uint32_t i = 0; i < pipelineLayoutDesc.descriptorSetNum; i++) {
+        const DescriptorSetDesc& descriptorSetDesc = pipelineLayoutDesc.descriptorSets[i];
+        AppendValue(blob, descriptorSetDesc.registerSpace);
+        AppendValue(blob, descriptorSetDesc.flags);
+
+        AppendValue(blob, descriptorSetDesc.rangeNum);
+        for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++) {
+            const DescriptorRangeDesc& rangeDesc = descriptorSetDesc.ranges[j];
+            AppendValue(blob, rangeDesc.baseRegisterIndex);
+            AppendValue(blob, rangeDesc.descriptorNum);
+            AppendValue(blob, rangeDesc.descriptorType);
+            AppendValue(blob, rangeDesc.shaderStages);
+            AppendValue(blob, rangeDesc.flags);
+        }
+    }
+}
+
+Result DeviceVK::GetPipelineLayout(const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    // Materials tend to produce many identical layouts, so each unique layout gets created once and shared (ref-counted)
+    Vector<uint8_t> desc(GetStdAllocator());
+    SerializePipelineLayoutDesc(pipelineLayoutDesc, desc);
+
+    auto create = [&](PipelineLayoutVK*& object) {
+        PipelineLayout* handle = nullptr;
+        Result result = CreateImplementation<PipelineLayoutVK>(handle, pipelineLayoutDesc);
+        object = (PipelineLayoutVK*)handle;
+
+        return result;
+    };
+
+    auto destroy = [&](PipelineLayoutVK* object) {
+        Destroy(GetAllocationCallbacks(), object);
+    };
+
+    uint64_t key = 0;
+    PipelineLayoutVK* pipelineLayoutVK = nullptr;
+    Result result = GetCachedObject(m_PipelineLayouts, desc, create, destroy, pipelineLayoutVK, key);
+
+    pipelineLayout = (PipelineLayout*)pipelineLayoutVK;
+    if (result == Result::SUCCESS)
+        pipelineLayoutVK->SetKey(key);
+
+    return result;
+}
+
+void DeviceVK::ReleasePipelineLayout(PipelineLayoutVK& pipelineLayout) {
+    PipelineLayoutVK* pipelineLayoutVK = nullptr;
+    if (ReleaseCachedObject(m_PipelineLayouts, pipelineLayout.GetKey(), pipelineLayoutVK))
+        Destroy(GetAllocationCallbacks(), pipelineLayoutVK);
+}
+
+Result DeviceVK::GetDescriptorObject(Vector<uint8_t>& desc, VkObjectType type, const void* createInfo, uint64_t& handle, uint64_t& key) {
+    // Streaming recreates views with the same parameters and samplers are limited by "samplerAllocationMaxNum", so each unique object gets created once and shared
+    auto create = [&](DescriptorObject& object) -> Result {
+        object.type = type;
+
+        VkResult vkResult = VK_SUCCESS;
+        if (type == VK_OBJECT_TYPE_IMAGE_VIEW) {
+            vkResult = m_VK.CreateImageView(m_Device, (const VkImageViewCreateInfo*)createInfo, m_AllocationCallbackPtr, (VkImageView*)&object.handle);
+            RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateImageView");
+        } else if (type == VK_OBJECT_TYPE_BUFFER_VIEW) {
+            vkResult = m_VK.CreateBufferView(m_Device, (const VkBufferViewCreateInfo*)createInfo, m_AllocationCallbackPtr, (VkBufferView*)&object.handle);
+            RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateBufferView");
+        } else {
+            vkResult = m_VK.CreateSampler(m_Device, (const VkSamplerCreateInfo*)createInfo, m_AllocationCallbackPtr, (VkSampler*)&object.handle);
+            RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateSampler");
+        }
+
+        return Result::SUCCESS;
+    };
+
+    auto destroy = [&](const DescriptorObject& object) {
+        DestroyDescriptorObject(object.handle, object.type);
+    };
+
+    ObjectCache<DescriptorObject>& cache = type == VK_OBJECT_TYPE_SAMPLER ? m_Samplers : m_Views;
+
+    DescriptorObject object = {};
+    Result result = GetCachedObject(cache, desc, create, destroy, object, key);
+    handle = object.handle;
+
+    return result;
+}
+
+void DeviceVK::ReleaseDescriptorObject(VkObjectType type, uint64_t key) {
+    ObjectCache<DescriptorObject>& cache = type == VK_OBJECT_TYPE_SAMPLER ? m_Samplers : m_Views;
+
+    DescriptorObject object = {};
+    if (ReleaseCachedObject(cache, key, object))
+        DestroyDescriptorObject(object.handle, object.type);
+}
+
+void DeviceVK::DestroyDescriptorObject(uint64_t handle, VkObjectType type) {
+    if (type == VK_OBJECT_TYPE_IMAGE_VIEW)
+        m_VK.DestroyImageView(m_Device, (VkImageView)handle, m_AllocationCallbackPtr);
+    else if (type == VK_OBJECT_TYPE_BUFFER_VIEW)
+        m_VK.DestroyBufferView(m_Device, (VkBufferView)handle, m_AllocationCallbackPtr);
+    else
+        m_VK.DestroySampler(m_Device, (VkSampler)handle, m_AllocationCallbackPtr);
+}
+
+template <typename PipelineDesc>
+Result DeviceVK::CreatePipeline(Pipeline*& pipeline, const PipelineDesc& pipelineDesc) {
+    auto start = std::chrono::steady_clock::now();
+
+    Result result = CreateImplementation<PipelineVK>(pipeline, pipelineDesc);
+    if (result != Result::SUCCESS)
+        return result;
+
+    auto creationTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    PipelineVK& pipelineVK = *(PipelineVK*)pipeline;
+    pipelineVK.SetCreationTime((uint64_t)creationTime.count());
+
+    RecordPipelineStats(pipelineVK.GetStats());
+
+    return Result::SUCCESS;
+}
+
+void DeviceVK::RecordPipelineStats(const PipelineStats& pipelineStats) {
+    ExclusiveScope lock(m_PipelineCreationStatsLock);
+
+    PipelineCreationStats& stats = m_PipelineCreationStats;
+    stats.totalCreationTime += pipelineStats.creationTime;
+    stats.pipelineNum++;
+
+    // Insertion into a short sorted list, the fastest one drops out
+    uint32_t i = stats.slowestPipelineNum;
+    if (i < GetCountOf(stats.slowestPipelines))
+        stats.slowestPipelineNum++;
+    else if (pipelineStats.creationTime <= stats.slowestPipelines[i - 1].creationTime)
+        return;
+    else
+        i--;
+
+    for (; i && stats.slowestPipelines[i - 1].creationTime < pipelineStats.creationTime; i--)
+        stats.slowestPipelines[i] = stats.slowestPipelines[i - 1];
+
+    stats.slowestPipelines[i] = pipelineStats;
+}
+
+void DeviceVK::RegisterBufferDeviceAddress(const BufferVK& buffer) {
+    ExclusiveScope lock(m_BufferDeviceAddressLock);
+
+    m_BufferDeviceAddresses[buffer.GetDeviceAddress()] = &buffer;
+}
+
+void DeviceVK::UnregisterBufferDeviceAddress(const BufferVK& buffer) {
+    ExclusiveScope lock(m_BufferDeviceAddressLock);
+
+    // Aliased buffers can share an address, only the last registered one is tracked
+    auto it = m_BufferDeviceAddresses.find(buffer.GetDeviceAddress());
+    if (it != m_BufferDeviceAddresses.end() && it->second == &buffer)
+        m_BufferDeviceAddresses.erase(it);
+}
+
+const BufferVK* DeviceVK::FindBufferByDeviceAddress(VkDeviceAddress deviceAddress, uint64_t& offset) {
+    ExclusiveScope lock(m_BufferDeviceAddressLock);
+
+    // The closest buffer starting at or below the address
+    auto it = m_BufferDeviceAddresses.upper_bound(deviceAddress);
+    if (it == m_BufferDeviceAddresses.begin())
+        return nullptr;
+
+    it--;
+
+    const BufferVK* buffer = it->second;
+    offset = deviceAddress - it->first;
+
+    return offset < buffer->GetDesc().size ? buffer : nullptr;
+}
+
 void DeviceVK::ReportMemoryTypes() {
     String text(GetStdAllocator());
 
@@ -1641,6 +2086,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CreateDescriptorPool);
     GET_DEVICE_CORE_FUNC(CreatePipelineLayout);
     GET_DEVICE_CORE_FUNC(CreateDescriptorSetLayout);
+    GET_DEVICE_CORE_FUNC(CreateDescriptorUpdateTemplate);
     GET_DEVICE_CORE_FUNC(CreateShaderModule);
     GET_DEVICE_CORE_FUNC(CreateGraphicsPipelines);
     GET_DEVICE_CORE_FUNC(CreateComputePipelines);
@@ -1657,6 +2103,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(DestroyDescriptorPool);
     GET_DEVICE_CORE_FUNC(DestroyPipelineLayout);
     GET_DEVICE_CORE_FUNC(DestroyDescriptorSetLayout);
+    GET_DEVICE_CORE_FUNC(DestroyDescriptorUpdateTemplate);
     GET_DEVICE_CORE_FUNC(DestroyShaderModule);
     GET_DEVICE_CORE_FUNC(DestroyPipeline);
     GET_DEVICE_CORE_FUNC(FreeMemory);
@@ -1672,6 +2119,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(AllocateCommandBuffers);
     GET_DEVICE_CORE_FUNC(AllocateDescriptorSets);
     GET_DEVICE_CORE_FUNC(UpdateDescriptorSets);
+    GET_DEVICE_CORE_FUNC(UpdateDescriptorSetWithTemplate);
     GET_DEVICE_CORE_FUNC(BindBufferMemory2);
     GET_DEVICE_CORE_FUNC(BindImageMemory2);
     GET_DEVICE_CORE_FUNC(GetBufferMemoryRequirements2);
@@ -1685,6 +2133,18 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CmdSetStencilReference);
     GET_DEVICE_CORE_FUNC(CmdSetBlendConstants);
     GET_DEVICE_CORE_FUNC(CmdSetDepthBias);
+    GET_DEVICE_CORE_FUNC(CmdSetLineWidth);
+    GET_DEVICE_CORE_FUNC(CmdSetPrimitiveTopology);
+    GET_DEVICE_CORE_FUNC(CmdSetCullMode);
+    GET_DEVICE_CORE_FUNC(CmdSetFrontFace);
+    GET_DEVICE_CORE_FUNC(CmdSetDepthTestEnable);
+    GET_DEVICE_CORE_FUNC(CmdSetDepthWriteEnable);
+    GET_DEVICE_CORE_FUNC(CmdSetDepthCompareOp);
+    GET_DEVICE_CORE_FUNC(CmdSetDepthBoundsTestEnable);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilTestEnable);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilOp);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilCompareMask);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilWriteMask);
     GET_DEVICE_CORE_FUNC(CmdClearAttachments);
     GET_DEVICE_CORE_FUNC(CmdClearColorImage);
     GET_DEVICE_CORE_FUNC(CmdBindVertexBuffers2);
@@ -1714,7 +2174,9 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CmdFillBuffer);
     GET_DEVICE_CORE_FUNC(CmdBeginRendering);
     GET_DEVICE_CORE_FUNC(CmdEndRendering);
+    GET_DEVICE_CORE_FUNC(CmdExecuteCommands);
     GET_DEVICE_CORE_FUNC(CmdPushDescriptorSet);
+    GET_DEVICE_CORE_FUNC(CmdPushDescriptorSetWithTemplate);
     GET_DEVICE_CORE_FUNC(EndCommandBuffer);
 
     GET_DEVICE_OPTIONAL_CORE_FUNC(GetDeviceBufferMemoryRequirements);
@@ -1767,12 +2229,72 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(CmdSetSampleLocationsEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdSetColorBlendEnableEXT);
+        GET_DEVICE_FUNC(CmdSetColorBlendEquationEXT);
+        GET_DEVICE_FUNC(CmdSetColorWriteMaskEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CreateShadersEXT);
+        GET_DEVICE_FUNC(DestroyShaderEXT);
+        GET_DEVICE_FUNC(CmdBindShadersEXT);
+        GET_DEVICE_FUNC(CmdSetVertexInputEXT);
+        GET_DEVICE_FUNC(CmdSetPatchControlPointsEXT);
+        GET_DEVICE_FUNC(CmdSetTessellationDomainOriginEXT);
+        GET_DEVICE_FUNC(CmdSetPolygonModeEXT);
+        GET_DEVICE_FUNC(CmdSetRasterizationSamplesEXT);
+        GET_DEVICE_FUNC(CmdSetSampleMaskEXT);
+        GET_DEVICE_FUNC(CmdSetAlphaToCoverageEnableEXT);
+        GET_DEVICE_FUNC(CmdSetAlphaToOneEnableEXT);
+        GET_DEVICE_FUNC(CmdSetDepthClampEnableEXT);
+        GET_DEVICE_FUNC(CmdSetLogicOpEnableEXT);
+        GET_DEVICE_FUNC(CmdSetLogicOpEXT);
+        GET_DEVICE_FUNC(CmdSetColorBlendEnableEXT);
+        GET_DEVICE_FUNC(CmdSetColorBlendEquationEXT);
+        GET_DEVICE_FUNC(CmdSetColorWriteMaskEXT);
+        GET_DEVICE_CORE_FUNC(CmdSetPrimitiveRestartEnable);
+        GET_DEVICE_CORE_FUNC(CmdSetRasterizerDiscardEnable);
+        GET_DEVICE_CORE_FUNC(CmdSetDepthBiasEnable);
+
+        if (IsExtensionSupported(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME, desiredDeviceExts))
+            GET_DEVICE_FUNC(CmdSetSampleLocationsEnableEXT);
+
+        if (IsExtensionSupported(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME, desiredDeviceExts))
+            GET_DEVICE_FUNC(CmdSetConservativeRasterizationModeEXT);
+
+        if (m_MinorVersion >= 4 || IsExtensionSupported(VK_KHR_LINE_RASTERIZATION_EXTENSION_NAME, desiredDeviceExts)) {
+            GET_DEVICE_FUNC(CmdSetLineRasterizationModeEXT);
+            GET_DEVICE_FUNC(CmdSetLineStippleEnableEXT);
+        }
+    }
+
     if (IsExtensionSupported(VK_EXT_MESH_SHADER_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CmdDrawMeshTasksEXT);
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectEXT);
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectCountEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdDrawMultiEXT);
+        GET_DEVICE_FUNC(CmdDrawMultiIndexedEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CreateIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(DestroyIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);
+        GET_DEVICE_FUNC(CmdExecuteGeneratedCommandsEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(GetDescriptorSetLayoutSizeEXT);
+        GET_DEVICE_FUNC(GetDescriptorSetLayoutBindingOffsetEXT);
+        GET_DEVICE_FUNC(GetDescriptorEXT);
+        GET_DEVICE_FUNC(CmdBindDescriptorBuffersEXT);
+        GET_DEVICE_FUNC(CmdSetDescriptorBufferOffsetsEXT);
+    }
+
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(GetLatencyTimingsNV);
         GET_DEVICE_FUNC(LatencySleepNV);
@@ -1840,6 +2362,31 @@ NRI_INLINE Result DeviceVK::WaitIdle() {
 }
 
 NRI_INLINE void DeviceVK::CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
+    // Descriptor buffer: CPU copies between mapped memory
+    if (m_IsSupported.descriptorBuffer) {
+        for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
+            const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
+
+            const DescriptorSetVK& dst = *(DescriptorSetVK*)copyDescriptorSetDesc.dstDescriptorSet;
+            const DescriptorSetVK& src = *(DescriptorSetVK*)copyDescriptorSetDesc.srcDescriptorSet;
+
+            uint32_t descriptorNum = copyDescriptorSetDesc.descriptorNum;
+            if (!descriptorNum)
+                descriptorNum = src.GetDesc()->ranges[copyDescriptorSetDesc.srcRangeIndex].descriptorNum;
+
+            uint32_t descriptorSize = std::min(dst.GetDescriptorSize(copyDescriptorSetDesc.dstRangeIndex), src.GetDescriptorSize(copyDescriptorSetDesc.srcRangeIndex));
+
+            for (uint32_t j = 0; j < descriptorNum; j++) {
+                uint8_t* dstData = dst.GetDescriptorData(copyDescriptorSetDesc.dstRangeIndex, copyDescriptorSetDesc.dstBaseDescriptor + j);
+                const uint8_t* srcData = src.GetDescriptorData(copyDescriptorSetDesc.srcRangeIndex, copyDescriptorSetDesc.srcBaseDescriptor + j);
+
+                memcpy(dstData, srcData, descriptorSize);
+            }
+        }
+
+        return;
+    }
+
     Scratch<VkCopyDescriptorSet> copies = AllocateScratch(*this, VkCopyDescriptorSet, copyDescriptorRangeDescNum);
     for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
         const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
@@ -1965,66 +2512,115 @@ constexpr std::array<WriteDescriptorsFunc, (size_t)DescriptorType::MAX_NUM> g_Wr
 };
 VALIDATE_ARRAY_BY_PTR(g_WriteFuncs);
 
+static size_t GetWriteScratchSize(DescriptorType descriptorType, uint32_t descriptorNum) {
+    switch (descriptorType) {
+        case DescriptorType::SAMPLER:
+        case DescriptorType::TEXTURE:
+        case DescriptorType::STORAGE_TEXTURE:
+            return sizeof(VkDescriptorImageInfo) * descriptorNum;
+        case DescriptorType::CONSTANT_BUFFER:
+        case DescriptorType::STRUCTURED_BUFFER:
+        case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+            return sizeof(VkDescriptorBufferInfo) * descriptorNum;
+        case DescriptorType::BUFFER:
+        case DescriptorType::STORAGE_BUFFER:
+            return sizeof(VkBufferView) * descriptorNum;
+        case DescriptorType::ACCELERATION_STRUCTURE:
+            return sizeof(VkAccelerationStructureKHR) * descriptorNum + sizeof(VkWriteDescriptorSetAccelerationStructureKHR);
+        default:
+            CHECK(false, "Unexpected");
+            return 0;
+    }
+}
+
 NRI_INLINE void DeviceVK::UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum) {
-    // Count and allocate scratch memory
-    size_t scratchOffset = updateDescriptorRangeDescNum * sizeof(VkWriteDescriptorSet);
-    size_t scratchSize = scratchOffset;
+    // Descriptor buffer: CPU writes into mapped memory
+    if (m_IsSupported.descriptorBuffer) {
+        for (uint32_t i = 0; i < updateDescriptorRangeDescNum; i++) {
+            const UpdateDescriptorRangeDesc& updateDescriptorRangeDesc = updateDescriptorRangeDescs[i];
+            const DescriptorSetVK& dst = *(DescriptorSetVK*)updateDescriptorRangeDesc.descriptorSet;
+            const DescriptorRangeDesc& rangeDesc = dst.GetDesc()->ranges[updateDescriptorRangeDesc.rangeIndex];
+            bool isMutable = rangeDesc.flags & DescriptorRangeBits::MUTABLE;
+
+            for (uint32_t j = 0; j < updateDescriptorRangeDesc.descriptorNum; j++) {
+                const DescriptorVK& descriptorVK = *(DescriptorVK*)updateDescriptorRangeDesc.descriptors[j];
+                uint8_t* dstData = dst.GetDescriptorData(updateDescriptorRangeDesc.rangeIndex, updateDescriptorRangeDesc.baseDescriptor + j);
+
+                descriptorVK.GetDescriptorData(isMutable ? descriptorVK.GetDescriptorType() : rangeDesc.descriptorType, dstData);
+            }
+        }
+
+        return;
+    }
+
+    // Count and allocate scratch memory. A "MUTABLE" range needs a write per descriptor, since descriptors can be of different types
+    uint32_t writeNum = 0;
+    size_t infoSize = 0;
     for (uint32_t i = 0; i < updateDescriptorRangeDescNum; i++) {
         const UpdateDescriptorRangeDesc& updateDescriptorRangeDesc = updateDescriptorRangeDescs[i];
         const DescriptorSetVK& dst = *(DescriptorSetVK*)updateDescriptorRangeDesc.descriptorSet;
         const DescriptorRangeDesc& rangeDesc = dst.GetDesc()->ranges[updateDescriptorRangeDesc.rangeIndex];
 
-        switch (rangeDesc.descriptorType) {
-            case DescriptorType::SAMPLER:
-            case DescriptorType::TEXTURE:
-            case DescriptorType::STORAGE_TEXTURE:
-                scratchSize += sizeof(VkDescriptorImageInfo) * updateDescriptorRangeDesc.descriptorNum;
-                break;
-            case DescriptorType::CONSTANT_BUFFER:
-            case DescriptorType::STRUCTURED_BUFFER:
-            case DescriptorType::STORAGE_STRUCTURED_BUFFER:
-                scratchSize += sizeof(VkDescriptorBufferInfo) * updateDescriptorRangeDesc.descriptorNum;
-                break;
-            case DescriptorType::BUFFER:
-            case DescriptorType::STORAGE_BUFFER:
-                scratchSize += sizeof(VkBufferView) * updateDescriptorRangeDesc.descriptorNum;
-                break;
-
-            case DescriptorType::ACCELERATION_STRUCTURE:
-                scratchSize += sizeof(VkAccelerationStructureKHR) * updateDescriptorRangeDesc.descriptorNum + sizeof(VkWriteDescriptorSetAccelerationStructureKHR);
-                break;
-
-            default:
-                CHECK(false, "Unexpected");
-                break;
+        if (rangeDesc.flags & DescriptorRangeBits::MUTABLE) {
+            for (uint32_t j = 0; j < updateDescriptorRangeDesc.descriptorNum; j++) {
+                const DescriptorVK& descriptorVK = *(DescriptorVK*)updateDescriptorRangeDesc.descriptors[j];
+                infoSize += GetWriteScratchSize(descriptorVK.GetDescriptorType(), 1);
+            }
+
+            writeNum += updateDescriptorRangeDesc.descriptorNum;
+        } else {
+            infoSize += GetWriteScratchSize(rangeDesc.descriptorType, updateDescriptorRangeDesc.descriptorNum);
+            writeNum++;
         }
     }
 
-    Scratch<uint8_t> writes = AllocateScratch(*this, uint8_t, scratchSize);
+    size_t scratchOffset = writeNum * sizeof(VkWriteDescriptorSet);
+    Scratch<uint8_t> writes = AllocateScratch(*this, uint8_t, scratchOffset + infoSize);
 
     // Update ranges
+    uint32_t n = 0;
     for (uint32_t i = 0; i < updateDescriptorRangeDescNum; i++) {
         const UpdateDescriptorRangeDesc& updateDescriptorRangeDesc = updateDescriptorRangeDescs[i];
         const DescriptorSetVK& dst = *(DescriptorSetVK*)updateDescriptorRangeDesc.descriptorSet;
         const DescriptorRangeDesc& rangeDesc = dst.GetDesc()->ranges[updateDescriptorRangeDesc.rangeIndex];
 
-        VkWriteDescriptorSet& write = *(VkWriteDescriptorSet*)(writes + i * sizeof(VkWriteDescriptorSet)); // must be first and consecutive in "scratch"
-        write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-        write.dstSet = dst.GetHandle();
-        write.descriptorCount = updateDescriptorRangeDesc.descriptorNum;
-        write.descriptorType = GetDescriptorType(rangeDesc.descriptorType);
-
         bool isArray = rangeDesc.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
-        if (isArray) {
-            write.dstBinding = rangeDesc.baseRegisterIndex;
-            write.dstArrayElement = updateDescriptorRangeDesc.baseDescriptor;
-        } else
-            write.dstBinding = rangeDesc.baseRegisterIndex + updateDescriptorRangeDesc.baseDescriptor;
+        bool isMutable = rangeDesc.flags & DescriptorRangeBits::MUTABLE;
+        uint32_t subrangeNum = isMutable ? updateDescriptorRangeDesc.descriptorNum : 1;
+
+        for (uint32_t j = 0; j < subrangeNum; j++) {
+            UpdateDescriptorRangeDesc subrange = updateDescriptorRangeDesc;
+            DescriptorType descriptorType = rangeDesc.descriptorType;
+            VkDescriptorType vkDescriptorType = GetDescriptorType(rangeDesc);
 
-        g_WriteFuncs[(uint32_t)rangeDesc.descriptorType](write, scratchOffset, writes, updateDescriptorRangeDesc);
+            if (isMutable) {
+                const DescriptorVK& descriptorVK = *(DescriptorVK*)updateDescriptorRangeDesc.descriptors[j];
+
+                subrange.baseDescriptor += j;
+                subrange.descriptors += j;
+                subrange.descriptorNum = 1;
+
+                descriptorType = descriptorVK.GetDescriptorType();
+                vkDescriptorType = GetDescriptorType(descriptorType);
+            }
+
+            VkWriteDescriptorSet& write = *(VkWriteDescriptorSet*)(writes + (n++) * sizeof(VkWriteDescriptorSet)); // must be first and consecutive in "scratch"
+            write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            write.dstSet = dst.GetHandle();
+            write.descriptorCount = subrange.descriptorNum;
+            write.descriptorType = vkDescriptorType;
+
+            if (isArray) {
+                write.dstBinding = rangeDesc.baseRegisterIndex;
+                write.dstArrayElement = subrange.baseDescriptor;
+            } else
+                write.dstBinding = rangeDesc.baseRegisterIndex + subrange.baseDescriptor;
+
+            g_WriteFuncs[(uint32_t)descriptorType](write, scratchOffset, writes, subrange);
+        }
     }
 
-    m_VK.UpdateDescriptorSets(m_Device, updateDescriptorRangeDescNum, (VkWriteDescriptorSet*)(writes + 0), 0, nullptr);
+    m_VK.UpdateDescriptorSets(m_Device, writeNum, (VkWriteDescriptorSet*)(writes + 0), 0, nullptr);
 }
 
 NRI_INLINE Result DeviceVK::BindBufferMemory(const BindBufferMemoryDesc* bindBufferMemoryDescs, uint32_t bindBufferMemoryDescNum) {
@@ -2236,3 +2832,23 @@ NRI_INLINE Result DeviceVK::QueryVideoMemoryInfo(MemoryLocation memoryLocation,
 
     return Result::SUCCESS;
 }
+
+NRI_INLINE void DeviceVK::GetPipelineCreationStats(PipelineCreationStats& pipelineCreationStats) {
+    ExclusiveScope lock(m_PipelineCreationStatsLock);
+
+    pipelineCreationStats = m_PipelineCreationStats;
+}
+
+NRI_INLINE void DeviceVK::GetDescriptorCacheStats(DescriptorCacheStats& descriptorCacheStats) {
+    {
+        ExclusiveScope lock(m_Views.lock);
+
+        descriptorCacheStats.hitNum = m_Views.hitNum;
+        descriptorCacheStats.viewNum = (uint32_t)m_Views.objects.size();
+    }
+
+    ExclusiveScope lock(m_Samplers.lock);
+
+    descriptorCacheStats.hitNum += m_Samplers.hitNum;
+    descriptorCacheStats.samplerNum = (uint32_t)m_Samplers.objects.size();
+}
@@ -74,6 +74,7 @@ struct DispatchTable {
     VK_FUNC(CreateDescriptorPool);                        // + | +
     VK_FUNC(CreatePipelineLayout);                        // + | +
     VK_FUNC(CreateDescriptorSetLayout);                   // + | +
+    VK_FUNC(CreateDescriptorUpdateTemplate);              // + | +
     VK_FUNC(CreateShaderModule);                          // + | +
     VK_FUNC(CreateGraphicsPipelines);                     // + | +
     VK_FUNC(CreateComputePipelines);                      // + | +
@@ -90,6 +91,7 @@ struct DispatchTable {
     VK_FUNC(DestroyDescriptorPool);                       // - | +
     VK_FUNC(DestroyPipelineLayout);                       // - | +
     VK_FUNC(DestroyDescriptorSetLayout);                  // - | +
+    VK_FUNC(DestroyDescriptorUpdateTemplate);             // - | +
     VK_FUNC(DestroyShaderModule);                         // - | +
     VK_FUNC(DestroyPipeline);                             // - | +
     VK_FUNC(FreeMemory);                                  // - | +
@@ -105,6 +107,7 @@ struct DispatchTable {
     VK_FUNC(AllocateCommandBuffers);                      // - | +
     VK_FUNC(AllocateDescriptorSets);                      // - | +
     VK_FUNC(UpdateDescriptorSets);                        // + | +
+    VK_FUNC(UpdateDescriptorSetWithTemplate);             // + | +
     VK_FUNC(BindBufferMemory2);                           // + | +
     VK_FUNC(BindImageMemory2);                            // + | +
     VK_FUNC(GetBufferMemoryRequirements2);                // + | +
@@ -118,6 +121,21 @@ struct DispatchTable {
     VK_FUNC(CmdSetStencilReference);                      // - | +
     VK_FUNC(CmdSetBlendConstants);                        // - | +
     VK_FUNC(CmdSetDepthBias);                             // - | + TODO: "VK_EXT_depth_bias_control" offers "2" but MoltenVK doesn't support it yet
+    VK_FUNC(CmdSetLineWidth);                             // - | +
+    VK_FUNC(CmdSetPrimitiveTopology);                     // - | +
+    VK_FUNC(CmdSetCullMode);                              // - | +
+    VK_FUNC(CmdSetFrontFace);                             // - | +
+    VK_FUNC(CmdSetDepthTestEnable);                       // - | +
+    VK_FUNC(CmdSetDepthWriteEnable);                      // - | +
+    VK_FUNC(CmdSetDepthCompareOp);                        // - | +
+    VK_FUNC(CmdSetDepthBoundsTestEnable);                 // - | +
+    VK_FUNC(CmdSetStencilTestEnable);                     // - | +
+    VK_FUNC(CmdSetStencilOp);                             // - | +
+    VK_FUNC(CmdSetStencilCompareMask);                    // - | +
+    VK_FUNC(CmdSetStencilWriteMask);                      // - | +
+    VK_FUNC(CmdSetPrimitiveRestartEnable);                // - | +
+    VK_FUNC(CmdSetRasterizerDiscardEnable);               // - | +
+    VK_FUNC(CmdSetDepthBiasEnable);                       // - | +
     VK_FUNC(CmdClearAttachments);                         // - | +
     VK_FUNC(CmdClearColorImage);                          // - | +
     VK_FUNC(CmdBindVertexBuffers2);                       // - | +
@@ -147,7 +165,9 @@ struct DispatchTable {
     VK_FUNC(CmdFillBuffer);                               // - | +
     VK_FUNC(CmdBeginRendering);                           // - | +
     VK_FUNC(CmdEndRendering);                             // - | +
+    VK_FUNC(CmdExecuteCommands);                          // - | +
     VK_FUNC(CmdPushDescriptorSet);                        // - | +
+    VK_FUNC(CmdPushDescriptorSetWithTemplate);            // - | +
     VK_FUNC(EndCommandBuffer);                            // - | +
                                                           // VK_KHR_maintenance4
     VK_FUNC(GetDeviceBufferMemoryRequirements);           // + | +
@@ -189,10 +209,46 @@ struct DispatchTable {
     VK_FUNC(CmdWriteMicromapsPropertiesEXT);              // - | +
                                                           // VK_EXT_sample_locations
     VK_FUNC(CmdSetSampleLocationsEXT);                    // - | +
+    VK_FUNC(CmdSetColorBlendEnableEXT);                   // - | +
+    VK_FUNC(CmdSetColorBlendEquationEXT);                 // - | +
+    VK_FUNC(CmdSetColorWriteMaskEXT);                     // - | +
+                                                          // VK_EXT_shader_object
+    VK_FUNC(CreateShadersEXT);                            // + | +
+    VK_FUNC(DestroyShaderEXT);                            // - | +
+    VK_FUNC(CmdBindShadersEXT);                           // - | +
+    VK_FUNC(CmdSetVertexInputEXT);                        // - | +
+    VK_FUNC(CmdSetPatchControlPointsEXT);                 // - | +
+    VK_FUNC(CmdSetTessellationDomainOriginEXT);           // - | +
+    VK_FUNC(CmdSetPolygonModeEXT);                        // - | +
+    VK_FUNC(CmdSetRasterizationSamplesEXT);               // - | +
+    VK_FUNC(CmdSetSampleMaskEXT);                         // - | +
+    VK_FUNC(CmdSetAlphaToCoverageEnableEXT);              // - | +
+    VK_FUNC(CmdSetAlphaToOneEnableEXT);                   // - | +
+    VK_FUNC(CmdSetDepthClampEnableEXT);                   // - | +
+    VK_FUNC(CmdSetLogicOpEnableEXT);                      // - | +
+    VK_FUNC(CmdSetLogicOpEXT);                            // - | +
+    VK_FUNC(CmdSetSampleLocationsEnableEXT);              // - | +
+    VK_FUNC(CmdSetConservativeRasterizationModeEXT);      // - | +
+    VK_FUNC(CmdSetLineRasterizationModeEXT);              // - | +
+    VK_FUNC(CmdSetLineStippleEnableEXT);                  // - | +
+                                                          // VK_EXT_descriptor_buffer
+    VK_FUNC(GetDescriptorSetLayoutSizeEXT);               // - | +
+    VK_FUNC(GetDescriptorSetLayoutBindingOffsetEXT);      // - | +
+    VK_FUNC(GetDescriptorEXT);                            // - | +
+    VK_FUNC(CmdBindDescriptorBuffersEXT);                 // - | +
+    VK_FUNC(CmdSetDescriptorBufferOffsetsEXT);            // - | +
                                                           // VK_EXT_mesh_shader
     VK_FUNC(CmdDrawMeshTasksEXT);                         // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectEXT);                 // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectCountEXT);            // - | +
+                                                          // VK_EXT_multi_draw
+    VK_FUNC(CmdDrawMultiEXT);                             // - | +
+    VK_FUNC(CmdDrawMultiIndexedEXT);                      // - | +
+                                                          // VK_EXT_device_generated_commands
+    VK_FUNC(CreateIndirectCommandsLayoutEXT);             // + | +
+    VK_FUNC(DestroyIndirectCommandsLayoutEXT);            // - | +
+    VK_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);   // + | +
+    VK_FUNC(CmdExecuteGeneratedCommandsEXT);              // - | +
                                                           // VK_NV_low_latency2
     VK_FUNC(GetLatencyTimingsNV);                         // + | +
     VK_FUNC(LatencySleepNV);                              // + | +
@@ -13,6 +13,7 @@
 #include "DescriptorSetVK.h"
 #include "DescriptorVK.h"
 #include "FenceVK.h"
+#include "IndirectCommandLayoutVK.h"
 #include "MemoryVK.h"
 #include "MicromapVK.h"
 #include "PipelineLayoutVK.h"
@@ -22,6 +23,8 @@
 #include "SwapChainVK.h"
 #include "TextureVK.h"
 
+#include "BindlessHeapInterface.h"
+#include "DescriptorAllocatorInterface.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
 #include "StreamerInterface.h"
@@ -39,6 +42,7 @@ using namespace nri;
 #include "DescriptorVK.hpp"
 #include "DeviceVK.hpp"
 #include "FenceVK.hpp"
+#include "IndirectCommandLayoutVK.hpp"
 #include "MemoryVK.hpp"
 #include "MicromapVK.hpp"
 #include "PipelineLayoutVK.hpp"
@@ -98,7 +102,11 @@ static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& c
 }
 
 static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
-    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffer(commandBuffer);
+    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffer(commandBuffer, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+}
+
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffer(commandBuffer, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
 }
 
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
@@ -110,15 +118,15 @@ static Result NRI_CALL CreateDescriptorPool(Device& device, const DescriptorPool
 }
 
 static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
-    return ((DeviceVK&)device).CreateImplementation<PipelineLayoutVK>(pipelineLayout, pipelineLayoutDesc);
+    return ((DeviceVK&)device).GetPipelineLayout(pipelineLayoutDesc, pipelineLayout);
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
-    return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, graphicsPipelineDesc);
+    return ((DeviceVK&)device).CreatePipeline(pipeline, graphicsPipelineDesc);
 }
 
 static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
-    return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, computePipelineDesc);
+    return ((DeviceVK&)device).CreatePipeline(pipeline, computePipelineDesc);
 }
 
 static Result NRI_CALL CreateQueryPool(Device& device, const QueryPoolDesc& queryPoolDesc, QueryPool*& queryPool) {
@@ -154,7 +162,14 @@ static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator)
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
-    Destroy((CommandBufferVK*)commandBuffer);
+    CommandBufferVK* commandBufferVK = (CommandBufferVK*)commandBuffer;
+    CommandAllocatorVK* commandAllocatorVK = commandBufferVK ? commandBufferVK->GetCommandAllocator() : nullptr;
+
+    // Command buffers created by an allocator are recycled
+    if (commandAllocatorVK)
+        commandAllocatorVK->ReleaseCommandBuffer(*commandBufferVK);
+    else
+        Destroy(commandBufferVK);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
@@ -174,7 +189,11 @@ static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
 }
 
 static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
-    Destroy((PipelineLayoutVK*)pipelineLayout);
+    if (!pipelineLayout)
+        return;
+
+    PipelineLayoutVK& pipelineLayoutVK = (PipelineLayoutVK&)*pipelineLayout;
+    pipelineLayoutVK.GetDevice().ReleasePipelineLayout(pipelineLayoutVK);
 }
 
 static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
@@ -287,6 +306,22 @@ static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint6
     return result;
 }
 
+static Result NRI_CALL OptimizePipeline(Pipeline& pipeline) {
+    return ((PipelineVK&)pipeline).Optimize();
+}
+
+static void NRI_CALL GetPipelineStats(const Pipeline& pipeline, PipelineStats& pipelineStats) {
+    pipelineStats = ((PipelineVK&)pipeline).GetStats();
+}
+
+static void NRI_CALL GetPipelineCreationStats(const Device& device, PipelineCreationStats& pipelineCreationStats) {
+    ((DeviceVK&)device).GetPipelineCreationStats(pipelineCreationStats);
+}
+
+static void NRI_CALL GetDescriptorCacheStats(const Device& device, DescriptorCacheStats& descriptorCacheStats) {
+    ((DeviceVK&)device).GetDescriptorCacheStats(descriptorCacheStats);
+}
+
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     return ((DescriptorPoolVK&)descriptorPool).AllocateDescriptorSets(pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
 }
@@ -299,6 +334,10 @@ static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* upd
     deviceVK.UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
+static void NRI_CALL UpdateDescriptorSet(DescriptorSet& descriptorSet, const Descriptor* const* descriptors) {
+    ((DescriptorSetVK&)descriptorSet).UpdateDescriptorSet(descriptors);
+}
+
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     if (!copyDescriptorRangeDescNum)
         return;
@@ -311,11 +350,20 @@ static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
     ((DescriptorPoolVK&)descriptorPool).Reset();
 }
 
+static void NRI_CALL GetDescriptorPoolStats(const DescriptorPool& descriptorPool, DescriptorPoolStats& descriptorPoolStats) {
+    ((DescriptorPoolVK&)descriptorPool).GetStats(descriptorPoolStats);
+}
+
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
     return ((CommandBufferVK&)commandBuffer).Begin(descriptorPool);
 }
 
-static void NRI_CALL CmdSetDescriptorPool(CommandBuffer&, const DescriptorPool&) {
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVK&)commandBuffer).BeginSecondary(attachmentsDesc, descriptorPool);
+}
+
+static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
+    ((CommandBufferVK&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
 
 static void NRI_CALL CmdSetPipelineLayout(CommandBuffer& commandBuffer, BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
@@ -326,6 +374,10 @@ static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const Set
     ((CommandBufferVK&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
+static void NRI_CALL CmdSetDescriptorSets(CommandBuffer& commandBuffer, const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    ((CommandBufferVK&)commandBuffer).SetDescriptorSets(setDescriptorSetsDesc);
+}
+
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
     ((CommandBufferVK&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
@@ -382,6 +434,26 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferVK&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer& commandBuffer, Topology topology) {
+    ((CommandBufferVK&)commandBuffer).SetTopology(topology);
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer& commandBuffer, CullMode cullMode, bool frontCounterClockwise) {
+    ((CommandBufferVK&)commandBuffer).SetCullMode(cullMode, frontCounterClockwise);
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer& commandBuffer, const DepthAttachmentDesc& depthAttachmentDesc) {
+    ((CommandBufferVK&)commandBuffer).SetDepthState(depthAttachmentDesc);
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer& commandBuffer, const StencilAttachmentDesc& stencilAttachmentDesc) {
+    ((CommandBufferVK&)commandBuffer).SetStencilState(stencilAttachmentDesc);
+}
+
+static void NRI_CALL CmdSetBlendState(CommandBuffer& commandBuffer, uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum) {
+    ((CommandBufferVK&)commandBuffer).SetBlendState(baseAttachment, colorAttachmentDescs, colorAttachmentNum);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferVK&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -398,6 +470,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVK&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVK&)commandBuffer).DrawMulti(drawDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVK&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum, stride);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVK&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -406,6 +486,10 @@ static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const
     ((CommandBufferVK&)commandBuffer).DrawIndexedIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
+static void NRI_CALL CmdExecuteCommandBuffers(CommandBuffer& commandBuffer, const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum) {
+    ((CommandBufferVK&)commandBuffer).ExecuteCommandBuffers(commandBuffers, commandBufferNum);
+}
+
 static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
     ((CommandBufferVK&)commandBuffer).EndRendering();
 }
@@ -422,6 +506,10 @@ static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuff
     ((CommandBufferVK&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).CopyBufferRegions(dstBuffer, srcBuffer, regions, regionNum);
+}
+
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferVK&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -446,6 +534,10 @@ static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearSt
     ((CommandBufferVK&)commandBuffer).ClearStorage(clearDesc);
 }
 
+static void NRI_CALL CmdClearStorages(CommandBuffer& commandBuffer, const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    ((CommandBufferVK&)commandBuffer).ClearStorages(clearDescs, clearDescNum);
+}
+
 static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
     ((CommandBufferVK&)commandBuffer).ResetQueries(queryPool, offset, num);
 }
@@ -487,6 +579,10 @@ static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
     return ((CommandBufferVK&)commandBuffer).End();
 }
 
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = ((CommandBufferVK&)commandBuffer).GetStats();
+}
+
 static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
     MaybeUnused(queue, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
@@ -572,7 +668,12 @@ static void* NRI_CALL GetCommandBufferNativeObject(const CommandBuffer* commandB
     if (!commandBuffer)
         return nullptr;
 
-    return (VkCommandBuffer)(*(CommandBufferVK*)commandBuffer);
+    // Native commands recorded after this call must see deferred barriers
+    CommandBufferVK& commandBufferVK = *(CommandBufferVK*)commandBuffer;
+    if (commandBufferVK.HasPendingBarriers())
+        commandBufferVK.FlushBarriers();
+
+    return (VkCommandBuffer)commandBufferVK;
 }
 
 static uint64_t NRI_CALL GetBufferNativeObject(const Buffer* buffer) {
@@ -618,6 +719,7 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTexture1DView = ::CreateTexture1DView;
@@ -653,13 +755,21 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CreateCommittedTexture = ::CreateCommittedTexture;
     table.CreatePlacedBuffer = ::CreatePlacedBuffer;
     table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.OptimizePipeline = ::OptimizePipeline;
+    table.GetPipelineStats = ::GetPipelineStats;
+    table.GetPipelineCreationStats = ::GetPipelineCreationStats;
+    table.GetDescriptorCacheStats = ::GetDescriptorCacheStats;
     table.AllocateDescriptorSets = ::AllocateDescriptorSets;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.UpdateDescriptorSet = ::UpdateDescriptorSet;
     table.CopyDescriptorRanges = ::CopyDescriptorRanges;
     table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorPoolStats = ::GetDescriptorPoolStats;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetDescriptorSets = ::CmdSetDescriptorSets;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
     table.CmdSetPipeline = ::CmdSetPipeline;
     table.CmdSetRootConstants = ::CmdSetRootConstants;
@@ -675,22 +785,32 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetBlendState = ::CmdSetBlendState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdExecuteCommandBuffers = ::CmdExecuteCommandBuffers;
     table.CmdEndRendering = ::CmdEndRendering;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
+    table.CmdClearStorages = ::CmdClearStorages;
     table.CmdResetQueries = ::CmdResetQueries;
     table.CmdBeginQuery = ::CmdBeginQuery;
     table.CmdEndQuery = ::CmdEndQuery;
@@ -699,6 +819,7 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdEndAnnotation = ::CmdEndAnnotation;
     table.CmdAnnotation = ::CmdAnnotation;
     table.EndCommandBuffer = ::EndCommandBuffer;
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
     table.QueueBeginAnnotation = ::QueueBeginAnnotation;
     table.QueueEndAnnotation = ::QueueEndAnnotation;
     table.QueueAnnotation = ::QueueAnnotation;
@@ -723,6 +844,101 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  BindlessHeap  ]
+
+static Result NRI_CALL CreateBindlessHeap(Device& device, const BindlessHeapDesc& bindlessHeapDesc, BindlessHeap*& bindlessHeap) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    BindlessHeapImpl* impl = Allocate<BindlessHeapImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(bindlessHeapDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessHeap = nullptr;
+    } else
+        bindlessHeap = (BindlessHeap*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessHeap(BindlessHeap* bindlessHeap) {
+    Destroy((BindlessHeapImpl*)bindlessHeap);
+}
+
+static const DescriptorSetDesc& NRI_CALL GetBindlessHeapDescriptorSetDesc(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSetDesc();
+}
+
+static DescriptorSet* NRI_CALL GetBindlessHeapDescriptorSet(const BindlessHeap& bindlessHeap) {
+    return ((BindlessHeapImpl&)bindlessHeap).GetDescriptorSet();
+}
+
+static uint32_t NRI_CALL AllocateBindlessHeapSlot(BindlessHeap& bindlessHeap, const Descriptor& descriptor) {
+    return ((BindlessHeapImpl&)bindlessHeap).AllocateSlot(descriptor);
+}
+
+static void NRI_CALL FreeBindlessHeapSlot(BindlessHeap& bindlessHeap, uint32_t slot, uint64_t fenceValue) {
+    ((BindlessHeapImpl&)bindlessHeap).FreeSlot(slot, fenceValue);
+}
+
+Result DeviceVK::FillFunctionTable(BindlessHeapInterface& table) const {
+    table.CreateBindlessHeap = ::CreateBindlessHeap;
+    table.DestroyBindlessHeap = ::DestroyBindlessHeap;
+    table.GetBindlessHeapDescriptorSetDesc = ::GetBindlessHeapDescriptorSetDesc;
+    table.GetBindlessHeapDescriptorSet = ::GetBindlessHeapDescriptorSet;
+    table.AllocateBindlessHeapSlot = ::AllocateBindlessHeapSlot;
+    table.FreeBindlessHeapSlot = ::FreeBindlessHeapSlot;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DescriptorAllocator  ]
+
+static Result NRI_CALL CreateDescriptorAllocator(Device& device, const DescriptorAllocatorDesc& descriptorAllocatorDesc, DescriptorAllocator*& descriptorAllocator) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    DescriptorAllocatorImpl* impl = Allocate<DescriptorAllocatorImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(descriptorAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        descriptorAllocator = nullptr;
+    } else
+        descriptorAllocator = (DescriptorAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDescriptorAllocator(DescriptorAllocator* descriptorAllocator) {
+    Destroy((DescriptorAllocatorImpl*)descriptorAllocator);
+}
+
+static void NRI_CALL BeginDescriptorAllocatorFrame(DescriptorAllocator& descriptorAllocator, uint64_t fenceValue) {
+    ((DescriptorAllocatorImpl&)descriptorAllocator).BeginFrame(fenceValue);
+}
+
+static DescriptorSet* NRI_CALL AllocateDescriptorSet(DescriptorAllocator& descriptorAllocator, const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).AllocateDescriptorSet(pipelineLayout, setIndex, descriptors);
+}
+
+static DescriptorPool* NRI_CALL GetDescriptorAllocatorPool(const DescriptorAllocator& descriptorAllocator) {
+    return ((DescriptorAllocatorImpl&)descriptorAllocator).GetCurrentPool();
+}
+
+Result DeviceVK::FillFunctionTable(DescriptorAllocatorInterface& table) const {
+    table.CreateDescriptorAllocator = ::CreateDescriptorAllocator;
+    table.DestroyDescriptorAllocator = ::DestroyDescriptorAllocator;
+    table.BeginDescriptorAllocatorFrame = ::BeginDescriptorAllocatorFrame;
+    table.AllocateDescriptorSet = ::AllocateDescriptorSet;
+    table.GetDescriptorAllocatorPool = ::GetDescriptorAllocatorPool;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -811,6 +1027,42 @@ Result DeviceVK::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVK&)device).CreateImplementation<IndirectCommandLayoutVK>(indirectCommandLayout, indirectCommandLayoutDesc);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    Destroy((IndirectCommandLayoutVK*)indirectCommandLayout);
+}
+
+static uint64_t NRI_CALL GetIndirectBufferDeviceAddress(const Buffer& buffer) {
+    return (uint64_t)((BufferVK&)buffer).GetDeviceAddress();
+}
+
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessSize(const IndirectCommandLayout& indirectCommandLayout, const Pipeline& pipeline, uint32_t sequenceMaxNum) {
+    return ((IndirectCommandLayoutVK&)indirectCommandLayout).GetPreprocessSize((PipelineVK&)pipeline, sequenceMaxNum);
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer& commandBuffer, const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    ((CommandBufferVK&)commandBuffer).ExecuteIndirectCommands(executeIndirectCommandsDesc);
+}
+
+Result DeviceVK::FillFunctionTable(IndirectCommandsInterface& table) const {
+    // Emulated on the CPU if "VK_EXT_device_generated_commands" is unsupported
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.GetIndirectBufferDeviceAddress = ::GetIndirectBufferDeviceAddress;
+    table.GetIndirectCommandsPreprocessSize = ::GetIndirectCommandsPreprocessSize;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Low latency  ]
 
@@ -871,7 +1123,7 @@ Result DeviceVK::FillFunctionTable(MeshShaderInterface& table) const {
 #pragma region[  RayTracing  ]
 
 static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& pipelineDesc, Pipeline*& pipeline) {
-    return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, pipelineDesc);
+    return ((DeviceVK&)device).CreatePipeline(pipeline, pipelineDesc);
 }
 
 static Result NRI_CALL CreateAccelerationStructureDescriptor(const AccelerationStructure& accelerationStructure, Descriptor*& descriptor) {
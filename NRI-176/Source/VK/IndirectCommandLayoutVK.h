@@ -0,0 +1,64 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct PipelineLayoutVK;
+struct PipelineVK;
+
+struct IndirectCommandLayoutVK final : public DebugNameBase {
+    inline IndirectCommandLayoutVK(DeviceVK& device)
+        : m_Device(device)
+        , m_Commands(device.GetStdAllocator()) {
+    }
+
+    inline operator VkIndirectCommandsLayoutEXT() const {
+        return m_Handle;
+    }
+
+    inline DeviceVK& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const IndirectCommandDesc* GetCommands() const {
+        return m_Commands.data();
+    }
+
+    inline uint32_t GetCommandNum() const {
+        return (uint32_t)m_Commands.size();
+    }
+
+    inline uint32_t GetStride() const {
+        return m_Stride;
+    }
+
+    inline VkShaderStageFlags GetShaderStages() const {
+        return m_ShaderStages;
+    }
+
+    ~IndirectCommandLayoutVK();
+
+    Result Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    uint64_t GetPreprocessSize(const PipelineVK& pipeline, uint32_t sequenceMaxNum) const;
+
+private:
+    DeviceVK& m_Device;
+    VkIndirectCommandsLayoutEXT m_Handle = VK_NULL_HANDLE; // NULL if emulated
+    Vector<IndirectCommandDesc> m_Commands;                // replayed on the CPU if emulated
+    VkShaderStageFlags m_ShaderStages = 0;
+    uint32_t m_Stride = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,118 @@
+// © 2025 NVIDIA Corporation
+
+IndirectCommandLayoutVK::~IndirectCommandLayoutVK() {
+    if (m_Handle) {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.DestroyIndirectCommandsLayoutEXT(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+    }
+}
+
+Result IndirectCommandLayoutVK::Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc) {
+    m_Commands.assign(indirectCommandLayoutDesc.commands, indirectCommandLayoutDesc.commands + indirectCommandLayoutDesc.commandNum);
+    m_Stride = indirectCommandLayoutDesc.stride;
+
+    const IndirectCommandDesc& actionCommand = indirectCommandLayoutDesc.commands[indirectCommandLayoutDesc.commandNum - 1];
+    if (actionCommand.type == IndirectCommandType::DISPATCH)
+        m_ShaderStages = VK_SHADER_STAGE_COMPUTE_BIT;
+    else
+        m_ShaderStages = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT;
+
+    // Emulation replays commands on the CPU, nothing else is needed
+    if (!m_Device.m_IsSupported.deviceGeneratedCommands)
+        return Result::SUCCESS;
+
+    m_ShaderStages &= m_Device.GetIndirectCommandsShaderStages();
+
+    const PipelineLayoutVK* pipelineLayoutVK = (PipelineLayoutVK*)indirectCommandLayoutDesc.pipelineLayout;
+    uint32_t commandNum = indirectCommandLayoutDesc.commandNum;
+
+    Scratch<VkIndirectCommandsLayoutTokenEXT> tokens = AllocateScratch(m_Device, VkIndirectCommandsLayoutTokenEXT, commandNum);
+    Scratch<VkIndirectCommandsPushConstantTokenEXT> pushConstantTokens = AllocateScratch(m_Device, VkIndirectCommandsPushConstantTokenEXT, commandNum);
+    Scratch<VkIndirectCommandsVertexBufferTokenEXT> vertexBufferTokens = AllocateScratch(m_Device, VkIndirectCommandsVertexBufferTokenEXT, commandNum);
+
+    VkIndirectCommandsIndexBufferTokenEXT indexBufferToken = {};
+    indexBufferToken.mode = VK_INDIRECT_COMMANDS_INPUT_MODE_VULKAN_INDEX_BUFFER_EXT; // matches "IndirectIndexBufferDesc"
+
+    for (uint32_t i = 0; i < commandNum; i++) {
+        const IndirectCommandDesc& in = indirectCommandLayoutDesc.commands[i];
+
+        VkIndirectCommandsLayoutTokenEXT& out = tokens[i];
+        out = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_EXT};
+        out.offset = in.offset;
+
+        switch (in.type) {
+            case IndirectCommandType::ROOT_CONSTANTS: {
+                const PushConstantBindingDesc& pushConstantBindingDesc = pipelineLayoutVK->GetBindingInfo().pushConstants[in.rootConstantIndex];
+
+                VkIndirectCommandsPushConstantTokenEXT& pushConstantToken = pushConstantTokens[i];
+                pushConstantToken.updateRange.stageFlags = pushConstantBindingDesc.stages;
+                pushConstantToken.updateRange.offset = pushConstantBindingDesc.offset;
+                pushConstantToken.updateRange.size = in.rootConstantSize;
+
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_EXT;
+                out.data.pPushConstant = &pushConstantToken;
+            } break;
+            case IndirectCommandType::VERTEX_BUFFER: {
+                VkIndirectCommandsVertexBufferTokenEXT& vertexBufferToken = vertexBufferTokens[i];
+                vertexBufferToken.vertexBindingUnit = in.vertexBufferSlot;
+
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT;
+                out.data.pVertexBuffer = &vertexBufferToken;
+            } break;
+            case IndirectCommandType::INDEX_BUFFER:
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_INDEX_BUFFER_EXT;
+                out.data.pIndexBuffer = &indexBufferToken;
+                break;
+            case IndirectCommandType::DRAW:
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_EXT;
+                break;
+            case IndirectCommandType::DRAW_INDEXED:
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_INDEXED_EXT;
+                break;
+            case IndirectCommandType::DISPATCH:
+                out.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DISPATCH_EXT;
+                break;
+            default:
+                CHECK(false, "Unexpected");
+                break;
+        }
+    }
+
+    VkIndirectCommandsLayoutCreateInfoEXT createInfo = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_EXT};
+    createInfo.shaderStages = m_ShaderStages;
+    createInfo.indirectStride = m_Stride;
+    createInfo.pipelineLayout = pipelineLayoutVK ? (VkPipelineLayout)*pipelineLayoutVK : VK_NULL_HANDLE;
+    createInfo.tokenCount = commandNum;
+    createInfo.pTokens = tokens;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateIndirectCommandsLayoutEXT(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateIndirectCommandsLayoutEXT");
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE void IndirectCommandLayoutVK::SetDebugName(const char* name) {
+    if (m_Handle)
+        m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE uint64_t IndirectCommandLayoutVK::GetPreprocessSize(const PipelineVK& pipeline, uint32_t sequenceMaxNum) const {
+    if (!m_Handle)
+        return 0;
+
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    pipelineInfo.pipeline = pipeline;
+
+    VkGeneratedCommandsMemoryRequirementsInfoEXT info = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_EXT};
+    info.pNext = &pipelineInfo;
+    info.indirectCommandsLayout = m_Handle;
+    info.maxSequenceCount = sequenceMaxNum;
+
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetGeneratedCommandsMemoryRequirementsEXT(m_Device, &info, &requirements);
+
+    return requirements.memoryRequirements.size;
+}
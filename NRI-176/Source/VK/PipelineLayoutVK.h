@@ -30,7 +30,15 @@ struct PipelineLayoutVK final : public DebugNameBase {
         : m_Device(device)
         , m_BindingInfo(device.GetStdAllocator())
         , m_DescriptorSetLayouts(device.GetStdAllocator())
-        , m_ImmutableSamplers(device.GetStdAllocator()) {
+        , m_UpdateTemplates(device.GetStdAllocator())
+        , m_DynamicOffsetNums(device.GetStdAllocator())
+        , m_DescriptorSetSizes(device.GetStdAllocator())
+        , m_BindingOffsets(device.GetStdAllocator())
+        , m_BindingOffsetBases(device.GetStdAllocator())
+        , m_SetLayouts(device.GetStdAllocator())
+        , m_PushConstantRanges(device.GetStdAllocator())
+        , m_ImmutableSamplers(device.GetStdAllocator())
+        , m_UniqueId(device.GenerateUniqueId()) {
     }
 
     inline operator VkPipelineLayout() const {
@@ -49,6 +57,55 @@ struct PipelineLayoutVK final : public DebugNameBase {
         return m_DescriptorSetLayouts[setIndex];
     }
 
+    inline VkDescriptorUpdateTemplate GetUpdateTemplate(uint32_t setIndex) const {
+        return m_UpdateTemplates[setIndex];
+    }
+
+    inline VkDescriptorUpdateTemplate GetRootDescriptorTemplate(BindPoint bindPoint) const {
+        return m_RootDescriptorTemplates[(size_t)bindPoint];
+    }
+
+    inline VkDescriptorUpdateTemplate GetRootSamplerTemplate(BindPoint bindPoint) const {
+        return m_RootSamplerTemplates[(size_t)bindPoint];
+    }
+
+    inline VkDescriptorType GetRootDescriptorType(uint32_t rootDescriptorIndex) const {
+        return m_RootDescriptorTypes[rootDescriptorIndex];
+    }
+
+    inline uint32_t GetDynamicOffsetNum(uint32_t setIndex) const {
+        return m_DynamicOffsetNums[setIndex];
+    }
+
+    inline uint64_t GetDescriptorSetSize(uint32_t setIndex) const {
+        return m_DescriptorSetSizes[setIndex];
+    }
+
+    inline const uint64_t* GetBindingOffsets(uint32_t setIndex) const {
+        return m_BindingOffsets.data() + m_BindingOffsetBases[setIndex];
+    }
+
+    inline const Vector<VkDescriptorSetLayout>& GetSetLayouts() const {
+        return m_SetLayouts;
+    }
+
+    inline const Vector<VkPushConstantRange>& GetPushConstantRanges() const {
+        return m_PushConstantRanges;
+    }
+
+    // Identifies the layout in device caches, since a destroyed layout handle can be reused by a new (different) layout
+    inline uint64_t GetUniqueId() const {
+        return m_UniqueId;
+    }
+
+    inline uint64_t GetKey() const {
+        return m_Key;
+    }
+
+    inline void SetKey(uint64_t key) {
+        m_Key = key;
+    }
+
     ~PipelineLayoutVK();
 
     Result Create(const PipelineLayoutDesc& pipelineLayoutDesc);
@@ -61,13 +118,28 @@ struct PipelineLayoutVK final : public DebugNameBase {
 
 private:
     void CreateSetLayout(VkDescriptorSetLayout* setLayout, const DescriptorSetDesc& descriptorSetDesc, const RootSamplerDesc* rootSamplers, uint32_t rootSamplerNum, bool ignoreGlobalSPIRVOffsets, bool isPush);
+    void CreateUpdateTemplate(VkDescriptorUpdateTemplate* updateTemplate, VkDescriptorSetLayout setLayout, const DescriptorSetDesc& descriptorSetDesc);
+    void QueryDescriptorBufferLayout(VkDescriptorSetLayout setLayout, const DescriptorSetDesc& descriptorSetDesc);
+    void CreateRootTemplate(VkDescriptorUpdateTemplate* updateTemplate, BindPoint bindPoint, uint32_t baseBinding, uint32_t bindingNum, bool isSampler);
 
 private:
     DeviceVK& m_Device;
     VkPipelineLayout m_Handle = VK_NULL_HANDLE;
+    uint64_t m_Key = 0; // in the device pipeline layout cache
     BindingInfo m_BindingInfo;
     Vector<VkDescriptorSetLayout> m_DescriptorSetLayouts;
+    Vector<VkDescriptorUpdateTemplate> m_UpdateTemplates; // per "descriptorSets" entry, "VK_NULL_HANDLE" if a set can't be updated at once
+    Vector<uint32_t> m_DynamicOffsetNums; // per "descriptorSets" entry, number of "DYNAMIC_OFFSET" descriptors
+    Vector<uint64_t> m_DescriptorSetSizes; // per "descriptorSets" entry, "descriptor buffer" mode only
+    Vector<uint64_t> m_BindingOffsets; // per binding, sets go one after another, "descriptor buffer" mode only
+    Vector<uint32_t> m_BindingOffsetBases; // per "descriptorSets" entry, first binding of a set in "m_BindingOffsets"
+    Vector<VkDescriptorSetLayout> m_SetLayouts; // "register space" order, "shader object" mode only
+    Vector<VkPushConstantRange> m_PushConstantRanges; // "shader object" mode only
     Vector<VkSampler> m_ImmutableSamplers;
+    uint64_t m_UniqueId = 0;
+    std::array<VkDescriptorType, ROOT_DESCRIPTOR_MAX_NUM> m_RootDescriptorTypes = {};
+    std::array<VkDescriptorUpdateTemplate, (size_t)BindPoint::MAX_NUM> m_RootDescriptorTemplates = {}; // "push" templates per bind point, "INHERIT" is unused
+    std::array<VkDescriptorUpdateTemplate, (size_t)BindPoint::MAX_NUM> m_RootSamplerTemplates = {};    // "push" templates per bind point, "INHERIT" is unused
 };
 
 } // namespace nri
\ No newline at end of file
@@ -7,6 +7,15 @@ PipelineLayoutVK::~PipelineLayoutVK() {
     if (m_Handle)
         vk.DestroyPipelineLayout(m_Device, m_Handle, allocationCallbacks);
 
+    for (auto handle : m_UpdateTemplates)
+        vk.DestroyDescriptorUpdateTemplate(m_Device, handle, allocationCallbacks);
+
+    for (auto handle : m_RootDescriptorTemplates)
+        vk.DestroyDescriptorUpdateTemplate(m_Device, handle, allocationCallbacks);
+
+    for (auto handle : m_RootSamplerTemplates)
+        vk.DestroyDescriptorUpdateTemplate(m_Device, handle, allocationCallbacks);
+
     for (auto handle : m_DescriptorSetLayouts)
         vk.DestroyDescriptorSetLayout(m_Device, handle, allocationCallbacks);
 
@@ -62,9 +71,25 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
         m_BindingInfo.sets[i].ranges = m_BindingInfo.ranges.data() + m_BindingInfo.ranges.size();
         m_BindingInfo.ranges.insert(m_BindingInfo.ranges.end(), descriptorSetDesc.ranges, descriptorSetDesc.ranges + descriptorSetDesc.rangeNum);
 
+        uint32_t dynamicOffsetNum = 0;
         DescriptorRangeDesc* ranges = (DescriptorRangeDesc*)m_BindingInfo.sets[i].ranges;
-        for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++)
+        for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++) {
             ranges[j].baseRegisterIndex += bindingOffsets[(uint32_t)descriptorSetDesc.ranges[j].descriptorType];
+
+            if (ranges[j].flags & DescriptorRangeBits::DYNAMIC_OFFSET)
+                dynamicOffsetNum += ranges[j].descriptorNum;
+        }
+
+        m_DynamicOffsetNums.push_back(dynamicOffsetNum);
+
+        // Create update template or query descriptor buffer layout (uses binding info, i.e. offsets are already applied)
+        VkDescriptorUpdateTemplate updateTemplate = VK_NULL_HANDLE;
+        if (m_Device.m_IsSupported.descriptorBuffer)
+            QueryDescriptorBufferLayout(descriptorSetLayout, m_BindingInfo.sets[i]);
+        else
+            CreateUpdateTemplate(&updateTemplate, descriptorSetLayout, m_BindingInfo.sets[i]);
+
+        m_UpdateTemplates.push_back(updateTemplate);
     }
 
     // Root constants
@@ -110,6 +135,8 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
             // Binding info
             uint32_t registerIndex = rootDescriptorDesc.registerIndex + bindingOffsets[(uint32_t)rootDescriptorDesc.descriptorType];
             m_BindingInfo.pushDescriptors.push_back(registerIndex);
+
+            m_RootDescriptorTypes[i] = GetDescriptorType(rootDescriptorDesc.descriptorType);
         }
 
         // Root samplers
@@ -156,6 +183,15 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
         descriptorSetLayouts[setIndex] = m_DescriptorSetLayouts[pipelineLayoutDesc.descriptorSetNum];
     }
 
+    // Shader objects get created with set layouts and push constant ranges instead of a pipeline layout
+    if (m_Device.m_IsSupported.shaderObject) {
+        const VkDescriptorSetLayout* setLayouts = descriptorSetLayouts;
+        m_SetLayouts.insert(m_SetLayouts.end(), setLayouts, setLayouts + setNum);
+
+        const VkPushConstantRange* ranges = pushConstantRanges;
+        m_PushConstantRanges.insert(m_PushConstantRanges.end(), ranges, ranges + pipelineLayoutDesc.rootConstantNum);
+    }
+
     // Create pipeline layout
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
     pipelineLayoutCreateInfo.setLayoutCount = setNum;
@@ -167,6 +203,21 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
     VkResult vkResult = vk.CreatePipelineLayout(m_Device, &pipelineLayoutCreateInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreatePipelineLayout");
 
+    // Create "push" templates for root descriptors and samplers (a "push" template is tied to a bind point)
+    if (hasRootSet) {
+        constexpr std::array<BindPoint, 3> bindPoints = {BindPoint::GRAPHICS, BindPoint::COMPUTE, BindPoint::RAY_TRACING};
+        constexpr std::array<StageBits, 3> bindPointStages = {StageBits::GRAPHICS_SHADERS, StageBits::COMPUTE_SHADER, StageBits::RAY_TRACING_SHADERS};
+
+        for (size_t i = 0; i < bindPoints.size(); i++) {
+            if (pipelineLayoutDesc.shaderStages != StageBits::ALL && !(pipelineLayoutDesc.shaderStages & bindPointStages[i]))
+                continue;
+
+            BindPoint bindPoint = bindPoints[i];
+            CreateRootTemplate(&m_RootDescriptorTemplates[(size_t)bindPoint], bindPoint, 0, pipelineLayoutDesc.rootDescriptorNum, false);
+            CreateRootTemplate(&m_RootSamplerTemplates[(size_t)bindPoint], bindPoint, pipelineLayoutDesc.rootDescriptorNum, pipelineLayoutDesc.rootSamplerNum, true);
+        }
+    }
+
     return Result::SUCCESS;
 }
 
@@ -248,7 +299,7 @@ void PipelineLayoutVK::CreateSetLayout(VkDescriptorSetLayout* setLayout, const D
                 binding.descriptorType = VK_DESCRIPTOR_TYPE_MUTABLE_EXT;
                 mutableTypeLists[bindingNum] = mutableTypeList;
             } else {
-                binding.descriptorType = GetDescriptorType(range.descriptorType);
+                binding.descriptorType = GetDescriptorType(range);
                 mutableTypeLists[bindingNum] = {};
             }
 
@@ -304,11 +355,113 @@ void PipelineLayoutVK::CreateSetLayout(VkDescriptorSetLayout* setLayout, const D
     if (isPush)
         info.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT;
 
+    // Descriptor buffers are always "update after bind" and "partially bound"
+    if (m_Device.m_IsSupported.descriptorBuffer) {
+        info.flags &= ~VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        info.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
+        for (uint32_t i = 0; i < bindingNum; i++)
+            bindingFlags[i] &= ~(VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateDescriptorSetLayout(m_Device, &info, m_Device.GetVkAllocationCallbacks(), setLayout);
     RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateDescriptorSetLayout");
 }
 
+void PipelineLayoutVK::CreateUpdateTemplate(VkDescriptorUpdateTemplate* updateTemplate, VkDescriptorSetLayout setLayout, const DescriptorSetDesc& descriptorSetDesc) {
+    // The size of a variable sized array is unknown until allocation, a template entry can't have a "mutable" type
+    for (uint32_t i = 0; i < descriptorSetDesc.rangeNum; i++) {
+        if (descriptorSetDesc.ranges[i].flags & (DescriptorRangeBits::VARIABLE_SIZED_ARRAY | DescriptorRangeBits::MUTABLE))
+            return;
+    }
+
+    if (!descriptorSetDesc.rangeNum)
+        return;
+
+    // Ranges are tightly packed one after another, a non-array range spans consecutive bindings
+    Scratch<VkDescriptorUpdateTemplateEntry> entries = AllocateScratch(m_Device, VkDescriptorUpdateTemplateEntry, descriptorSetDesc.rangeNum);
+    size_t offset = 0;
+
+    for (uint32_t i = 0; i < descriptorSetDesc.rangeNum; i++) {
+        const DescriptorRangeDesc& range = descriptorSetDesc.ranges[i];
+
+        VkDescriptorUpdateTemplateEntry& entry = entries[i];
+        entry.dstBinding = range.baseRegisterIndex;
+        entry.dstArrayElement = 0;
+        entry.descriptorCount = range.descriptorNum;
+        entry.descriptorType = GetDescriptorType(range);
+        entry.offset = offset;
+        entry.stride = sizeof(DescriptorUpdateData);
+
+        offset += range.descriptorNum * sizeof(DescriptorUpdateData);
+    }
+
+    VkDescriptorUpdateTemplateCreateInfo info = {VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO};
+    info.descriptorUpdateEntryCount = descriptorSetDesc.rangeNum;
+    info.pDescriptorUpdateEntries = entries;
+    info.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    info.descriptorSetLayout = setLayout;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateDescriptorUpdateTemplate(m_Device, &info, m_Device.GetVkAllocationCallbacks(), updateTemplate);
+    RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateDescriptorUpdateTemplate");
+}
+
+void PipelineLayoutVK::QueryDescriptorBufferLayout(VkDescriptorSetLayout setLayout, const DescriptorSetDesc& descriptorSetDesc) {
+    const auto& vk = m_Device.GetDispatchTable();
+
+    VkDeviceSize size = 0;
+    vk.GetDescriptorSetLayoutSizeEXT(m_Device, setLayout, &size);
+
+    m_DescriptorSetSizes.push_back(size);
+    m_BindingOffsetBases.push_back((uint32_t)m_BindingOffsets.size());
+
+    // Bindings go in the same order as in "CreateSetLayout"
+    for (uint32_t i = 0; i < descriptorSetDesc.rangeNum; i++) {
+        const DescriptorRangeDesc& range = descriptorSetDesc.ranges[i];
+
+        bool isArray = range.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+        uint32_t bindingNum = isArray ? 1 : range.descriptorNum;
+
+        for (uint32_t j = 0; j < bindingNum; j++) {
+            VkDeviceSize offset = 0;
+            vk.GetDescriptorSetLayoutBindingOffsetEXT(m_Device, setLayout, range.baseRegisterIndex + j, &offset);
+
+            m_BindingOffsets.push_back(offset);
+        }
+    }
+}
+
+void PipelineLayoutVK::CreateRootTemplate(VkDescriptorUpdateTemplate* updateTemplate, BindPoint bindPoint, uint32_t baseBinding, uint32_t bindingNum, bool isSampler) {
+    if (!bindingNum)
+        return;
+
+    // Root descriptors use one "DescriptorUpdateData" per binding, root samplers are immutable and share a single dummy one
+    Scratch<VkDescriptorUpdateTemplateEntry> entries = AllocateScratch(m_Device, VkDescriptorUpdateTemplateEntry, bindingNum);
+    for (uint32_t i = 0; i < bindingNum; i++) {
+        VkDescriptorUpdateTemplateEntry& entry = entries[i];
+        entry.dstBinding = m_BindingInfo.pushDescriptors[baseBinding + i];
+        entry.dstArrayElement = 0;
+        entry.descriptorCount = 1;
+        entry.descriptorType = isSampler ? VK_DESCRIPTOR_TYPE_SAMPLER : m_RootDescriptorTypes[i];
+        entry.offset = isSampler ? 0 : i * sizeof(DescriptorUpdateData);
+        entry.stride = sizeof(DescriptorUpdateData);
+    }
+
+    VkDescriptorUpdateTemplateCreateInfo info = {VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO};
+    info.descriptorUpdateEntryCount = bindingNum;
+    info.pDescriptorUpdateEntries = entries;
+    info.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS;
+    info.pipelineBindPoint = GetPipelineBindPoint(bindPoint);
+    info.pipelineLayout = m_Handle;
+    info.set = m_BindingInfo.rootRegisterSpace;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateDescriptorUpdateTemplate(m_Device, &info, m_Device.GetVkAllocationCallbacks(), updateTemplate);
+    RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateDescriptorUpdateTemplate");
+}
+
 NRI_INLINE void PipelineLayoutVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_PIPELINE_LAYOUT, (uint64_t)m_Handle, name);
 }
@@ -4,13 +4,42 @@
 
 namespace nri {
 
+// Fixed-function state, emitted by "CmdSetPipeline" in "shader object" mode (see "enableVKShaderObject")
+struct ShaderObjectState {
+    ShaderObjectState(StdAllocator<uint8_t>& allocator)
+        : vertexBindings(allocator)
+        , vertexAttributes(allocator)
+        , colors(allocator) {
+    }
+
+    Vector<VkVertexInputBindingDescription2EXT> vertexBindings; // strides come from "CmdSetVertexBuffers"
+    Vector<VkVertexInputAttributeDescription2EXT> vertexAttributes;
+    Vector<ColorAttachmentDesc> colors;
+    std::array<VkShaderStageFlagBits, 7> stages;
+    std::array<VkShaderEXT, 7> shaders; // owned by the device, referenced until destruction
+    std::array<uint64_t, 7> shaderKeys;
+    uint32_t stageNum;
+    InputAssemblyDesc inputAssembly;
+    RasterizationDesc rasterization;
+    MultisampleDesc multisample;
+    DepthAttachmentDesc depth;
+    StencilAttachmentDesc stencil;
+    LogicOp logicOp;
+    DynamicStateBits dynamicState; // set by the app
+    bool hasVertexStage;
+    bool hasTessellationStages;
+};
+
 struct PipelineVK final : public DebugNameBase {
     inline PipelineVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_ShaderModuleKeys(device.GetStdAllocator()) {
     }
 
     inline operator VkPipeline() const {
-        return m_Handle;
+        VkPipeline optimizedHandle = m_OptimizedHandle.load(std::memory_order_acquire);
+
+        return optimizedHandle ? optimizedHandle : m_Handle;
     }
 
     inline DeviceVK& GetDevice() const {
@@ -25,6 +54,18 @@ struct PipelineVK final : public DebugNameBase {
         return m_DepthBias;
     }
 
+    inline const ShaderObjectState* GetShaderObjectState() const {
+        return m_ShaderObjectState;
+    }
+
+    inline const PipelineStats& GetStats() const {
+        return m_Stats;
+    }
+
+    inline void SetCreationTime(uint64_t creationTime) {
+        m_Stats.creationTime = creationTime;
+    }
+
     ~PipelineVK();
 
     Result Create(const GraphicsPipelineDesc& graphicsPipelineDesc);
@@ -43,15 +84,29 @@ struct PipelineVK final : public DebugNameBase {
     //================================================================================================================
 
     Result WriteShaderGroupIdentifiers(uint32_t baseShaderGroupIndex, uint32_t shaderGroupNum, void* dst) const;
+    Result Optimize();
 
 private:
-    Result SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, const ShaderDesc& shaderDesc, VkShaderModule& module);
+    Result SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, VkShaderModuleCreateInfo& moduleInfo, const ShaderDesc& shaderDesc);
+    Result CreateFromLibraries(const VkGraphicsPipelineCreateInfo& graphicsPipelineCreateInfo, uint64_t layoutId);
+    Result LinkLibraries(VkPipelineCreateFlags flags, VkPipeline& pipeline, VkPipelineCreationFeedback* pipelineFeedback) const;
+    Result CreateShaderObjects(const GraphicsPipelineDesc& graphicsPipelineDesc);
+    void ProcessFeedback(const VkPipelineCreationFeedback& pipelineFeedback, const VkPipelineCreationFeedback* stageFeedbacks, uint32_t stageFeedbackNum);
 
 private:
     DeviceVK& m_Device;
+    Vector<uint64_t> m_ShaderModuleKeys; // modules are owned by the device, referenced until destruction
     VkPipeline m_Handle = VK_NULL_HANDLE;
+    std::atomic<VkPipeline> m_OptimizedHandle = VK_NULL_HANDLE;
+    std::array<VkPipeline, 4> m_Libraries = {}; // owned by the device, referenced until destruction
+    std::array<uint64_t, 4> m_LibraryKeys = {};
+    VkPipelineLayout m_Layout = VK_NULL_HANDLE;
+    ShaderObjectState* m_ShaderObjectState = nullptr;
+    VkPipelineCreateFlags m_LinkFlags = 0;
+    uint32_t m_LibraryNum = 0;
     VkPipelineBindPoint m_BindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     DepthBiasDesc m_DepthBias = {};
+    PipelineStats m_Stats = {};
     bool m_OwnsNativeObjects = true;
 };
 
@@ -4,6 +4,26 @@ static inline bool IsConstantColorReferenced(BlendFactor factor) {
     return factor == BlendFactor::CONSTANT_COLOR || factor == BlendFactor::CONSTANT_ALPHA || factor == BlendFactor::ONE_MINUS_CONSTANT_COLOR || factor == BlendFactor::ONE_MINUS_CONSTANT_ALPHA;
 }
 
+static inline VkPrimitiveTopology GetTopologyClass(VkPrimitiveTopology topology) {
+    switch (topology) {
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        default:
+            return topology;
+    }
+}
+
 static bool FillPipelineRobustness(const DeviceVK& device, Robustness robustness, VkPipelineRobustnessCreateInfoEXT& robustnessInfo) {
     if (!device.m_IsSupported.pipelineRobustness || robustness == Robustness::DEFAULT)
         return false;
@@ -33,27 +53,314 @@ static bool FillPipelineRobustness(const DeviceVK& device, Robustness robustness
     return true;
 }
 
+static void SerializeStructChain(Vector<uint8_t>& blob, const void* next) {
+    VkGraphicsPipelineLibraryFlagsEXT parts = 0;
+
+    for (const VkBaseInStructure* base = (const VkBaseInStructure*)next; base; base = base->pNext) {
+        AppendValue(blob, base->sType);
+
+        switch (base->sType) {
+            case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT: {
+                const auto& s = *(const VkGraphicsPipelineLibraryCreateInfoEXT*)base;
+                AppendValue(blob, s.flags);
+
+                parts = s.flags;
+            } break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO: {
+                const auto& s = *(const VkPipelineRenderingCreateInfo*)base;
+                AppendValue(blob, s.viewMask);
+
+                // Only the output interface depends on attachment formats
+                if (parts & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) {
+                    AppendBytes(blob, s.pColorAttachmentFormats, s.colorAttachmentCount * sizeof(VkFormat));
+                    AppendValue(blob, s.depthAttachmentFormat);
+                    AppendValue(blob, s.stencilAttachmentFormat);
+                }
+            } break;
+            case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT: {
+                const auto& s = *(const VkPipelineRobustnessCreateInfoEXT*)base;
+                AppendValue(blob, s.storageBuffers);
+                AppendValue(blob, s.uniformBuffers);
+                AppendValue(blob, s.vertexInputs);
+                AppendValue(blob, s.images);
+            } break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: {
+                const auto& s = *(const VkPipelineRasterizationConservativeStateCreateInfoEXT*)base;
+                AppendValue(blob, s.conservativeRasterizationMode);
+                AppendValue(blob, s.extraPrimitiveOverestimationSize);
+            } break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_KHR: {
+                const auto& s = *(const VkPipelineRasterizationLineStateCreateInfoKHR*)base;
+                AppendValue(blob, s.lineRasterizationMode);
+                AppendValue(blob, s.stippledLineEnable);
+            } break;
+            case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: {
+                const auto& s = *(const VkPipelineSampleLocationsStateCreateInfoEXT*)base;
+                AppendValue(blob, s.sampleLocationsEnable);
+            } break;
+            default:
+                break;
+        }
+    }
+}
+
+// Serializes everything a pipeline library part is created from, states not belonging to the part are expected to be NULL
+static void SerializePipelineLibrary(const VkGraphicsPipelineCreateInfo& info, uint64_t layoutId, Vector<uint8_t>& blob) {
+    AppendValue(blob, info.layout ? layoutId : 0); // not the handle, which can be reused
+    AppendValue(blob, info.flags);
+    SerializeStructChain(blob, info.pNext);
+
+    for (uint32_t i = 0; i < info.stageCount; i++) {
+        const VkPipelineShaderStageCreateInfo& stage = info.pStages[i];
+        AppendValue(blob, stage.stage);
+        AppendBytes(blob, stage.pName, std::strlen(stage.pName));
+
+        // Modules are unique per bytecode and live as long as any pipeline created from them, i.e. as long as this library
+        if (stage.module)
+            AppendValue(blob, stage.module);
+        else {
+            const VkShaderModuleCreateInfo& moduleInfo = *(const VkShaderModuleCreateInfo*)stage.pNext;
+            AppendBytes(blob, moduleInfo.pCode, moduleInfo.codeSize);
+        }
+    }
+
+    if (info.pVertexInputState) {
+        const VkPipelineVertexInputStateCreateInfo& s = *info.pVertexInputState;
+        AppendBytes(blob, s.pVertexBindingDescriptions, s.vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription));
+        AppendBytes(blob, s.pVertexAttributeDescriptions, s.vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription));
+    }
+
+    if (info.pInputAssemblyState) {
+        AppendValue(blob, info.pInputAssemblyState->topology);
+        AppendValue(blob, info.pInputAssemblyState->primitiveRestartEnable);
+    }
+
+    if (info.pTessellationState)
+        AppendValue(blob, info.pTessellationState->patchControlPoints);
+
+    if (info.pViewportState) {
+        AppendValue(blob, info.pViewportState->viewportCount);
+        AppendValue(blob, info.pViewportState->scissorCount);
+    }
+
+    if (info.pRasterizationState) {
+        const VkPipelineRasterizationStateCreateInfo& s = *info.pRasterizationState;
+        AppendValue(blob, s.depthClampEnable);
+        AppendValue(blob, s.rasterizerDiscardEnable);
+        AppendValue(blob, s.polygonMode);
+        AppendValue(blob, s.cullMode);
+        AppendValue(blob, s.frontFace);
+        AppendValue(blob, s.depthBiasEnable);
+        AppendValue(blob, s.depthBiasConstantFactor);
+        AppendValue(blob, s.depthBiasClamp);
+        AppendValue(blob, s.depthBiasSlopeFactor);
+        AppendValue(blob, s.lineWidth);
+        SerializeStructChain(blob, s.pNext);
+    }
+
+    if (info.pMultisampleState) {
+        const VkPipelineMultisampleStateCreateInfo& s = *info.pMultisampleState;
+        AppendValue(blob, s.rasterizationSamples);
+        AppendValue(blob, s.sampleShadingEnable);
+        AppendValue(blob, s.minSampleShading);
+        AppendValue(blob, s.pSampleMask ? *s.pSampleMask : ~0u);
+        AppendValue(blob, s.alphaToCoverageEnable);
+        AppendValue(blob, s.alphaToOneEnable);
+        SerializeStructChain(blob, s.pNext);
+    }
+
+    if (info.pDepthStencilState) {
+        const VkPipelineDepthStencilStateCreateInfo& s = *info.pDepthStencilState;
+        AppendValue(blob, s.depthTestEnable);
+        AppendValue(blob, s.depthWriteEnable);
+        AppendValue(blob, s.depthCompareOp);
+        AppendValue(blob, s.depthBoundsTestEnable);
+        AppendValue(blob, s.stencilTestEnable);
+        AppendValue(blob, s.front);
+        AppendValue(blob, s.back);
+        AppendValue(blob, s.minDepthBounds);
+        AppendValue(blob, s.maxDepthBounds);
+    }
+
+    if (info.pColorBlendState) {
+        const VkPipelineColorBlendStateCreateInfo& s = *info.pColorBlendState;
+        AppendValue(blob, s.logicOpEnable);
+        AppendValue(blob, s.logicOp);
+        AppendValue(blob, s.blendConstants);
+        AppendBytes(blob, s.pAttachments, s.attachmentCount * sizeof(VkPipelineColorBlendAttachmentState));
+    }
+
+    if (info.pDynamicState) {
+        const VkPipelineDynamicStateCreateInfo& s = *info.pDynamicState;
+        AppendBytes(blob, s.pDynamicStates, s.dynamicStateCount * sizeof(VkDynamicState));
+    }
+}
+
+// Stable hashes are computed from NRI descs field by field, i.e. handles, pointers and padding are not hashed
+static void HashShader(uint64_t& hash, const ShaderDesc& shaderDesc) {
+    const char* entryPointName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
+
+    HashValue(hash, shaderDesc.stage);
+    hash = ComputeHash(shaderDesc.bytecode, (size_t)shaderDesc.size, hash);
+    hash = ComputeHash(entryPointName, std::strlen(entryPointName), hash);
+}
+
+static void HashStencil(uint64_t& hash, const StencilDesc& stencilDesc) {
+    HashValue(hash, stencilDesc.compareOp);
+    HashValue(hash, stencilDesc.failOp);
+    HashValue(hash, stencilDesc.passOp);
+    HashValue(hash, stencilDesc.depthFailOp);
+    HashValue(hash, stencilDesc.writeMask);
+    HashValue(hash, stencilDesc.compareMask);
+}
+
+static uint64_t HashPipelineDesc(const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    uint64_t hash = ComputeHash(nullptr, 0);
+
+    for (uint32_t i = 0; i < graphicsPipelineDesc.shaderNum; i++)
+        HashShader(hash, graphicsPipelineDesc.shaders[i]);
+
+    if (graphicsPipelineDesc.vertexInput) {
+        const VertexInputDesc& vi = *graphicsPipelineDesc.vertexInput;
+
+        for (uint32_t i = 0; i < vi.attributeNum; i++) {
+            const VertexAttributeDesc& attribute = vi.attributes[i];
+            HashValue(hash, attribute.vk.location);
+            HashValue(hash, attribute.offset);
+            HashValue(hash, attribute.format);
+            HashValue(hash, attribute.streamIndex);
+        }
+
+        for (uint32_t i = 0; i < vi.streamNum; i++) {
+            HashValue(hash, vi.streams[i].bindingSlot);
+            HashValue(hash, vi.streams[i].stepRate);
+        }
+    }
+
+    const InputAssemblyDesc& ia = graphicsPipelineDesc.inputAssembly;
+    HashValue(hash, ia.topology);
+    HashValue(hash, ia.tessControlPointNum);
+    HashValue(hash, ia.primitiveRestart);
+
+    const RasterizationDesc& r = graphicsPipelineDesc.rasterization;
+    HashValue(hash, r.depthBias.constant);
+    HashValue(hash, r.depthBias.clamp);
+    HashValue(hash, r.depthBias.slope);
+    HashValue(hash, r.fillMode);
+    HashValue(hash, r.cullMode);
+    HashValue(hash, r.frontCounterClockwise);
+    HashValue(hash, r.depthClamp);
+    HashValue(hash, r.lineSmoothing);
+    HashValue(hash, r.conservativeRaster);
+    HashValue(hash, r.shadingRate);
+
+    if (graphicsPipelineDesc.multisample) {
+        const MultisampleDesc& ms = *graphicsPipelineDesc.multisample;
+        HashValue(hash, ms.sampleMask);
+        HashValue(hash, ms.sampleNum);
+        HashValue(hash, ms.alphaToCoverage);
+        HashValue(hash, ms.sampleLocations);
+    }
+
+    const OutputMergerDesc& om = graphicsPipelineDesc.outputMerger;
+    for (uint32_t i = 0; i < om.colorNum; i++) {
+        const ColorAttachmentDesc& color = om.colors[i];
+        HashValue(hash, color.format);
+        HashValue(hash, color.colorBlend.srcFactor);
+        HashValue(hash, color.colorBlend.dstFactor);
+        HashValue(hash, color.colorBlend.op);
+        HashValue(hash, color.alphaBlend.srcFactor);
+        HashValue(hash, color.alphaBlend.dstFactor);
+        HashValue(hash, color.alphaBlend.op);
+        HashValue(hash, color.colorWriteMask);
+        HashValue(hash, color.blendEnabled);
+    }
+
+    HashValue(hash, om.depth.compareOp);
+    HashValue(hash, om.depth.write);
+    HashValue(hash, om.depth.boundsTest);
+    HashStencil(hash, om.stencil.front);
+    HashStencil(hash, om.stencil.back);
+    HashValue(hash, om.depthStencilFormat);
+    HashValue(hash, om.logicOp);
+    HashValue(hash, om.viewMask);
+    HashValue(hash, om.multiview);
+
+    HashValue(hash, graphicsPipelineDesc.robustness);
+    HashValue(hash, graphicsPipelineDesc.dynamicState);
+
+    return hash;
+}
+
+static uint64_t HashPipelineDesc(const ComputePipelineDesc& computePipelineDesc) {
+    uint64_t hash = ComputeHash(nullptr, 0);
+    HashShader(hash, computePipelineDesc.shader);
+    HashValue(hash, computePipelineDesc.robustness);
+
+    return hash;
+}
+
+static uint64_t HashPipelineDesc(const RayTracingPipelineDesc& rayTracingPipelineDesc) {
+    uint64_t hash = ComputeHash(nullptr, 0);
+
+    for (uint32_t i = 0; i < rayTracingPipelineDesc.shaderLibrary->shaderNum; i++)
+        HashShader(hash, rayTracingPipelineDesc.shaderLibrary->shaders[i]);
+
+    for (uint32_t i = 0; i < rayTracingPipelineDesc.shaderGroupNum; i++)
+        HashValue(hash, rayTracingPipelineDesc.shaderGroups[i].shaderIndices);
+
+    HashValue(hash, rayTracingPipelineDesc.recursionMaxDepth);
+    HashValue(hash, rayTracingPipelineDesc.rayPayloadMaxSize);
+    HashValue(hash, rayTracingPipelineDesc.rayHitAttributeMaxSize);
+    HashValue(hash, rayTracingPipelineDesc.flags);
+    HashValue(hash, rayTracingPipelineDesc.robustness);
+
+    return hash;
+}
+
 PipelineVK::~PipelineVK() {
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
         vk.DestroyPipeline(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+        vk.DestroyPipeline(m_Device, m_OptimizedHandle.load(), m_Device.GetVkAllocationCallbacks());
     }
+
+    for (uint32_t i = 0; i < m_LibraryNum; i++)
+        m_Device.ReleasePipelineLibrary(m_LibraryKeys[i]);
+
+    for (uint64_t key : m_ShaderModuleKeys)
+        m_Device.ReleaseShaderModule(key);
+
+    if (m_ShaderObjectState) {
+        for (uint32_t i = 0; i < m_ShaderObjectState->stageNum; i++) {
+            if (m_ShaderObjectState->shaders[i])
+                m_Device.ReleaseShaderObject(m_ShaderObjectState->shaderKeys[i]);
+        }
+    }
+
+    Destroy(m_Device.GetAllocationCallbacks(), m_ShaderObjectState);
 }
 
 Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     m_BindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    m_Stats.hash = HashPipelineDesc(graphicsPipelineDesc);
+    m_Stats.stageNum = graphicsPipelineDesc.shaderNum;
+
+    // Shader objects can't have per-pipeline robustness, such pipelines are created as usual
+    VkPipelineRobustnessCreateInfoEXT robustnessInfo = {VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT};
+    bool hasRobustness = FillPipelineRobustness(m_Device, graphicsPipelineDesc.robustness, robustnessInfo);
+
+    if (m_Device.m_IsSupported.shaderObject && !hasRobustness)
+        return CreateShaderObjects(graphicsPipelineDesc);
 
     // Shaders
     Scratch<VkPipelineShaderStageCreateInfo> stages = AllocateScratch(m_Device, VkPipelineShaderStageCreateInfo, graphicsPipelineDesc.shaderNum);
-    Scratch<VkShaderModule> modules = AllocateScratch(m_Device, VkShaderModule, graphicsPipelineDesc.shaderNum);
+    Scratch<VkShaderModuleCreateInfo> moduleInfos = AllocateScratch(m_Device, VkShaderModuleCreateInfo, graphicsPipelineDesc.shaderNum);
 
     for (uint32_t i = 0; i < graphicsPipelineDesc.shaderNum; i++) {
-        const ShaderDesc& shaderDesc = graphicsPipelineDesc.shaders[i];
-        Result res = SetupShaderStage(stages[i], shaderDesc, modules[i]);
+        Result res = SetupShaderStage(stages[i], moduleInfos[i], graphicsPipelineDesc.shaders[i]);
         if (res != Result::SUCCESS)
             return res;
-
-        stages[i].pName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
     }
 
     // Vertex input
@@ -232,26 +539,85 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     pipelineRenderingCreateInfo.depthAttachmentFormat = GetVkFormat(om.depthStencilFormat);
     pipelineRenderingCreateInfo.stencilAttachmentFormat = depthStencilFormatProps.isStencil ? GetVkFormat(om.depthStencilFormat) : VK_FORMAT_UNDEFINED;
 
+    // Baked values of dynamic states are reset to defaults, so pipelines (and pipeline libraries) differing only in dynamic states are identical
+    const DynamicStateBits dynamicStateBits = graphicsPipelineDesc.dynamicState;
+    const bool isDepthBoundsTestSupported = m_Device.GetDesc().features.depthBoundsTest;
+
+    if (dynamicStateBits & DynamicStateBits::TOPOLOGY)
+        inputAssemblyState.topology = GetTopologyClass(inputAssemblyState.topology);
+
+    if (dynamicStateBits & DynamicStateBits::CULL_MODE) {
+        rasterizationState.cullMode = VK_CULL_MODE_NONE;
+        rasterizationState.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    }
+
+    if (dynamicStateBits & DynamicStateBits::DEPTH) {
+        depthStencilState.depthTestEnable = VK_FALSE;
+        depthStencilState.depthWriteEnable = VK_FALSE;
+        depthStencilState.depthCompareOp = VK_COMPARE_OP_NEVER;
+        depthStencilState.depthBoundsTestEnable = VK_FALSE;
+    }
+
+    if (dynamicStateBits & DynamicStateBits::STENCIL) {
+        depthStencilState.stencilTestEnable = VK_FALSE;
+        depthStencilState.front = {};
+        depthStencilState.back = {};
+    }
+
+    if (dynamicStateBits & DynamicStateBits::BLEND) {
+        for (uint32_t i = 0; i < om.colorNum; i++)
+            attachments[i] = {};
+    }
+
     // Dynamic state
     uint32_t dynamicStateNum = 0;
-    std::array<VkDynamicState, 16> dynamicStates;
+    std::array<VkDynamicState, 32> dynamicStates;
     dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT;
     dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT;
     if (vi)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE;
     if (rasterizationState.depthBiasEnable)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BIAS;
-    if (depthStencilState.depthBoundsTestEnable)
+    if (da.boundsTest || ((dynamicStateBits & DynamicStateBits::DEPTH) && isDepthBoundsTestSupported))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BOUNDS;
-    if (depthStencilState.stencilTestEnable)
+    if (depthStencilState.stencilTestEnable || (dynamicStateBits & DynamicStateBits::STENCIL))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_REFERENCE;
     if (sampleLocationsState.sampleLocationsEnable)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT;
-    if (isConstantColorReferenced)
+    if (isConstantColorReferenced || (dynamicStateBits & DynamicStateBits::BLEND))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_BLEND_CONSTANTS;
     if (r.shadingRate)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
 
+    if (dynamicStateBits & DynamicStateBits::TOPOLOGY)
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY;
+
+    if (dynamicStateBits & DynamicStateBits::CULL_MODE) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_CULL_MODE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_FRONT_FACE;
+    }
+
+    if (dynamicStateBits & DynamicStateBits::DEPTH) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_COMPARE_OP;
+        if (isDepthBoundsTestSupported)
+            dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE;
+    }
+
+    if (dynamicStateBits & DynamicStateBits::STENCIL) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_OP;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_WRITE_MASK;
+    }
+
+    if (dynamicStateBits & DynamicStateBits::BLEND) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT;
+    }
+
     VkPipelineDynamicStateCreateInfo dynamicState = {VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
     dynamicState.dynamicStateCount = dynamicStateNum;
     dynamicState.pDynamicStates = dynamicStates.data();
@@ -260,6 +626,8 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     VkPipelineCreateFlags flags = 0;
     if (r.shadingRate)
         flags |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)graphicsPipelineDesc.pipelineLayout;
 
@@ -285,52 +653,53 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
         -1,
     };
 
-    VkPipelineRobustnessCreateInfoEXT robustnessInfo = {VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT};
-    if (FillPipelineRobustness(m_Device, graphicsPipelineDesc.robustness, robustnessInfo))
+    if (hasRobustness)
         pipelineRenderingCreateInfo.pNext = &robustnessInfo;
 
+    if (m_Device.m_IsSupported.graphicsPipelineLibrary)
+        return CreateFromLibraries(info, pipelineLayoutVK.GetUniqueId());
+
+    Scratch<VkPipelineCreationFeedback> stageFeedbacks = AllocateScratch(m_Device, VkPipelineCreationFeedback, graphicsPipelineDesc.shaderNum);
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = graphicsPipelineDesc.shaderNum;
+    feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedbacks;
+
+    if (m_Device.m_IsSupported.pipelineCreationFeedback) {
+        feedbackInfo.pNext = pipelineRenderingCreateInfo.pNext;
+        pipelineRenderingCreateInfo.pNext = &feedbackInfo;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateGraphicsPipelines");
 
-    for (size_t i = 0; i < graphicsPipelineDesc.shaderNum; i++)
-        vk.DestroyShaderModule(m_Device, modules[i], m_Device.GetVkAllocationCallbacks());
+    ProcessFeedback(pipelineFeedback, stageFeedbacks, graphicsPipelineDesc.shaderNum);
 
     return Result::SUCCESS;
 }
 
 Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
     m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+    m_Stats.hash = HashPipelineDesc(computePipelineDesc);
+    m_Stats.stageNum = 1;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)computePipelineDesc.pipelineLayout;
 
-    const VkShaderModuleCreateInfo moduleInfo = {
-        VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-        nullptr,
-        (VkShaderModuleCreateFlags)0,
-        (size_t)computePipelineDesc.shader.size,
-        (const uint32_t*)computePipelineDesc.shader.bytecode,
-    };
+    VkPipelineShaderStageCreateInfo stage = {};
+    VkShaderModuleCreateInfo moduleInfo = {};
+    Result result = SetupShaderStage(stage, moduleInfo, computePipelineDesc.shader);
+    if (result != Result::SUCCESS)
+        return result;
 
-    VkShaderModule module = VK_NULL_HANDLE;
-    const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateShaderModule(m_Device, &moduleInfo, m_Device.GetVkAllocationCallbacks(), &module);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateShaderModule");
-
-    VkPipelineShaderStageCreateInfo stage = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        nullptr,
-        (VkPipelineShaderStageCreateFlags)0,
-        VK_SHADER_STAGE_COMPUTE_BIT,
-        module,
-        computePipelineDesc.shader.entryPointName ? computePipelineDesc.shader.entryPointName : "main",
-        nullptr,
-    };
+    stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
 
     VkComputePipelineCreateInfo info = {
         VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
         nullptr,
-        (VkPipelineCreateFlags)0,
+        m_Device.m_IsSupported.descriptorBuffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : (VkPipelineCreateFlags)0,
         stage,
         pipelineLayoutVK,
         VK_NULL_HANDLE,
@@ -341,30 +710,43 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
     if (FillPipelineRobustness(m_Device, computePipelineDesc.robustness, robustnessInfo))
         info.pNext = &robustnessInfo;
 
-    vkResult = vk.CreateComputePipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    VkPipelineCreationFeedback stageFeedback = {};
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = 1;
+    feedbackInfo.pPipelineStageCreationFeedbacks = &stageFeedback;
+
+    if (m_Device.m_IsSupported.pipelineCreationFeedback) {
+        feedbackInfo.pNext = info.pNext;
+        info.pNext = &feedbackInfo;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateComputePipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateComputePipelines");
 
-    vk.DestroyShaderModule(m_Device, module, m_Device.GetVkAllocationCallbacks());
+    ProcessFeedback(pipelineFeedback, &stageFeedback, 1);
 
     return Result::SUCCESS;
 }
 
 Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc) {
     m_BindPoint = VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR;
+    m_Stats.hash = HashPipelineDesc(rayTracingPipelineDesc);
+    m_Stats.stageNum = rayTracingPipelineDesc.shaderLibrary->shaderNum;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)rayTracingPipelineDesc.pipelineLayout;
 
     const uint32_t stageNum = rayTracingPipelineDesc.shaderLibrary->shaderNum;
     Scratch<VkPipelineShaderStageCreateInfo> stages = AllocateScratch(m_Device, VkPipelineShaderStageCreateInfo, stageNum);
-    Scratch<VkShaderModule> modules = AllocateScratch(m_Device, VkShaderModule, stageNum);
+    Scratch<VkShaderModuleCreateInfo> moduleInfos = AllocateScratch(m_Device, VkShaderModuleCreateInfo, stageNum);
 
     for (uint32_t i = 0; i < stageNum; i++) {
-        const ShaderDesc& shaderDesc = rayTracingPipelineDesc.shaderLibrary->shaders[i];
-        Result result = SetupShaderStage(stages[i], shaderDesc, modules[i]);
+        Result result = SetupShaderStage(stages[i], moduleInfos[i], rayTracingPipelineDesc.shaderLibrary->shaders[i]);
         if (result != Result::SUCCESS)
             return result;
-
-        stages[i].pName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
     }
 
     Scratch<VkRayTracingShaderGroupCreateInfoKHR> groupArray = AllocateScratch(m_Device, VkRayTracingShaderGroupCreateInfoKHR, rayTracingPipelineDesc.shaderGroupNum);
@@ -431,6 +813,8 @@ Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc)
     createInfo.layout = pipelineLayoutVK;
     createInfo.basePipelineIndex = -1;
 
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     if (rayTracingPipelineDesc.flags & RayTracingPipelineBits::SKIP_TRIANGLES)
         createInfo.flags |= VK_PIPELINE_CREATE_RAY_TRACING_SKIP_TRIANGLES_BIT_KHR;
     if (rayTracingPipelineDesc.flags & RayTracingPipelineBits::SKIP_AABBS)
@@ -442,12 +826,24 @@ Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc)
     if (FillPipelineRobustness(m_Device, rayTracingPipelineDesc.robustness, robustnessInfo))
         createInfo.pNext = &robustnessInfo;
 
+    Scratch<VkPipelineCreationFeedback> stageFeedbacks = AllocateScratch(m_Device, VkPipelineCreationFeedback, stageNum);
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = stageNum;
+    feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedbacks;
+
+    if (m_Device.m_IsSupported.pipelineCreationFeedback) {
+        feedbackInfo.pNext = createInfo.pNext;
+        createInfo.pNext = &feedbackInfo;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateRayTracingPipelinesKHR(m_Device, VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateRayTracingPipelinesKHR");
 
-    for (size_t i = 0; i < stageNum; i++)
-        vk.DestroyShaderModule(m_Device, modules[i], m_Device.GetVkAllocationCallbacks());
+    ProcessFeedback(pipelineFeedback, stageFeedbacks, stageNum);
 
     return Result::SUCCESS;
 }
@@ -460,33 +856,294 @@ Result PipelineVK::Create(const PipelineVKDesc& pipelineVKDesc) {
     return Result::SUCCESS;
 }
 
-Result PipelineVK::SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, const ShaderDesc& shaderDesc, VkShaderModule& module) {
-    const VkShaderModuleCreateInfo moduleInfo = {
-        VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-        nullptr,
-        (VkShaderModuleCreateFlags)0,
-        (size_t)shaderDesc.size,
-        (const uint32_t*)shaderDesc.bytecode,
+Result PipelineVK::SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, VkShaderModuleCreateInfo& moduleInfo, const ShaderDesc& shaderDesc) {
+    moduleInfo = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    moduleInfo.codeSize = (size_t)shaderDesc.size;
+    moduleInfo.pCode = (const uint32_t*)shaderDesc.bytecode;
+
+    stage = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+    stage.stage = (VkShaderStageFlagBits)GetShaderStageFlags(shaderDesc.stage);
+    stage.pName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
+
+    // With "maintenance5" SPIR-V goes inline, otherwise a module is taken from the device-level cache (owned by the device)
+    if (m_Device.m_IsSupported.maintenance5)
+        stage.pNext = &moduleInfo;
+    else {
+        uint64_t key = 0;
+        Result result = m_Device.GetShaderModule(moduleInfo, stage.module, key);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_ShaderModuleKeys.push_back(key);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result PipelineVK::CreateFromLibraries(const VkGraphicsPipelineCreateInfo& graphicsPipelineCreateInfo, uint64_t layoutId) {
+    const VkGraphicsPipelineCreateInfo& info = graphicsPipelineCreateInfo;
+
+    // Non-fragment stages go first
+    Scratch<VkPipelineShaderStageCreateInfo> stages = AllocateScratch(m_Device, VkPipelineShaderStageCreateInfo, info.stageCount);
+    uint32_t preRasterizationStageNum = 0;
+    bool hasVertexStage = false;
+
+    for (uint32_t i = 0; i < info.stageCount; i++) {
+        if (info.pStages[i].stage != VK_SHADER_STAGE_FRAGMENT_BIT)
+            stages[preRasterizationStageNum++] = info.pStages[i];
+
+        if (info.pStages[i].stage == VK_SHADER_STAGE_VERTEX_BIT)
+            hasVertexStage = true;
+    }
+
+    uint32_t fragmentStageNum = 0;
+    for (uint32_t i = 0; i < info.stageCount; i++) {
+        if (info.pStages[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+            stages[preRasterizationStageNum + fragmentStageNum++] = info.pStages[i];
+    }
+
+    // Get or create parts
+    constexpr std::array<VkGraphicsPipelineLibraryFlagBitsEXT, 4> parts = {
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
     };
 
+    for (VkGraphicsPipelineLibraryFlagBitsEXT part : parts) {
+        // Mesh shading pipelines have no vertex input interface
+        if (part == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT && !hasVertexStage)
+            continue;
+
+        VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT};
+        libraryInfo.pNext = info.pNext;
+        libraryInfo.flags = part;
+
+        VkGraphicsPipelineCreateInfo partInfo = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+        partInfo.pNext = &libraryInfo;
+        partInfo.flags = info.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        partInfo.pDynamicState = info.pDynamicState;
+        partInfo.basePipelineIndex = -1;
+
+        if (part == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT) {
+            partInfo.pVertexInputState = info.pVertexInputState;
+            partInfo.pInputAssemblyState = info.pInputAssemblyState;
+        } else if (part == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
+            partInfo.stageCount = preRasterizationStageNum;
+            partInfo.pStages = stages;
+            partInfo.pTessellationState = info.pTessellationState;
+            partInfo.pViewportState = info.pViewportState;
+            partInfo.pRasterizationState = info.pRasterizationState;
+            partInfo.layout = info.layout;
+        } else if (part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
+            partInfo.stageCount = fragmentStageNum;
+            partInfo.pStages = stages + preRasterizationStageNum;
+            partInfo.pMultisampleState = info.pMultisampleState;
+            partInfo.pDepthStencilState = info.pDepthStencilState;
+            partInfo.layout = info.layout;
+        } else {
+            partInfo.pMultisampleState = info.pMultisampleState;
+            partInfo.pColorBlendState = info.pColorBlendState;
+        }
+
+        Vector<uint8_t> desc(m_Device.GetStdAllocator());
+        SerializePipelineLibrary(partInfo, layoutId, desc);
+
+        uint64_t key = 0;
+        Result result = m_Device.GetPipelineLibrary(desc, partInfo, m_Libraries[m_LibraryNum], key);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_LibraryKeys[m_LibraryNum++] = key;
+    }
+
+    // Fast link, "Optimize" links again with link time optimizations
+    m_Layout = info.layout;
+    m_LinkFlags = info.flags;
+
+    // Only the link itself is reported, stages are compiled into (cached) libraries
+    VkPipelineCreationFeedback pipelineFeedback = {};
+    Result result = LinkLibraries(0, m_Handle, &pipelineFeedback);
+    if (result != Result::SUCCESS)
+        return result;
+
+    ProcessFeedback(pipelineFeedback, nullptr, 0);
+
+    return Result::SUCCESS;
+}
+
+Result PipelineVK::LinkLibraries(VkPipelineCreateFlags flags, VkPipeline& pipeline, VkPipelineCreationFeedback* pipelineFeedback) const {
+    VkPipelineLibraryCreateInfoKHR libraryInfo = {VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR};
+    libraryInfo.libraryCount = m_LibraryNum;
+    libraryInfo.pLibraries = m_Libraries.data();
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = pipelineFeedback;
+
+    if (pipelineFeedback && m_Device.m_IsSupported.pipelineCreationFeedback)
+        libraryInfo.pNext = &feedbackInfo;
+
+    VkGraphicsPipelineCreateInfo info = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    info.pNext = &libraryInfo;
+    info.flags = m_LinkFlags | flags;
+    info.layout = m_Layout;
+    info.basePipelineIndex = -1;
+
     const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.CreateShaderModule(m_Device, &moduleInfo, m_Device.GetVkAllocationCallbacks(), &module);
-    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateShaderModule");
+    VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &pipeline);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateGraphicsPipelines");
 
-    stage = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        nullptr,
-        (VkPipelineShaderStageCreateFlags)0,
-        (VkShaderStageFlagBits)GetShaderStageFlags(shaderDesc.stage),
-        module,
-        nullptr,
-        nullptr,
-    };
+    return Result::SUCCESS;
+}
+
+void PipelineVK::ProcessFeedback(const VkPipelineCreationFeedback& pipelineFeedback, const VkPipelineCreationFeedback* stageFeedbacks, uint32_t stageFeedbackNum) {
+    if (!(pipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+        return;
+
+    m_Stats.compilationTime = pipelineFeedback.duration / 1000;
+    m_Stats.cacheHit = (pipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) != 0;
+
+    for (uint32_t i = 0; i < stageFeedbackNum; i++) {
+        const VkPipelineCreationFeedbackFlags stageFlags = stageFeedbacks[i].flags;
+        if ((stageFlags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) && (stageFlags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT))
+            m_Stats.cacheHitStageNum++;
+    }
+}
+
+Result PipelineVK::CreateShaderObjects(const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    const ShaderObjectDesc& shaderObjectDesc = m_Device.GetShaderObjectDesc();
+    const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)graphicsPipelineDesc.pipelineLayout;
+    const Vector<VkDescriptorSetLayout>& setLayouts = pipelineLayoutVK.GetSetLayouts();
+    const Vector<VkPushConstantRange>& pushConstantRanges = pipelineLayoutVK.GetPushConstantRanges();
+
+    m_ShaderObjectState = Allocate<ShaderObjectState>(m_Device.GetAllocationCallbacks(), m_Device.GetStdAllocator());
+    ShaderObjectState& state = *m_ShaderObjectState;
+
+    VkShaderStageFlags deviceStages = 0;
+    for (uint32_t i = 0; i < shaderObjectDesc.stageNum; i++)
+        deviceStages |= shaderObjectDesc.stages[i];
+
+    VkShaderStageFlags pipelineStages = 0;
+    for (uint32_t i = 0; i < graphicsPipelineDesc.shaderNum; i++)
+        pipelineStages |= GetShaderStageFlags(graphicsPipelineDesc.shaders[i].stage);
+
+    // Shaders (unused stages get unbound)
+    state.stages = shaderObjectDesc.stages;
+    state.stageNum = shaderObjectDesc.stageNum;
+    state.shaders = {};
+    state.shaderKeys = {};
+
+    for (uint32_t i = 0; i < graphicsPipelineDesc.shaderNum; i++) {
+        const ShaderDesc& shaderDesc = graphicsPipelineDesc.shaders[i];
+        VkShaderStageFlagBits stage = (VkShaderStageFlagBits)GetShaderStageFlags(shaderDesc.stage);
+
+        uint32_t slot = 0;
+        while (slot < state.stageNum && state.stages[slot] != stage)
+            slot++;
+
+        RETURN_ON_FAILURE(&m_Device, slot < state.stageNum, Result::UNSUPPORTED, "Shader stage %u is not enabled on the device", (uint32_t)stage);
+
+        // All potential next stages are allowed, making shaders reusable across pipelines
+        VkShaderStageFlags nextStage = 0;
+        if (stage == VK_SHADER_STAGE_VERTEX_BIT)
+            nextStage = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        else if (stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT)
+            nextStage = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        else if (stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
+            nextStage = VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        else if (stage == VK_SHADER_STAGE_GEOMETRY_BIT || stage == VK_SHADER_STAGE_MESH_BIT_EXT)
+            nextStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        else if (stage == VK_SHADER_STAGE_TASK_BIT_EXT)
+            nextStage = VK_SHADER_STAGE_MESH_BIT_EXT;
+
+        nextStage &= deviceStages;
+
+        VkShaderCreateFlagsEXT flags = 0;
+        if (stage == VK_SHADER_STAGE_MESH_BIT_EXT && (deviceStages & VK_SHADER_STAGE_TASK_BIT_EXT) && !(pipelineStages & VK_SHADER_STAGE_TASK_BIT_EXT))
+            flags |= VK_SHADER_CREATE_NO_TASK_SHADER_BIT_EXT;
+        if (stage == VK_SHADER_STAGE_FRAGMENT_BIT && graphicsPipelineDesc.rasterization.shadingRate && m_Device.GetDesc().tiers.shadingRate >= 2)
+            flags |= VK_SHADER_CREATE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_EXT;
+
+        VkShaderCreateInfoEXT shaderCreateInfo = {VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT};
+        shaderCreateInfo.flags = flags;
+        shaderCreateInfo.stage = stage;
+        shaderCreateInfo.nextStage = nextStage;
+        shaderCreateInfo.codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        shaderCreateInfo.codeSize = (size_t)shaderDesc.size;
+        shaderCreateInfo.pCode = shaderDesc.bytecode;
+        shaderCreateInfo.pName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
+        shaderCreateInfo.setLayoutCount = (uint32_t)setLayouts.size();
+        shaderCreateInfo.pSetLayouts = setLayouts.data();
+        shaderCreateInfo.pushConstantRangeCount = (uint32_t)pushConstantRanges.size();
+        shaderCreateInfo.pPushConstantRanges = pushConstantRanges.data();
+
+        Vector<uint8_t> desc(m_Device.GetStdAllocator());
+        AppendBytes(desc, shaderCreateInfo.pCode, shaderCreateInfo.codeSize);
+        AppendBytes(desc, shaderCreateInfo.pName, std::strlen(shaderCreateInfo.pName) + 1);
+        AppendValue(desc, flags);
+        AppendValue(desc, stage);
+        AppendValue(desc, nextStage);
+        AppendValue(desc, pipelineLayoutVK.GetUniqueId()); // not the handle, which can be reused
+
+        uint64_t key = 0;
+        Result result = m_Device.GetShaderObject(desc, shaderCreateInfo, state.shaders[slot], key);
+        if (result != Result::SUCCESS)
+            return result;
+
+        state.shaderKeys[slot] = key;
+    }
+
+    // Vertex input
+    const VertexInputDesc* vi = graphicsPipelineDesc.vertexInput;
+    if (vi) {
+        for (uint32_t i = 0; i < vi->attributeNum; i++) {
+            const VertexAttributeDesc& attribute = vi->attributes[i];
+
+            VkVertexInputAttributeDescription2EXT vertexAttributeDesc = {VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT};
+            vertexAttributeDesc.location = attribute.vk.location;
+            vertexAttributeDesc.binding = attribute.streamIndex;
+            vertexAttributeDesc.format = GetVkFormat(attribute.format);
+            vertexAttributeDesc.offset = attribute.offset;
+
+            state.vertexAttributes.push_back(vertexAttributeDesc);
+        }
+
+        for (uint32_t i = 0; i < vi->streamNum; i++) {
+            const VertexStreamDesc& stream = vi->streams[i];
+
+            VkVertexInputBindingDescription2EXT vertexBindingDesc = {VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT};
+            vertexBindingDesc.binding = stream.bindingSlot;
+            vertexBindingDesc.inputRate = stream.stepRate == VertexStreamStepRate::PER_VERTEX ? VK_VERTEX_INPUT_RATE_VERTEX : VK_VERTEX_INPUT_RATE_INSTANCE;
+            vertexBindingDesc.divisor = 1;
+
+            state.vertexBindings.push_back(vertexBindingDesc);
+        }
+    }
+
+    // Fixed-function state
+    const OutputMergerDesc& om = graphicsPipelineDesc.outputMerger;
+
+    state.inputAssembly = graphicsPipelineDesc.inputAssembly;
+    state.rasterization = graphicsPipelineDesc.rasterization;
+    state.multisample = graphicsPipelineDesc.multisample ? *graphicsPipelineDesc.multisample : MultisampleDesc{ALL, 1, false, false};
+    state.depth = om.depth;
+    state.stencil = om.stencil;
+    state.logicOp = om.logicOp;
+    state.dynamicState = graphicsPipelineDesc.dynamicState;
+    state.hasVertexStage = (pipelineStages & VK_SHADER_STAGE_VERTEX_BIT) != 0;
+    state.hasTessellationStages = (pipelineStages & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0;
+    state.colors.insert(state.colors.end(), om.colors, om.colors + om.colorNum);
+
+    m_DepthBias = graphicsPipelineDesc.rasterization.depthBias;
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE void PipelineVK::SetDebugName(const char* name) {
+    // Shader objects are shared between pipelines, so they are left unnamed
+    if (m_ShaderObjectState)
+        return;
+
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_PIPELINE, (uint64_t)m_Handle, name);
 }
 
@@ -499,3 +1156,22 @@ NRI_INLINE Result PipelineVK::WriteShaderGroupIdentifiers(uint32_t baseShaderGro
 
     return Result::SUCCESS;
 }
+
+NRI_INLINE Result PipelineVK::Optimize() {
+    if (!m_LibraryNum || m_OptimizedHandle.load(std::memory_order_acquire))
+        return Result::SUCCESS;
+
+    VkPipeline optimizedHandle = VK_NULL_HANDLE;
+    Result result = LinkLibraries(VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT, optimizedHandle, nullptr);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // The fast-linked pipeline stays alive, since it can be referenced by already recorded command buffers
+    VkPipeline expected = VK_NULL_HANDLE;
+    if (!m_OptimizedHandle.compare_exchange_strong(expected, optimizedHandle, std::memory_order_acq_rel)) {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.DestroyPipeline(m_Device, optimizedHandle, m_Device.GetVkAllocationCallbacks());
+    }
+
+    return Result::SUCCESS;
+}
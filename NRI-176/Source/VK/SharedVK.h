@@ -43,6 +43,17 @@ namespace nri {
 
 constexpr uint32_t INVALID_FAMILY_INDEX = uint32_t(-1);
 
+// Root descriptors are push descriptors, tracked by 32-bit masks in command buffers (a D3D12 root descriptor takes 2 DWORDs)
+constexpr uint32_t ROOT_DESCRIPTOR_MAX_NUM = ROOT_SIGNATURE_DWORD_NUM / 2;
+
+// A "vkUpdateDescriptorSetWithTemplate" or "vkCmdPushDescriptorSetWithTemplate" data entry, one per descriptor
+union DescriptorUpdateData {
+    VkDescriptorImageInfo image;
+    VkDescriptorBufferInfo buffer;
+    VkBufferView bufferView;
+    VkAccelerationStructureKHR accelerationStructure;
+};
+
 struct MemoryTypeInfo {
     MemoryTypeIndex index;
     MemoryLocation location;
@@ -6,13 +6,19 @@ namespace nri {
 
 struct TextureVK final : public DebugNameBase {
     inline TextureVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_UniqueId(device.GenerateUniqueId()) {
     }
 
     inline VkImage GetHandle() const {
         return m_Handle;
     }
 
+    // Identifies the resource in the device descriptor object cache, since a destroyed handle can be reused
+    inline uint64_t GetUniqueId() const {
+        return m_UniqueId;
+    }
+
     inline DeviceVK& GetDevice() const {
         return m_Device;
     }
@@ -47,6 +53,7 @@ struct TextureVK final : public DebugNameBase {
 private:
     DeviceVK& m_Device;
     VkImage m_Handle = VK_NULL_HANDLE;
+    uint64_t m_UniqueId = 0;
     TextureDesc m_Desc = {};
     VmaAllocation m_VmaAllocation = nullptr;
     bool m_OwnsNativeObjects = true;
@@ -42,6 +42,7 @@ struct BufferVal final : public ObjectVal {
 
     void* Map(uint64_t offset, uint64_t size);
     void Unmap();
+    uint64_t GetIndirectDeviceAddress() const;
 
 private:
     BufferDesc m_Desc = {}; // (only for) .natvis
@@ -25,3 +25,10 @@ NRI_INLINE void BufferVal::Unmap() {
 
     GetCoreInterfaceImpl().UnmapBuffer(*GetImpl());
 }
+
+NRI_INLINE uint64_t BufferVal::GetIndirectDeviceAddress() const {
+    RETURN_ON_FAILURE(&m_Device, m_IsBoundToMemory, 0, "the buffer is not bound to memory");
+    RETURN_ON_FAILURE(&m_Device, m_Desc.usage & (BufferUsageBits::VERTEX_BUFFER | BufferUsageBits::INDEX_BUFFER), 0, "the buffer must have 'VERTEX_BUFFER' or 'INDEX_BUFFER' usage");
+
+    return GetIndirectCommandsInterfaceImpl().GetIndirectBufferDeviceAddress(*GetImpl());
+}
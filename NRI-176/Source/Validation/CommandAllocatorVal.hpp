@@ -6,7 +6,21 @@ NRI_INLINE Result CommandAllocatorVal::CreateCommandBuffer(CommandBuffer*& comma
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false, false);
+
+    return result;
+}
+
+NRI_INLINE Result CommandAllocatorVal::CreateSecondaryCommandBuffer(CommandBuffer*& commandBuffer) {
+    commandBuffer = nullptr;
+
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().features.secondaryCommandBuffer, Result::UNSUPPORTED, "'features.secondaryCommandBuffer' is false");
+
+    CommandBuffer* commandBufferImpl;
+    const Result result = GetCoreInterfaceImpl().CreateSecondaryCommandBuffer(*GetImpl(), commandBufferImpl);
+
+    if (result == Result::SUCCESS)
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false, true);
 
     return result;
 }
@@ -8,21 +8,43 @@ struct DescriptorVal;
 struct PipelineVal;
 struct PipelineLayoutVal;
 
+// The state of a buffer range after the last barrier recorded in the command buffer
+struct BufferRangeState {
+    const Buffer* buffer;
+    uint64_t offset;
+    uint64_t end;
+    AccessStage after;
+};
+
 struct CommandBufferVal final : public ObjectVal {
-    CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped)
+    CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped, bool isSecondary)
         : ObjectVal(device, commandBuffer)
+        , m_BufferRanges(device.GetStdAllocator())
         , m_IsRecordingStarted(isWrapped)
-        , m_IsWrapped(isWrapped) {
+        , m_IsWrapped(isWrapped)
+        , m_IsSecondary(isSecondary) {
     }
 
     inline CommandBuffer* GetImpl() const {
         return (CommandBuffer*)m_Impl;
     }
 
+    inline bool IsSecondary() const {
+        return m_IsSecondary;
+    }
+
+    inline bool IsRecordingStarted() const {
+        return m_IsRecordingStarted;
+    }
+
     inline void* GetNativeObject() const {
         return GetCoreInterfaceImpl().GetCommandBufferNativeObject(GetImpl());
     }
 
+    inline void GetStats(CommandBufferStats& commandBufferStats) const {
+        GetCoreInterfaceImpl().GetCommandBufferStats(*GetImpl(), commandBufferStats);
+    }
+
     inline void ResetAttachments() {
         m_RenderTargetNum = 0;
         for (size_t i = 0; i < m_RenderTargets.size(); i++)
@@ -36,6 +58,7 @@ struct CommandBufferVal final : public ObjectVal {
     //================================================================================================================
 
     Result Begin(const DescriptorPool* descriptorPool);
+    Result BeginSecondary(const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool);
     Result End();
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
     void SetScissors(const Rect* rects, uint32_t rectNum);
@@ -45,23 +68,34 @@ struct CommandBufferVal final : public ObjectVal {
     void SetBlendConstants(const Color32f& color);
     void SetShadingRate(const ShadingRateDesc& shadingRateDesc);
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
+    void SetTopology(Topology topology);
+    void SetCullMode(CullMode cullMode, bool frontCounterClockwise);
+    void SetDepthState(const DepthAttachmentDesc& depthAttachmentDesc);
+    void SetStencilState(const StencilAttachmentDesc& stencilAttachmentDesc);
+    void SetBlendState(uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    void ClearStorages(const ClearStorageDesc* clearDescs, uint32_t clearDescNum);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
+    void ExecuteCommandBuffers(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
     void SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout);
     void SetPipeline(const Pipeline& pipeline);
     void SetDescriptorPool(const DescriptorPool& descriptorPool);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
+    void SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc);
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
+    void CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
@@ -88,9 +122,17 @@ struct CommandBufferVal final : public ObjectVal {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc);
 
 private:
     void ValidateReadonlyDepthStencil();
+    void SetAttachments(const AttachmentsDesc& attachmentsDesc);
+    void ResetState();
+    void TrackBufferBarrier(uint32_t i, const BufferBarrierDesc& bufferBarrier);
+
+    inline uint32_t GetMissingDynamicState() const {
+        return m_PipelineDynamicState & ~m_DynamicState;
+    }
 
     std::array<DescriptorVal*, 16> m_RenderTargets = {};
     DescriptorVal* m_DepthStencil = nullptr;
@@ -98,9 +140,14 @@ private:
     PipelineVal* m_Pipeline = nullptr;
     uint32_t m_RenderTargetNum = 0;
     int32_t m_AnnotationStack = 0;
+    DynamicStateBits m_PipelineDynamicState = DynamicStateBits::NONE; // required by the current graphics pipeline
+    DynamicStateBits m_DynamicState = DynamicStateBits::NONE;         // set since the last graphics pipeline change
+    Vector<BufferRangeState> m_BufferRanges;                          // non-overlapping
     bool m_IsRecordingStarted = false;
     bool m_IsWrapped = false;
     bool m_IsRenderPass = false;
+    bool m_IsSecondary = false;
+    bool m_IsSecondaryContent = false; // the render pass content is provided by secondary command buffers
 };
 
 } // namespace nri
@@ -1,5 +1,7 @@
 // © 2021 NVIDIA Corporation
 
+#include <algorithm>
+
 static bool ValidateBufferBarrierDesc(const DeviceVal& device, uint32_t i, const BufferBarrierDesc& bufferBarrier) {
     const BufferVal& bufferVal = *(const BufferVal*)bufferBarrier.buffer;
 
@@ -9,6 +11,12 @@ static bool ValidateBufferBarrierDesc(const DeviceVal& device, uint32_t i, const
     RETURN_ON_FAILURE(&device, IsAccessMaskSupported(bufferVal.GetDesc().usage, bufferBarrier.after.access), false,
         "'bufferBarrier.buffers[%u].after' is not supported by the usage mask of the buffer ('%s')", i, bufferVal.GetDebugName());
 
+    uint64_t bufferSize = bufferVal.GetDesc().size;
+    RETURN_ON_FAILURE(&device, bufferBarrier.offset < bufferSize, false,
+        "'bufferBarrier.buffers[%u].offset' is out of bounds of the buffer ('%s')", i, bufferVal.GetDebugName());
+    RETURN_ON_FAILURE(&device, bufferBarrier.size == WHOLE_SIZE || bufferBarrier.size <= bufferSize - bufferBarrier.offset, false,
+        "'bufferBarrier.buffers[%u].size' is out of bounds of the buffer ('%s')", i, bufferVal.GetDebugName());
+
     return true;
 }
 
@@ -28,8 +36,20 @@ static bool ValidateTextureBarrierDesc(const DeviceVal& device, uint32_t i, cons
     return true;
 }
 
+static uint32_t GetDynamicOffsetNum(const DescriptorSetDesc& descriptorSetDesc) {
+    uint32_t dynamicOffsetNum = 0;
+    for (uint32_t i = 0; i < descriptorSetDesc.rangeNum; i++) {
+        const DescriptorRangeDesc& range = descriptorSetDesc.ranges[i];
+        if (range.flags & DescriptorRangeBits::DYNAMIC_OFFSET)
+            dynamicOffsetNum += range.descriptorNum;
+    }
+
+    return dynamicOffsetNum;
+}
+
 NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool) {
     RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, Result::FAILURE, "already in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, Result::FAILURE, "a secondary command buffer must be started with 'BeginSecondaryCommandBuffer'");
 
     DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, descriptorPool);
 
@@ -37,14 +57,40 @@ NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool)
     if (result == Result::SUCCESS)
         m_IsRecordingStarted = true;
 
-    m_Pipeline = nullptr;
-    m_PipelineLayout = nullptr;
-
+    ResetState();
     ResetAttachments();
 
     return result;
 }
 
+NRI_INLINE Result CommandBufferVal::BeginSecondary(const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool) {
+    RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, Result::FAILURE, "already in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsSecondary, Result::FAILURE, "not a secondary command buffer (see 'CreateSecondaryCommandBuffer')");
+    RETURN_ON_FAILURE(&m_Device, !attachmentsDesc.secondaryCommandBuffers, Result::INVALID_ARGUMENT, "'attachmentsDesc.secondaryCommandBuffers' must be false, secondary command buffers can't be nested");
+
+    Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, attachmentsDesc.colorNum);
+    for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++)
+        colors[i] = NRI_GET_IMPL(Descriptor, attachmentsDesc.colors[i]);
+
+    auto attachmentsDescImpl = attachmentsDesc;
+    attachmentsDescImpl.depthStencil = NRI_GET_IMPL(Descriptor, attachmentsDesc.depthStencil);
+    attachmentsDescImpl.shadingRate = NRI_GET_IMPL(Descriptor, attachmentsDesc.shadingRate);
+    attachmentsDescImpl.colors = colors;
+
+    DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, descriptorPool);
+
+    Result result = GetCoreInterfaceImpl().BeginSecondaryCommandBuffer(*GetImpl(), attachmentsDescImpl, descriptorPoolImpl);
+    if (result == Result::SUCCESS) {
+        m_IsRecordingStarted = true;
+        m_IsRenderPass = true;
+    }
+
+    ResetState();
+    SetAttachments(attachmentsDesc);
+
+    return result;
+}
+
 NRI_INLINE Result CommandBufferVal::End() {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, Result::FAILURE, "not in the recording state");
 
@@ -57,6 +103,12 @@ NRI_INLINE Result CommandBufferVal::End() {
     if (result == Result::SUCCESS)
         m_IsRecordingStarted = m_IsWrapped;
 
+    // A secondary command buffer is "inside" the render pass for its whole lifetime
+    if (m_IsSecondary) {
+        m_IsRenderPass = false;
+        ResetAttachments();
+    }
+
     return result;
 }
 
@@ -127,6 +179,64 @@ NRI_INLINE void CommandBufferVal::SetDepthBias(const DepthBiasDesc& depthBiasDes
     GetCoreInterfaceImpl().CmdSetDepthBias(*GetImpl(), depthBiasDesc);
 }
 
+NRI_INLINE void CommandBufferVal::SetTopology(Topology topology) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicState, ReturnVoid(), "'features.dynamicState' is false");
+
+    m_DynamicState |= DynamicStateBits::TOPOLOGY;
+
+    GetCoreInterfaceImpl().CmdSetTopology(*GetImpl(), topology);
+}
+
+NRI_INLINE void CommandBufferVal::SetCullMode(CullMode cullMode, bool frontCounterClockwise) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicState, ReturnVoid(), "'features.dynamicState' is false");
+
+    m_DynamicState |= DynamicStateBits::CULL_MODE;
+
+    GetCoreInterfaceImpl().CmdSetCullMode(*GetImpl(), cullMode, frontCounterClockwise);
+}
+
+NRI_INLINE void CommandBufferVal::SetDepthState(const DepthAttachmentDesc& depthAttachmentDesc) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicState, ReturnVoid(), "'features.dynamicState' is false");
+    RETURN_ON_FAILURE(&m_Device, !depthAttachmentDesc.boundsTest || deviceDesc.features.depthBoundsTest, ReturnVoid(), "'features.depthBoundsTest' is false");
+
+    m_DynamicState |= DynamicStateBits::DEPTH;
+
+    GetCoreInterfaceImpl().CmdSetDepthState(*GetImpl(), depthAttachmentDesc);
+}
+
+NRI_INLINE void CommandBufferVal::SetStencilState(const StencilAttachmentDesc& stencilAttachmentDesc) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicState, ReturnVoid(), "'features.dynamicState' is false");
+
+    m_DynamicState |= DynamicStateBits::STENCIL;
+
+    GetCoreInterfaceImpl().CmdSetStencilState(*GetImpl(), stencilAttachmentDesc);
+}
+
+NRI_INLINE void CommandBufferVal::SetBlendState(uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicBlendState, ReturnVoid(), "'features.dynamicBlendState' is false");
+    RETURN_ON_FAILURE(&m_Device, colorAttachmentDescs || !colorAttachmentNum, ReturnVoid(), "'colorAttachmentDescs' is NULL");
+    RETURN_ON_FAILURE(&m_Device, baseAttachment + colorAttachmentNum <= deviceDesc.shaderStage.fragment.attachmentMaxNum, ReturnVoid(), "'baseAttachment + colorAttachmentNum' is out of bounds");
+
+    m_DynamicState |= DynamicStateBits::BLEND;
+
+    GetCoreInterfaceImpl().CmdSetBlendState(*GetImpl(), baseAttachment, colorAttachmentDescs, colorAttachmentNum);
+}
+
 NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
@@ -165,13 +275,37 @@ NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearDesc
     GetCoreInterfaceImpl().CmdClearStorage(*GetImpl(), clearDescImpl);
 }
 
+NRI_INLINE void CommandBufferVal::ClearStorages(const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, clearDescs || !clearDescNum, ReturnVoid(), "'clearDescs' is NULL");
+
+    Scratch<ClearStorageDesc> clearDescsImpl = AllocateScratch(m_Device, ClearStorageDesc, clearDescNum);
+    for (uint32_t i = 0; i < clearDescNum; i++) {
+        const ClearStorageDesc& clearDesc = clearDescs[i];
+        RETURN_ON_FAILURE(&m_Device, clearDesc.storage, ReturnVoid(), "'clearDescs[%u].storage' is NULL", i);
+
+        const DescriptorVal& descriptorVal = *(DescriptorVal*)clearDesc.storage;
+        RETURN_ON_FAILURE(&m_Device, descriptorVal.IsShaderResourceStorage(), ReturnVoid(), "'clearDescs[%u].storage' is not a 'SHADER_RESOURCE_STORAGE' resource", i);
+
+        clearDescsImpl[i] = clearDesc;
+        clearDescsImpl[i].storage = NRI_GET_IMPL(Descriptor, clearDesc.storage);
+    }
+
+    GetCoreInterfaceImpl().CmdClearStorages(*GetImpl(), clearDescsImpl, clearDescNum);
+}
+
 NRI_INLINE void CommandBufferVal::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has been already called");
 
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, ReturnVoid(), "can't be called in a secondary command buffer");
+
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     if (attachmentsDesc.shadingRate)
         RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.shadingRate, ReturnVoid(), "'tiers.shadingRate >= 2' required");
+    if (attachmentsDesc.secondaryCommandBuffers)
+        RETURN_ON_FAILURE(&m_Device, deviceDesc.features.secondaryCommandBuffer, ReturnVoid(), "'features.secondaryCommandBuffer' is false");
 
     Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, attachmentsDesc.colorNum);
     for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++)
@@ -184,19 +318,9 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const AttachmentsDesc& attachme
     attachmentsDescImpl.colorNum = attachmentsDesc.colorNum;
 
     m_IsRenderPass = true;
-    m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
-
-    size_t i = 0;
-    for (; i < m_RenderTargetNum; i++)
-        m_RenderTargets[i] = (DescriptorVal*)attachmentsDesc.colors[i];
-    for (; i < m_RenderTargets.size(); i++)
-        m_RenderTargets[i] = nullptr;
-
-    if (attachmentsDesc.depthStencil)
-        m_DepthStencil = (DescriptorVal*)attachmentsDesc.depthStencil;
-    else
-        m_DepthStencil = nullptr;
+    m_IsSecondaryContent = attachmentsDesc.secondaryCommandBuffers;
 
+    SetAttachments(attachmentsDesc);
     ValidateReadonlyDepthStencil();
 
     GetCoreInterfaceImpl().CmdBeginRendering(*GetImpl(), attachmentsDescImpl);
@@ -205,14 +329,42 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const AttachmentsDesc& attachme
 NRI_INLINE void CommandBufferVal::EndRendering() {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has not been called");
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, ReturnVoid(), "can't be called in a secondary command buffer");
 
     m_IsRenderPass = false;
+    m_IsSecondaryContent = false;
 
     ResetAttachments();
 
     GetCoreInterfaceImpl().CmdEndRendering(*GetImpl());
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteCommandBuffers(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, ReturnVoid(), "can't be called in a secondary command buffer");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, m_IsSecondaryContent, ReturnVoid(), "'AttachmentsDesc::secondaryCommandBuffers' must be true in 'CmdBeginRendering'");
+
+    Scratch<CommandBuffer*> commandBuffersImpl = AllocateScratch(m_Device, CommandBuffer*, commandBufferNum);
+    for (uint32_t i = 0; i < commandBufferNum; i++) {
+        const CommandBufferVal* commandBufferVal = (CommandBufferVal*)commandBuffers[i];
+
+        RETURN_ON_FAILURE(&m_Device, commandBufferVal, ReturnVoid(), "'commandBuffers[%u]' is NULL", i);
+        RETURN_ON_FAILURE(&m_Device, commandBufferVal->IsSecondary(), ReturnVoid(), "'commandBuffers[%u]' is not a secondary command buffer", i);
+        RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsRecordingStarted(), ReturnVoid(), "'commandBuffers[%u]' is in the recording state", i);
+
+        commandBuffersImpl[i] = commandBufferVal->GetImpl();
+    }
+
+    // The bound state is undefined afterwards
+    m_Pipeline = nullptr;
+    m_PipelineLayout = nullptr;
+    m_PipelineDynamicState = DynamicStateBits::NONE;
+    m_DynamicState = DynamicStateBits::NONE;
+
+    GetCoreInterfaceImpl().CmdExecuteCommandBuffers(*GetImpl(), commandBuffersImpl, commandBufferNum);
+}
+
 NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
@@ -251,6 +403,12 @@ NRI_INLINE void CommandBufferVal::SetPipeline(const Pipeline& pipeline) {
 
     m_Pipeline = (PipelineVal*)&pipeline;
 
+    // Binding a pipeline with a static state invalidates the corresponding dynamic state
+    if (m_Pipeline->IsGraphics()) {
+        m_PipelineDynamicState = m_Pipeline->GetDynamicState();
+        m_DynamicState &= m_PipelineDynamicState;
+    }
+
     ValidateReadonlyDepthStencil();
 
     GetCoreInterfaceImpl().CmdSetPipeline(*GetImpl(), *pipelineImpl);
@@ -268,12 +426,44 @@ NRI_INLINE void CommandBufferVal::SetDescriptorSet(const SetDescriptorSetDesc& s
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
 
+    const DescriptorSetVal& descriptorSetVal = *(DescriptorSetVal*)setDescriptorSetDesc.descriptorSet;
+    RETURN_ON_FAILURE(&m_Device, GetDynamicOffsetNum(descriptorSetVal.GetDesc()) == 0, ReturnVoid(), "a set with 'DYNAMIC_OFFSET' ranges must be bound via 'CmdSetDescriptorSets'");
+
     auto descriptorSetBindingDescImpl = setDescriptorSetDesc;
     descriptorSetBindingDescImpl.descriptorSet = NRI_GET_IMPL(DescriptorSet, setDescriptorSetDesc.descriptorSet);
 
     GetCoreInterfaceImpl().CmdSetDescriptorSet(*GetImpl(), descriptorSetBindingDescImpl);
 }
 
+NRI_INLINE void CommandBufferVal::SetDescriptorSets(const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
+
+    const PipelineLayoutDesc& pipelineLayoutDesc = m_PipelineLayout->GetPipelineLayoutDesc();
+    RETURN_ON_FAILURE(&m_Device, setDescriptorSetsDesc.descriptorSetNum != 0, ReturnVoid(), "'descriptorSetNum' is 0");
+    RETURN_ON_FAILURE(&m_Device, setDescriptorSetsDesc.baseSetIndex + setDescriptorSetsDesc.descriptorSetNum <= pipelineLayoutDesc.descriptorSetNum, ReturnVoid(), "'baseSetIndex + descriptorSetNum' is out of bounds");
+
+    Scratch<DescriptorSet*> descriptorSetsImpl = AllocateScratch(m_Device, DescriptorSet*, setDescriptorSetsDesc.descriptorSetNum);
+
+    uint32_t dynamicOffsetNum = 0;
+    for (uint32_t i = 0; i < setDescriptorSetsDesc.descriptorSetNum; i++) {
+        RETURN_ON_FAILURE(&m_Device, setDescriptorSetsDesc.descriptorSets[i] != nullptr, ReturnVoid(), "'descriptorSets[%u]' is NULL", i);
+
+        const DescriptorSetVal& descriptorSetVal = *(DescriptorSetVal*)setDescriptorSetsDesc.descriptorSets[i];
+        dynamicOffsetNum += GetDynamicOffsetNum(descriptorSetVal.GetDesc());
+
+        descriptorSetsImpl[i] = descriptorSetVal.GetImpl();
+    }
+
+    RETURN_ON_FAILURE(&m_Device, setDescriptorSetsDesc.dynamicOffsetNum == dynamicOffsetNum, ReturnVoid(), "'dynamicOffsetNum' must be %u", dynamicOffsetNum);
+    RETURN_ON_FAILURE(&m_Device, dynamicOffsetNum == 0 || setDescriptorSetsDesc.dynamicOffsets != nullptr, ReturnVoid(), "'dynamicOffsets' is NULL");
+
+    auto setDescriptorSetsDescImpl = setDescriptorSetsDesc;
+    setDescriptorSetsDescImpl.descriptorSets = descriptorSetsImpl;
+
+    GetCoreInterfaceImpl().CmdSetDescriptorSets(*GetImpl(), setDescriptorSetsDescImpl);
+}
+
 NRI_INLINE void CommandBufferVal::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
@@ -304,6 +494,7 @@ NRI_INLINE void CommandBufferVal::SetRootDescriptor(const SetRootDescriptorDesc&
 NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
 
     GetCoreInterfaceImpl().CmdDraw(*GetImpl(), drawDesc);
 }
@@ -311,15 +502,37 @@ NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
 NRI_INLINE void CommandBufferVal::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
 
     GetCoreInterfaceImpl().CmdDrawIndexed(*GetImpl(), drawIndexedDesc);
 }
 
+NRI_INLINE void CommandBufferVal::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
+    RETURN_ON_FAILURE(&m_Device, drawDescs || drawNum == 0, ReturnVoid(), "'drawDescs' is NULL");
+    RETURN_ON_FAILURE(&m_Device, stride == 0 || stride >= sizeof(DrawDesc), ReturnVoid(), "'stride' must be 0 or >= sizeof(DrawDesc)");
+
+    GetCoreInterfaceImpl().CmdDrawMulti(*GetImpl(), drawDescs, drawNum, stride);
+}
+
+NRI_INLINE void CommandBufferVal::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
+    RETURN_ON_FAILURE(&m_Device, drawIndexedDescs || drawNum == 0, ReturnVoid(), "'drawIndexedDescs' is NULL");
+    RETURN_ON_FAILURE(&m_Device, stride == 0 || stride >= sizeof(DrawIndexedDesc), ReturnVoid(), "'stride' must be 0 or >= sizeof(DrawIndexedDesc)");
+
+    GetCoreInterfaceImpl().CmdDrawIndexedMulti(*GetImpl(), drawIndexedDescs, drawNum, stride);
+}
+
 NRI_INLINE void CommandBufferVal::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -333,6 +546,7 @@ NRI_INLINE void CommandBufferVal::DrawIndexedIndirect(const Buffer& buffer, uint
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -362,6 +576,70 @@ NRI_INLINE void CommandBufferVal::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffs
     GetCoreInterfaceImpl().CmdCopyBuffer(*GetImpl(), *dstBufferImpl, dstOffset, *srcBufferImpl, srcOffset, size);
 }
 
+NRI_INLINE void CommandBufferVal::CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    const BufferDesc& dstDesc = ((BufferVal&)dstBuffer).GetDesc();
+    const BufferDesc& srcDesc = ((BufferVal&)srcBuffer).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regions || !regionNum, ReturnVoid(), "'regions' is NULL");
+
+    Scratch<BufferCopyRegionDesc> sortedRegions = AllocateScratch(m_Device, BufferCopyRegionDesc, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        BufferCopyRegionDesc region = regions[i];
+
+        if (region.size == WHOLE_SIZE) {
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset == 0, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'dstOffset' is not 0", i);
+            RETURN_ON_FAILURE(&m_Device, region.srcOffset == 0, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'srcOffset' is not 0", i);
+            RETURN_ON_FAILURE(&m_Device, dstDesc.size == srcDesc.size, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'dstBuffer' and 'srcBuffer' have different sizes", i);
+
+            region.size = dstDesc.size;
+        } else {
+            RETURN_ON_FAILURE(&m_Device, region.srcOffset + region.size <= srcDesc.size, ReturnVoid(), "'regions[%u]': 'srcOffset + size' > srcBuffer.size", i);
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset + region.size <= dstDesc.size, ReturnVoid(), "'regions[%u]': 'dstOffset + size' > dstBuffer.size", i);
+        }
+
+        sortedRegions[i] = region;
+    }
+
+    // Overlapping destination ranges produce undefined results
+    std::sort(sortedRegions + 0, sortedRegions + regionNum, [](const BufferCopyRegionDesc& a, const BufferCopyRegionDesc& b) {
+        return a.dstOffset < b.dstOffset;
+    });
+
+    for (uint32_t i = 1; i < regionNum; i++) {
+        const BufferCopyRegionDesc& prev = sortedRegions[i - 1];
+        const BufferCopyRegionDesc& next = sortedRegions[i];
+
+        RETURN_ON_FAILURE(&m_Device, prev.dstOffset + prev.size <= next.dstOffset, ReturnVoid(), "destination ranges [%" PRIu64 "; %" PRIu64 ") and [%" PRIu64 "; %" PRIu64 ") overlap",
+            prev.dstOffset, prev.dstOffset + prev.size, next.dstOffset, next.dstOffset + next.size);
+    }
+
+    // Copying within a buffer: no source range may overlap any destination range. Destination ranges are sorted and disjoint,
+    // i.e. only the last one starting before the end of the source range can overlap it
+    if (&dstBuffer == &srcBuffer) {
+        for (uint32_t i = 0; i < regionNum; i++) {
+            const BufferCopyRegionDesc& src = sortedRegions[i];
+            uint64_t srcEnd = src.srcOffset + src.size;
+
+            const BufferCopyRegionDesc* next = std::lower_bound(sortedRegions + 0, sortedRegions + regionNum, srcEnd, [](const BufferCopyRegionDesc& region, uint64_t offset) {
+                return region.dstOffset < offset;
+            });
+
+            if (next != sortedRegions + 0) {
+                const BufferCopyRegionDesc& dst = *(next - 1);
+                RETURN_ON_FAILURE(&m_Device, dst.dstOffset + dst.size <= src.srcOffset, ReturnVoid(), "source range [%" PRIu64 "; %" PRIu64 ") and destination range [%" PRIu64 "; %" PRIu64 ") overlap",
+                    src.srcOffset, srcEnd, dst.dstOffset, dst.dstOffset + dst.size);
+            }
+        }
+    }
+
+    Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
+    Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
+
+    GetCoreInterfaceImpl().CmdCopyBufferRegions(*GetImpl(), *dstBufferImpl, *srcBufferImpl, regions, regionNum);
+}
+
 NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
@@ -449,6 +727,9 @@ NRI_INLINE void CommandBufferVal::Barrier(const BarrierDesc& barrierDesc) {
             return;
     }
 
+    for (uint32_t i = 0; i < barrierDesc.bufferNum; i++)
+        TrackBufferBarrier(i, barrierDesc.buffers[i]);
+
     Scratch<BufferBarrierDesc> buffers = AllocateScratch(m_Device, BufferBarrierDesc, barrierDesc.bufferNum);
     memcpy(buffers, barrierDesc.buffers, sizeof(BufferBarrierDesc) * barrierDesc.bufferNum);
     for (uint32_t i = 0; i < barrierDesc.bufferNum; i++)
@@ -469,6 +750,52 @@ NRI_INLINE void CommandBufferVal::Barrier(const BarrierDesc& barrierDesc) {
     GetCoreInterfaceImpl().CmdBarrier(*GetImpl(), barrierGroupDescImpl);
 }
 
+NRI_INLINE void CommandBufferVal::TrackBufferBarrier(uint32_t i, const BufferBarrierDesc& bufferBarrier) {
+    const BufferVal& bufferVal = *(const BufferVal*)bufferBarrier.buffer;
+
+    uint64_t offset = bufferBarrier.offset;
+    uint64_t end = bufferBarrier.size == WHOLE_SIZE ? bufferVal.GetDesc().size : offset + bufferBarrier.size;
+
+    // Only overlapping ranges can conflict. Overlapped parts of the tracked ranges get replaced by the new range
+    size_t rangeNum = m_BufferRanges.size();
+    for (size_t j = 0; j < rangeNum;) {
+        BufferRangeState& range = m_BufferRanges[j];
+        if (range.buffer != bufferBarrier.buffer || range.end <= offset || end <= range.offset) {
+            j++;
+            continue;
+        }
+
+        if ((range.after.access & bufferBarrier.before.access) != (uint32_t)range.after.access) {
+            REPORT_WARNING(&m_Device, "'bufferBarrier.buffers[%u].before' doesn't cover 'after' of a previous barrier of the range [%" PRIu64 ", %" PRIu64 ") of the buffer ('%s')",
+                i, range.offset, range.end, bufferVal.GetDebugName());
+        }
+
+        BufferRangeState left = range;
+        left.end = offset;
+
+        BufferRangeState right = range;
+        right.offset = end;
+
+        if (left.offset < left.end) {
+            range = left;
+            if (right.offset < right.end)
+                m_BufferRanges.push_back(right);
+
+            j++;
+        } else if (right.offset < right.end) {
+            range = right;
+            j++;
+        } else {
+            m_BufferRanges[j] = m_BufferRanges[rangeNum - 1];
+            m_BufferRanges[rangeNum - 1] = m_BufferRanges.back();
+            m_BufferRanges.pop_back();
+            rangeNum--;
+        }
+    }
+
+    m_BufferRanges.push_back({bufferBarrier.buffer, offset, end, bufferBarrier.after});
+}
+
 NRI_INLINE void CommandBufferVal::BeginQuery(QueryPool& queryPool, uint32_t offset) {
     QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
 
@@ -751,6 +1078,7 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasks(const DrawMeshTasksDesc& drawMes
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
     RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
 
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasks(*GetImpl(), drawMeshTasksDesc);
@@ -762,6 +1090,7 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
     RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
     RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
@@ -772,6 +1101,52 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasksIndirect(*GetImpl(), *bufferImpl, offset, drawNum, stride, countBufferImpl, countBufferOffset);
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_Pipeline, ReturnVoid(), "a pipeline must be bound");
+    RETURN_ON_FAILURE(&m_Device, !m_Pipeline->IsGraphics() || m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_Pipeline->IsGraphics() || !GetMissingDynamicState(), ReturnVoid(), "dynamic state 0x%X is enabled in the pipeline, but not set", GetMissingDynamicState());
+    RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.indirectCommandLayout, ReturnVoid(), "'indirectCommandLayout' is NULL");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.buffer, ReturnVoid(), "'buffer' is NULL");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.sequenceMaxNum != 0, ReturnVoid(), "'sequenceMaxNum' is 0");
+
+    const IndirectCommandLayoutVal& indirectCommandLayoutVal = *(IndirectCommandLayoutVal*)executeIndirectCommandsDesc.indirectCommandLayout;
+    bool isDispatch = indirectCommandLayoutVal.GetActionType() == IndirectCommandType::DISPATCH;
+    RETURN_ON_FAILURE(&m_Device, !isDispatch || !m_Pipeline->IsGraphics(), ReturnVoid(), "'indirectCommandLayout' dispatches, but the bound pipeline is a graphics pipeline");
+    RETURN_ON_FAILURE(&m_Device, isDispatch || !m_Pipeline->IsCompute(), ReturnVoid(), "'indirectCommandLayout' draws, but the bound pipeline is a compute pipeline");
+
+    const BufferDesc& bufferDesc = ((BufferVal*)executeIndirectCommandsDesc.buffer)->GetDesc();
+    uint64_t size = (uint64_t)executeIndirectCommandsDesc.sequenceMaxNum * indirectCommandLayoutVal.GetStride();
+
+    RETURN_ON_FAILURE(&m_Device, bufferDesc.usage & BufferUsageBits::ARGUMENT_BUFFER, ReturnVoid(), "'buffer' must have 'ARGUMENT_BUFFER' usage");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.offset + size <= bufferDesc.size, ReturnVoid(), "'sequenceMaxNum' sequences at 'offset' are out of bounds");
+
+    if (executeIndirectCommandsDesc.countBuffer) {
+        const BufferDesc& countBufferDesc = ((BufferVal*)executeIndirectCommandsDesc.countBuffer)->GetDesc();
+        RETURN_ON_FAILURE(&m_Device, countBufferDesc.usage & BufferUsageBits::ARGUMENT_BUFFER, ReturnVoid(), "'countBuffer' must have 'ARGUMENT_BUFFER' usage");
+        RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.countBufferOffset + sizeof(uint32_t) <= countBufferDesc.size, ReturnVoid(), "'countBufferOffset' is out of bounds");
+    }
+
+    // The native path needs a preprocess buffer if the size is non-zero
+    uint64_t preprocessSize = GetIndirectCommandsInterfaceImpl().GetIndirectCommandsPreprocessSize(*indirectCommandLayoutVal.GetImpl(), *m_Pipeline->GetImpl(), executeIndirectCommandsDesc.sequenceMaxNum);
+    if (preprocessSize)
+        RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.preprocessBuffer, ReturnVoid(), "'preprocessBuffer' is NULL, but 'GetIndirectCommandsPreprocessSize' is %" PRIu64 " bytes", preprocessSize);
+
+    if (executeIndirectCommandsDesc.preprocessBuffer) {
+        const BufferDesc& preprocessBufferDesc = ((BufferVal*)executeIndirectCommandsDesc.preprocessBuffer)->GetDesc();
+        RETURN_ON_FAILURE(&m_Device, preprocessBufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER, ReturnVoid(), "'preprocessBuffer' must have 'PREPROCESS_BUFFER' usage");
+        RETURN_ON_FAILURE(&m_Device, preprocessBufferDesc.size >= preprocessSize, ReturnVoid(), "'preprocessBuffer' is too small, at least %" PRIu64 " bytes are needed", preprocessSize);
+    }
+
+    auto executeIndirectCommandsDescImpl = executeIndirectCommandsDesc;
+    executeIndirectCommandsDescImpl.indirectCommandLayout = NRI_GET_IMPL(IndirectCommandLayout, executeIndirectCommandsDesc.indirectCommandLayout);
+    executeIndirectCommandsDescImpl.buffer = NRI_GET_IMPL(Buffer, executeIndirectCommandsDesc.buffer);
+    executeIndirectCommandsDescImpl.countBuffer = NRI_GET_IMPL(Buffer, executeIndirectCommandsDesc.countBuffer);
+    executeIndirectCommandsDescImpl.preprocessBuffer = NRI_GET_IMPL(Buffer, executeIndirectCommandsDesc.preprocessBuffer);
+
+    GetIndirectCommandsInterfaceImpl().CmdExecuteIndirectCommands(*GetImpl(), executeIndirectCommandsDescImpl);
+}
+
 NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
     if (m_Pipeline && m_DepthStencil) {
         if (m_DepthStencil->IsDepthReadonly() && m_Pipeline->WritesToDepth())
@@ -781,3 +1156,26 @@ NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
             REPORT_WARNING(&m_Device, "Stencil is read-only, but the pipeline writes to stencil. Writing happens only in VK!");
     }
 }
+
+NRI_INLINE void CommandBufferVal::SetAttachments(const AttachmentsDesc& attachmentsDesc) {
+    m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
+
+    size_t i = 0;
+    for (; i < m_RenderTargetNum; i++)
+        m_RenderTargets[i] = (DescriptorVal*)attachmentsDesc.colors[i];
+    for (; i < m_RenderTargets.size(); i++)
+        m_RenderTargets[i] = nullptr;
+
+    if (attachmentsDesc.depthStencil)
+        m_DepthStencil = (DescriptorVal*)attachmentsDesc.depthStencil;
+    else
+        m_DepthStencil = nullptr;
+}
+
+NRI_INLINE void CommandBufferVal::ResetState() {
+    m_Pipeline = nullptr;
+    m_PipelineLayout = nullptr;
+    m_PipelineDynamicState = DynamicStateBits::NONE;
+    m_DynamicState = DynamicStateBits::NONE;
+    m_BufferRanges.clear();
+}
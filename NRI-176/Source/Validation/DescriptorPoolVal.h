@@ -10,6 +10,7 @@ struct DescriptorPoolVal final : public ObjectVal {
     DescriptorPoolVal(DeviceVal& device, DescriptorPool* descriptorPool, uint32_t descriptorSetMaxNum)
         : ObjectVal(device, descriptorPool)
         , m_DescriptorSets(device.GetStdAllocator())
+        , m_ChainedDescriptorSets(device.GetStdAllocator())
         , m_SkipValidation(true) // TODO: we have to request "DescriptorPoolDesc" in "DescriptorPoolVKDesc"
     {
         m_Desc.descriptorSetMaxNum = descriptorSetMaxNum;
@@ -21,12 +22,15 @@ struct DescriptorPoolVal final : public ObjectVal {
     DescriptorPoolVal(DeviceVal& device, DescriptorPool* descriptorPool, const DescriptorPoolDesc& descriptorPoolDesc)
         : ObjectVal(device, descriptorPool)
         , m_Desc(descriptorPoolDesc)
-        , m_DescriptorSets(device.GetStdAllocator()) {
+        , m_DescriptorSets(device.GetStdAllocator())
+        , m_ChainedDescriptorSets(device.GetStdAllocator()) {
         m_DescriptorSets.reserve(m_Desc.descriptorSetMaxNum);
         for (uint32_t i = 0; i < m_Desc.descriptorSetMaxNum; i++)
             m_DescriptorSets.emplace_back(DescriptorSetVal(device));
     }
 
+    ~DescriptorPoolVal();
+
     inline DescriptorPool* GetImpl() const {
         return (DescriptorPool*)m_Impl;
     }
@@ -36,11 +40,16 @@ struct DescriptorPoolVal final : public ObjectVal {
     //================================================================================================================
 
     void Reset();
+    void GetStats(DescriptorPoolStats& descriptorPoolStats);
     Result AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
 
+private:
+    DescriptorSetVal* GetNextDescriptorSet();
+
 private:
     DescriptorPoolDesc m_Desc = {}; // .natvis
     Vector<DescriptorSetVal> m_DescriptorSets;
+    Vector<DescriptorSetVal*> m_ChainedDescriptorSets; // "GROWABLE" only, individually allocated to keep returned pointers valid
     uint32_t m_DescriptorSetsNum = 0;
     uint32_t m_SamplerNum = 0;
     uint32_t m_ConstantBufferNum = 0;
@@ -1,5 +1,23 @@
 // © 2021 NVIDIA Corporation
 
+DescriptorPoolVal::~DescriptorPoolVal() {
+    for (DescriptorSetVal* descriptorSetVal : m_ChainedDescriptorSets)
+        Destroy(descriptorSetVal);
+}
+
+DescriptorSetVal* DescriptorPoolVal::GetNextDescriptorSet() {
+    uint32_t index = m_DescriptorSetsNum++;
+    if (index < m_DescriptorSets.size())
+        return &m_DescriptorSets[index];
+
+    // Chained descriptor sets are reused after "Reset"
+    index -= (uint32_t)m_DescriptorSets.size();
+    if (index == m_ChainedDescriptorSets.size())
+        m_ChainedDescriptorSets.push_back(Allocate<DescriptorSetVal>(m_Device.GetAllocationCallbacks(), m_Device));
+
+    return m_ChainedDescriptorSets[index];
+}
+
 NRI_INLINE void DescriptorPoolVal::Reset() {
     m_DescriptorSetsNum = 0;
     m_SamplerNum = 0;
@@ -15,16 +33,23 @@ NRI_INLINE void DescriptorPoolVal::Reset() {
     GetCoreInterfaceImpl().ResetDescriptorPool(*GetImpl());
 }
 
+NRI_INLINE void DescriptorPoolVal::GetStats(DescriptorPoolStats& descriptorPoolStats) {
+    GetCoreInterfaceImpl().GetDescriptorPoolStats(*GetImpl(), descriptorPoolStats);
+}
+
 NRI_INLINE Result DescriptorPoolVal::AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     RETURN_ON_FAILURE(&m_Device, instanceNum != 0, Result::INVALID_ARGUMENT, "'instanceNum' is 0");
-    RETURN_ON_FAILURE(&m_Device, m_DescriptorSetsNum + instanceNum <= m_Desc.descriptorSetMaxNum, Result::INVALID_ARGUMENT, "the maximum number of descriptor sets exceeded");
+
+    // A growable pool can't run out of descriptors
+    bool isGrowable = m_Desc.flags & DescriptorPoolBits::GROWABLE;
+    RETURN_ON_FAILURE(&m_Device, isGrowable || m_DescriptorSetsNum + instanceNum <= m_Desc.descriptorSetMaxNum, Result::INVALID_ARGUMENT, "the maximum number of descriptor sets exceeded");
 
     const PipelineLayoutVal& pipelineLayoutVal = (PipelineLayoutVal&)pipelineLayout;
     const PipelineLayoutDesc& pipelineLayoutDesc = pipelineLayoutVal.GetPipelineLayoutDesc();
     RETURN_ON_FAILURE(&m_Device, m_SkipValidation || setIndex < pipelineLayoutDesc.descriptorSetNum, Result::INVALID_ARGUMENT, "'setIndex' is invalid");
 
     const DescriptorSetDesc& descriptorSetDesc = pipelineLayoutDesc.descriptorSets[setIndex];
-    if (!m_SkipValidation) {
+    if (!m_SkipValidation && !isGrowable) {
         for (uint32_t i = 0; i < instanceNum; i++) {
             for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++) {
                 const DescriptorRangeDesc& rangeDesc = descriptorSetDesc.ranges[j];
@@ -88,7 +113,7 @@ NRI_INLINE Result DescriptorPoolVal::AllocateDescriptorSets(const PipelineLayout
         return result;
 
     for (uint32_t i = 0; i < instanceNum; i++) {
-        DescriptorSetVal* descriptorSetVal = &m_DescriptorSets[m_DescriptorSetsNum++];
+        DescriptorSetVal* descriptorSetVal = GetNextDescriptorSet();
         descriptorSetVal->SetImpl(descriptorSets[i], &descriptorSetDesc);
         descriptorSets[i] = (DescriptorSet*)descriptorSetVal;
     }
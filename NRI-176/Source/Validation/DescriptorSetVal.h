@@ -19,6 +19,12 @@ struct DescriptorSetVal final : public ObjectVal {
 
     void SetImpl(DescriptorSet* impl, const DescriptorSetDesc* desc);
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    void UpdateDescriptorSet(const Descriptor* const* descriptors);
+
 private:
     const DescriptorSetDesc* m_Desc = nullptr; // .natvis
 };
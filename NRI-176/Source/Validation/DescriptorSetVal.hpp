@@ -4,3 +4,24 @@ NRI_INLINE void DescriptorSetVal::SetImpl(DescriptorSet* impl, const DescriptorS
     m_Impl = impl;
     m_Desc = desc;
 }
+
+NRI_INLINE void DescriptorSetVal::UpdateDescriptorSet(const Descriptor* const* descriptors) {
+    RETURN_ON_FAILURE(&m_Device, descriptors != nullptr, ReturnVoid(), "'descriptors' is NULL");
+
+    uint32_t descriptorNum = 0;
+    for (uint32_t i = 0; i < m_Desc->rangeNum; i++) {
+        const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[i];
+        RETURN_ON_FAILURE(&m_Device, !(rangeDesc.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY), ReturnVoid(), "'ranges[%u]' is a variable sized array, use 'UpdateDescriptorRanges' instead", i);
+
+        descriptorNum += rangeDesc.descriptorNum;
+    }
+
+    Scratch<Descriptor*> descriptorsImpl = AllocateScratch(m_Device, Descriptor*, descriptorNum);
+    for (uint32_t i = 0; i < descriptorNum; i++) {
+        RETURN_ON_FAILURE(&m_Device, descriptors[i] != nullptr, ReturnVoid(), "'descriptors[%u]' is NULL", i);
+
+        descriptorsImpl[i] = NRI_GET_IMPL(Descriptor, descriptors[i]);
+    }
+
+    GetCoreInterfaceImpl().UpdateDescriptorSet(*GetImpl(), descriptorsImpl);
+}
@@ -7,13 +7,14 @@ namespace nri {
 struct QueueVal;
 
 struct IsExtSupported {
-    uint32_t lowLatency   : 1;
-    uint32_t meshShader   : 1;
-    uint32_t rayTracing   : 1;
-    uint32_t swapChain    : 1;
-    uint32_t wrapperD3D11 : 1;
-    uint32_t wrapperD3D12 : 1;
-    uint32_t wrapperVK    : 1;
+    uint32_t indirectCommands : 1;
+    uint32_t lowLatency       : 1;
+    uint32_t meshShader       : 1;
+    uint32_t rayTracing       : 1;
+    uint32_t swapChain        : 1;
+    uint32_t wrapperD3D11     : 1;
+    uint32_t wrapperD3D12     : 1;
+    uint32_t wrapperVK        : 1;
 };
 
 struct DeviceVal final : public DeviceBase {
@@ -36,6 +37,10 @@ struct DeviceVal final : public DeviceBase {
         return m_iHelperImpl;
     }
 
+    inline const IndirectCommandsInterface& GetIndirectCommandsInterfaceImpl() const {
+        return m_iIndirectCommandsImpl;
+    }
+
     inline const LowLatencyInterface& GetLowLatencyInterfaceImpl() const {
         return m_iLowLatencyImpl;
     }
@@ -101,7 +106,10 @@ struct DeviceVal final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(BindlessHeapInterface& table) const override;
+    Result FillFunctionTable(DescriptorAllocatorInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
@@ -158,6 +166,7 @@ struct DeviceVal final : public DeviceBase {
     Result CreateAccelerationStructure(const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure);
     Result CreateAccelerationStructure(const AccelerationStructureVKDesc& accelerationStructureVKDesc, AccelerationStructure*& accelerationStructure);
     Result CreateAccelerationStructure(const AccelerationStructureD3D12Desc& accelerationStructureD3D12Desc, AccelerationStructure*& accelerationStructure);
+    Result CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout);
     Result CreateCommittedBuffer(MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer);
     Result CreateCommittedTexture(MemoryLocation memoryLocation, float priority, const TextureDesc& textureDesc, Texture*& texture);
     Result CreateCommittedMicromap(MemoryLocation memoryLocation, float priority, const MicromapDesc& micromapDesc, Micromap*& micromap);
@@ -188,10 +197,13 @@ struct DeviceVal final : public DeviceBase {
     void DestroyCommandBuffer(CommandBuffer* commandBuffer);
     void DestroyCommandAllocator(CommandAllocator* commandAllocator);
     void DestroyAccelerationStructure(AccelerationStructure* accelerationStructure);
+    void DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout);
     void CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum);
     void UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum);
 
     FormatSupportBits GetFormatSupport(Format format) const;
+    void GetPipelineCreationStats(PipelineCreationStats& pipelineCreationStats) const;
+    void GetDescriptorCacheStats(DescriptorCacheStats& descriptorCacheStats) const;
 
 private:
     char* m_Name = nullptr; // .natvis
@@ -206,6 +218,7 @@ private:
     // Implementation
     CoreInterface m_iCoreImpl = {};
     HelperInterface m_iHelperImpl = {};
+    IndirectCommandsInterface m_iIndirectCommandsImpl = {};
     LowLatencyInterface m_iLowLatencyImpl = {};
     MeshShaderInterface m_iMeshShaderImpl = {};
     RayTracingInterface m_iRayTracingImpl = {};
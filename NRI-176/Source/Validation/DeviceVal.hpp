@@ -72,6 +72,7 @@ bool DeviceVal::Create() {
     result = deviceBaseImpl.FillFunctionTable(m_iHelperImpl);
     RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'HelperInterface' interface");
 
+    m_IsExtSupported.indirectCommands = deviceBaseImpl.FillFunctionTable(m_iIndirectCommandsImpl) == Result::SUCCESS;
     m_IsExtSupported.lowLatency = deviceBaseImpl.FillFunctionTable(m_iLowLatencyImpl) == Result::SUCCESS;
     m_IsExtSupported.meshShader = deviceBaseImpl.FillFunctionTable(m_iMeshShaderImpl) == Result::SUCCESS;
     m_IsExtSupported.rayTracing = deviceBaseImpl.FillFunctionTable(m_iRayTracingImpl) == Result::SUCCESS;
@@ -157,6 +158,7 @@ NRI_INLINE Result DeviceVal::CreateCommandAllocator(const Queue& queue, CommandA
 
 NRI_INLINE Result DeviceVal::CreateDescriptorPool(const DescriptorPoolDesc& descriptorPoolDesc, DescriptorPool*& descriptorPool) {
     RETURN_ON_FAILURE(this, descriptorPoolDesc.mutableMaxNum == 0 || GetDesc().features.mutableDescriptorType, Result::INVALID_ARGUMENT, "'features.mutableDescriptorType' is false");
+    RETURN_ON_FAILURE(this, (descriptorPoolDesc.dynamicConstantBufferMaxNum == 0 && descriptorPoolDesc.dynamicStructuredBufferMaxNum == 0) || GetDesc().features.dynamicDescriptorOffset, Result::INVALID_ARGUMENT, "'features.dynamicDescriptorOffset' is false");
 
     DescriptorPool* descriptorPoolImpl = nullptr;
     Result result = m_iCoreImpl.CreateDescriptorPool(m_Impl, descriptorPoolDesc, descriptorPoolImpl);
@@ -341,6 +343,7 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const SamplerDesc& samplerDesc, De
 
 NRI_INLINE Result DeviceVal::CreatePipelineLayout(const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
     RETURN_ON_FAILURE(this, pipelineLayoutDesc.shaderStages != StageBits::NONE, Result::INVALID_ARGUMENT, "'shaderStages' can't be 'NONE'");
+    RETURN_ON_FAILURE(this, pipelineLayoutDesc.rootDescriptorNum <= GetDesc().pipelineLayout.rootDescriptorMaxNum, Result::INVALID_ARGUMENT, "'rootDescriptorNum' can't be > 'pipelineLayout.rootDescriptorMaxNum'");
 
     Scratch<uint32_t> spaces = AllocateScratch(*this, uint32_t, pipelineLayoutDesc.descriptorSetNum);
 
@@ -354,6 +357,15 @@ NRI_INLINE Result DeviceVal::CreatePipelineLayout(const PipelineLayoutDesc& pipe
             RETURN_ON_FAILURE(this, range.descriptorNum > 0, Result::INVALID_ARGUMENT, "'descriptorSets[%u].ranges[%u].descriptorNum' is 0", i, j);
             RETURN_ON_FAILURE(this, range.descriptorType < DescriptorType::MAX_NUM, Result::INVALID_ARGUMENT, "'descriptorSets[%u].ranges[%u].descriptorType' is invalid", i, j);
 
+            if (range.flags & DescriptorRangeBits::DYNAMIC_OFFSET) {
+                bool isDescriptorTypeValid = range.descriptorType == DescriptorType::CONSTANT_BUFFER || range.descriptorType == DescriptorType::STRUCTURED_BUFFER || range.descriptorType == DescriptorType::STORAGE_STRUCTURED_BUFFER;
+                constexpr DescriptorRangeBits incompatibleBits = DescriptorRangeBits::VARIABLE_SIZED_ARRAY | DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET | DescriptorRangeBits::MUTABLE;
+
+                RETURN_ON_FAILURE(this, GetDesc().features.dynamicDescriptorOffset, Result::INVALID_ARGUMENT, "'features.dynamicDescriptorOffset' is false");
+                RETURN_ON_FAILURE(this, isDescriptorTypeValid, Result::INVALID_ARGUMENT, "'descriptorSets[%u].ranges[%u].descriptorType' must be one of 'CONSTANT_BUFFER', 'STRUCTURED_BUFFER' or 'STORAGE_STRUCTURED_BUFFER' for 'DYNAMIC_OFFSET'", i, j);
+                RETURN_ON_FAILURE(this, !(range.flags & incompatibleBits), Result::INVALID_ARGUMENT, "'descriptorSets[%u].ranges[%u].flags': 'DYNAMIC_OFFSET' can't be combined with 'VARIABLE_SIZED_ARRAY', 'ALLOW_UPDATE_AFTER_SET' or 'MUTABLE'", i, j);
+            }
+
             if (range.shaderStages != StageBits::ALL) {
                 const uint32_t filteredVisibilityMask = range.shaderStages & pipelineLayoutDesc.shaderStages;
 
@@ -461,6 +473,12 @@ NRI_INLINE Result DeviceVal::CreatePipeline(const GraphicsPipelineDesc& graphics
     if (graphicsPipelineDesc.outputMerger.logicOp != LogicOp::NONE)
         RETURN_ON_FAILURE(this, GetDesc().features.logicOp, Result::INVALID_ARGUMENT, "'features.logicOp' is false");
 
+    if (graphicsPipelineDesc.dynamicState != DynamicStateBits::NONE)
+        RETURN_ON_FAILURE(this, GetDesc().features.dynamicState, Result::INVALID_ARGUMENT, "'features.dynamicState' is false");
+
+    if (graphicsPipelineDesc.dynamicState & DynamicStateBits::BLEND)
+        RETURN_ON_FAILURE(this, GetDesc().features.dynamicBlendState, Result::INVALID_ARGUMENT, "'features.dynamicBlendState' is false");
+
     if (graphicsPipelineDesc.outputMerger.viewMask != 0)
         RETURN_ON_FAILURE(this, GetDesc().features.flexibleMultiview || GetDesc().features.layerBasedMultiview || GetDesc().features.viewportBasedMultiview, Result::INVALID_ARGUMENT, "multiview is not supported");
 
@@ -989,6 +1007,14 @@ NRI_INLINE FormatSupportBits DeviceVal::GetFormatSupport(Format format) const {
     return m_iCoreImpl.GetFormatSupport(m_Impl, format);
 }
 
+NRI_INLINE void DeviceVal::GetPipelineCreationStats(PipelineCreationStats& pipelineCreationStats) const {
+    m_iCoreImpl.GetPipelineCreationStats(m_Impl, pipelineCreationStats);
+}
+
+NRI_INLINE void DeviceVal::GetDescriptorCacheStats(DescriptorCacheStats& descriptorCacheStats) const {
+    m_iCoreImpl.GetDescriptorCacheStats(m_Impl, descriptorCacheStats);
+}
+
 #if NRI_ENABLE_VK_SUPPORT
 
 NRI_INLINE Result DeviceVal::CreateCommandAllocator(const CommandAllocatorVKDesc& commandAllocatorVKDesc, CommandAllocator*& commandAllocator) {
@@ -1014,7 +1040,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferVKDesc& comm
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true, false);
 
     return result;
 }
@@ -1144,7 +1170,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D11Desc& c
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true, false);
 
     return result;
 }
@@ -1187,7 +1213,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D12Desc& c
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true, false);
 
     return result;
 }
@@ -1529,3 +1555,48 @@ NRI_INLINE void DeviceVal::DestroyMicromap(Micromap* micromap) {
     m_iRayTracingImpl.DestroyMicromap(NRI_GET_IMPL(Micromap, micromap));
     Destroy((MicromapVal*)micromap);
 }
+
+NRI_INLINE Result DeviceVal::CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commands != nullptr, Result::INVALID_ARGUMENT, "'commands' is NULL");
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commandNum != 0, Result::INVALID_ARGUMENT, "'commandNum' is 0");
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.stride != 0 && indirectCommandLayoutDesc.stride % 4 == 0, Result::INVALID_ARGUMENT, "'stride' must be a non-zero multiple of 4");
+
+    const PipelineLayoutVal* pipelineLayoutVal = (PipelineLayoutVal*)indirectCommandLayoutDesc.pipelineLayout;
+
+    for (uint32_t i = 0; i < indirectCommandLayoutDesc.commandNum; i++) {
+        const IndirectCommandDesc& command = indirectCommandLayoutDesc.commands[i];
+        bool isAction = command.type == IndirectCommandType::DRAW || command.type == IndirectCommandType::DRAW_INDEXED || command.type == IndirectCommandType::DISPATCH;
+        bool isLast = i == indirectCommandLayoutDesc.commandNum - 1;
+
+        RETURN_ON_FAILURE(this, command.type < IndirectCommandType::MAX_NUM, Result::INVALID_ARGUMENT, "'commands[%u].type' is invalid", i);
+        RETURN_ON_FAILURE(this, command.offset % 4 == 0, Result::INVALID_ARGUMENT, "'commands[%u].offset' must be a multiple of 4", i);
+        RETURN_ON_FAILURE(this, isAction == isLast, Result::INVALID_ARGUMENT, "'commands[%u]': the last command must be the only action command", i);
+
+        if (command.type == IndirectCommandType::ROOT_CONSTANTS) {
+            RETURN_ON_FAILURE(this, pipelineLayoutVal != nullptr, Result::INVALID_ARGUMENT, "'pipelineLayout' is NULL, but 'commands[%u]' sets root constants", i);
+
+            const PipelineLayoutDesc& pipelineLayoutDesc = pipelineLayoutVal->GetPipelineLayoutDesc();
+            RETURN_ON_FAILURE(this, command.rootConstantIndex < pipelineLayoutDesc.rootConstantNum, Result::INVALID_ARGUMENT, "'commands[%u].rootConstantIndex' is out of bounds", i);
+
+            const RootConstantDesc& rootConstantDesc = pipelineLayoutDesc.rootConstants[command.rootConstantIndex];
+            RETURN_ON_FAILURE(this, command.rootConstantSize != 0 && command.rootConstantSize <= rootConstantDesc.size, Result::INVALID_ARGUMENT, "'commands[%u].rootConstantSize' must be in range [1; %u]", i, rootConstantDesc.size);
+        }
+    }
+
+    auto indirectCommandLayoutDescImpl = indirectCommandLayoutDesc;
+    indirectCommandLayoutDescImpl.pipelineLayout = NRI_GET_IMPL(PipelineLayout, indirectCommandLayoutDesc.pipelineLayout);
+
+    IndirectCommandLayout* indirectCommandLayoutImpl = nullptr;
+    Result result = m_iIndirectCommandsImpl.CreateIndirectCommandLayout(m_Impl, indirectCommandLayoutDescImpl, indirectCommandLayoutImpl);
+
+    indirectCommandLayout = nullptr;
+    if (result == Result::SUCCESS)
+        indirectCommandLayout = (IndirectCommandLayout*)Allocate<IndirectCommandLayoutVal>(GetAllocationCallbacks(), *this, indirectCommandLayoutImpl, indirectCommandLayoutDesc.stride, indirectCommandLayoutDesc.commands[indirectCommandLayoutDesc.commandNum - 1].type);
+
+    return result;
+}
+
+NRI_INLINE void DeviceVal::DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    m_iIndirectCommandsImpl.DestroyIndirectCommandLayout(NRI_GET_IMPL(IndirectCommandLayout, indirectCommandLayout));
+    Destroy((IndirectCommandLayoutVal*)indirectCommandLayout);
+}
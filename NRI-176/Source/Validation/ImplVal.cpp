@@ -11,6 +11,7 @@
 #include "DescriptorVal.h"
 #include "DeviceVal.h"
 #include "FenceVal.h"
+#include "IndirectCommandLayoutVal.h"
 #include "MemoryVal.h"
 #include "MicromapVal.h"
 #include "PipelineLayoutVal.h"
@@ -20,6 +21,8 @@
 #include "SwapChainVal.h"
 #include "TextureVal.h"
 
+#include "BindlessHeapInterface.h"
+#include "DescriptorAllocatorInterface.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
 #include "StreamerInterface.h"
@@ -37,6 +40,7 @@ using namespace nri;
 #include "DescriptorVal.hpp"
 #include "DeviceVal.hpp"
 #include "FenceVal.hpp"
+#include "IndirectCommandLayoutVal.hpp"
 #include "MemoryVal.hpp"
 #include "MicromapVal.hpp"
 #include "PipelineLayoutVal.hpp"
@@ -96,6 +100,10 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, C
     return ((CommandAllocatorVal&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorVal&)commandAllocator).CreateSecondaryCommandBuffer(commandBuffer);
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
     return ((DeviceVal&)device).CreateFence(initialValue, fence);
 }
@@ -281,6 +289,22 @@ static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint6
     return ((DeviceVal&)device).CreatePlacedTexture(memory, offset, textureDesc, texture);
 }
 
+static Result NRI_CALL OptimizePipeline(Pipeline& pipeline) {
+    return ((PipelineVal&)pipeline).Optimize();
+}
+
+static void NRI_CALL GetPipelineStats(const Pipeline& pipeline, PipelineStats& pipelineStats) {
+    ((PipelineVal&)pipeline).GetStats(pipelineStats);
+}
+
+static void NRI_CALL GetPipelineCreationStats(const Device& device, PipelineCreationStats& pipelineCreationStats) {
+    ((DeviceVal&)device).GetPipelineCreationStats(pipelineCreationStats);
+}
+
+static void NRI_CALL GetDescriptorCacheStats(const Device& device, DescriptorCacheStats& descriptorCacheStats) {
+    ((DeviceVal&)device).GetDescriptorCacheStats(descriptorCacheStats);
+}
+
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     return ((DescriptorPoolVal&)descriptorPool).AllocateDescriptorSets(pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
 }
@@ -295,6 +319,10 @@ static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* upd
     return deviceVal.UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
+static void NRI_CALL UpdateDescriptorSet(DescriptorSet& descriptorSet, const Descriptor* const* descriptors) {
+    ((DescriptorSetVal&)descriptorSet).UpdateDescriptorSet(descriptors);
+}
+
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
     if (!copyDescriptorRangeDescNum)
         return;
@@ -309,10 +337,18 @@ static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
     ((DescriptorPoolVal&)descriptorPool).Reset();
 }
 
+static void NRI_CALL GetDescriptorPoolStats(const DescriptorPool& descriptorPool, DescriptorPoolStats& descriptorPoolStats) {
+    ((DescriptorPoolVal&)descriptorPool).GetStats(descriptorPoolStats);
+}
+
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
     return ((CommandBufferVal&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVal&)commandBuffer).BeginSecondary(attachmentsDesc, descriptorPool);
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferVal&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -325,6 +361,10 @@ static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const Set
     ((CommandBufferVal&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
+static void NRI_CALL CmdSetDescriptorSets(CommandBuffer& commandBuffer, const SetDescriptorSetsDesc& setDescriptorSetsDesc) {
+    ((CommandBufferVal&)commandBuffer).SetDescriptorSets(setDescriptorSetsDesc);
+}
+
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
     ((CommandBufferVal&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
@@ -381,6 +421,26 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferVal&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer& commandBuffer, Topology topology) {
+    ((CommandBufferVal&)commandBuffer).SetTopology(topology);
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer& commandBuffer, CullMode cullMode, bool frontCounterClockwise) {
+    ((CommandBufferVal&)commandBuffer).SetCullMode(cullMode, frontCounterClockwise);
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer& commandBuffer, const DepthAttachmentDesc& depthAttachmentDesc) {
+    ((CommandBufferVal&)commandBuffer).SetDepthState(depthAttachmentDesc);
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer& commandBuffer, const StencilAttachmentDesc& stencilAttachmentDesc) {
+    ((CommandBufferVal&)commandBuffer).SetStencilState(stencilAttachmentDesc);
+}
+
+static void NRI_CALL CmdSetBlendState(CommandBuffer& commandBuffer, uint32_t baseAttachment, const ColorAttachmentDesc* colorAttachmentDescs, uint32_t colorAttachmentNum) {
+    ((CommandBufferVal&)commandBuffer).SetBlendState(baseAttachment, colorAttachmentDescs, colorAttachmentNum);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferVal&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -397,6 +457,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVal&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVal&)commandBuffer).DrawMulti(drawDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVal&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum, stride);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVal&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -405,6 +473,10 @@ static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const
     ((CommandBufferVal&)commandBuffer).DrawIndexedIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
+static void NRI_CALL CmdExecuteCommandBuffers(CommandBuffer& commandBuffer, const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum) {
+    ((CommandBufferVal&)commandBuffer).ExecuteCommandBuffers(commandBuffers, commandBufferNum);
+}
+
 static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
     ((CommandBufferVal&)commandBuffer).EndRendering();
 }
@@ -421,6 +493,10 @@ static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuff
     ((CommandBufferVal&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).CopyBufferRegions(dstBuffer, srcBuffer, regions, regionNum);
+}
+
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferVal&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -445,6 +521,10 @@ static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearSt
     ((CommandBufferVal&)commandBuffer).ClearStorage(clearDesc);
 }
 
+static void NRI_CALL CmdClearStorages(CommandBuffer& commandBuffer, const ClearStorageDesc* clearDescs, uint32_t clearDescNum) {
+    ((CommandBufferVal&)commandBuffer).ClearStorages(clearDescs, clearDescNum);
+}
+
 static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
     ((CommandBufferVal&)commandBuffer).ResetQueries(queryPool, offset, num);
 }
@@ -477,6 +557,10 @@ static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
     return ((CommandBufferVal&)commandBuffer).End();
 }
 
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    ((CommandBufferVal&)commandBuffer).GetStats(commandBufferStats);
+}
+
 static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
     ((QueueVal&)queue).BeginAnnotation(name, bgra);
 }
@@ -586,6 +670,7 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTexture1DView = ::CreateTexture1DView;
@@ -621,13 +706,21 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CreateCommittedTexture = ::CreateCommittedTexture;
     table.CreatePlacedBuffer = ::CreatePlacedBuffer;
     table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.OptimizePipeline = ::OptimizePipeline;
+    table.GetPipelineStats = ::GetPipelineStats;
+    table.GetPipelineCreationStats = ::GetPipelineCreationStats;
+    table.GetDescriptorCacheStats = ::GetDescriptorCacheStats;
     table.AllocateDescriptorSets = ::AllocateDescriptorSets;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.UpdateDescriptorSet = ::UpdateDescriptorSet;
     table.CopyDescriptorRanges = ::CopyDescriptorRanges;
     table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorPoolStats = ::GetDescriptorPoolStats;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetDescriptorSets = ::CmdSetDescriptorSets;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
     table.CmdSetPipeline = ::CmdSetPipeline;
     table.CmdSetRootConstants = ::CmdSetRootConstants;
@@ -643,22 +736,32 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetBlendState = ::CmdSetBlendState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdExecuteCommandBuffers = ::CmdExecuteCommandBuffers;
     table.CmdEndRendering = ::CmdEndRendering;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
+    table.CmdClearStorages = ::CmdClearStorages;
     table.CmdResetQueries = ::CmdResetQueries;
     table.CmdBeginQuery = ::CmdBeginQuery;
     table.CmdEndQuery = ::CmdEndQuery;
@@ -667,6 +770,7 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdEndAnnotation = ::CmdEndAnnotation;
     table.CmdAnnotation = ::CmdAnnotation;
     table.EndCommandBuffer = ::EndCommandBuffer;
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
     table.QueueBeginAnnotation = ::QueueBeginAnnotation;
     table.QueueEndAnnotation = ::QueueEndAnnotation;
     table.QueueAnnotation = ::QueueAnnotation;
@@ -691,6 +795,212 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  BindlessHeap  ]
+
+struct BindlessHeapVal final : public ObjectVal {
+    inline BindlessHeapVal(DeviceVal& device, BindlessHeapImpl* impl, const BindlessHeapDesc& desc)
+        : ObjectVal(device, impl)
+        , m_Desc(desc) {
+    }
+
+    inline BindlessHeapImpl* GetImpl() const {
+        return (BindlessHeapImpl*)m_Impl;
+    }
+
+    inline const BindlessHeapDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+private:
+    BindlessHeapDesc m_Desc = {};
+};
+
+static Result NRI_CALL CreateBindlessHeap(Device& device, const BindlessHeapDesc& bindlessHeapDesc, BindlessHeap*& bindlessHeap) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    const DeviceDesc& deviceDesc = deviceVal.GetDesc();
+
+    RETURN_ON_FAILURE(&deviceVal, deviceDesc.features.mutableDescriptorType, Result::UNSUPPORTED, "'features.mutableDescriptorType' is false");
+    RETURN_ON_FAILURE(&deviceVal, deviceDesc.tiers.bindless, Result::UNSUPPORTED, "'tiers.bindless' is 0");
+    RETURN_ON_FAILURE(&deviceVal, bindlessHeapDesc.descriptorPool, Result::INVALID_ARGUMENT, "'descriptorPool' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, bindlessHeapDesc.slotNum, Result::INVALID_ARGUMENT, "'slotNum' is 0");
+    RETURN_ON_FAILURE(&deviceVal, bindlessHeapDesc.slotNum != BINDLESS_HEAP_INVALID_SLOT, Result::INVALID_ARGUMENT, "'slotNum' is too large");
+    RETURN_ON_FAILURE(&deviceVal, bindlessHeapDesc.shaderStages != StageBits::NONE, Result::INVALID_ARGUMENT, "'shaderStages' is NONE");
+
+    BindlessHeapImpl* impl = Allocate<BindlessHeapImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(bindlessHeapDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessHeap = nullptr;
+    } else
+        bindlessHeap = (BindlessHeap*)Allocate<BindlessHeapVal>(deviceVal.GetAllocationCallbacks(), deviceVal, impl, bindlessHeapDesc);
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessHeap(BindlessHeap* bindlessHeap) {
+    if (!bindlessHeap)
+        return;
+
+    BindlessHeapVal* bindlessHeapVal = (BindlessHeapVal*)bindlessHeap;
+    BindlessHeapImpl* bindlessHeapImpl = bindlessHeapVal->GetImpl();
+
+    Destroy(bindlessHeapImpl);
+    Destroy(bindlessHeapVal);
+}
+
+static const DescriptorSetDesc& NRI_CALL GetBindlessHeapDescriptorSetDesc(const BindlessHeap& bindlessHeap) {
+    const BindlessHeapVal& bindlessHeapVal = (BindlessHeapVal&)bindlessHeap;
+    BindlessHeapImpl* bindlessHeapImpl = bindlessHeapVal.GetImpl();
+
+    return bindlessHeapImpl->GetDescriptorSetDesc();
+}
+
+static DescriptorSet* NRI_CALL GetBindlessHeapDescriptorSet(const BindlessHeap& bindlessHeap) {
+    const BindlessHeapVal& bindlessHeapVal = (BindlessHeapVal&)bindlessHeap;
+    BindlessHeapImpl* bindlessHeapImpl = bindlessHeapVal.GetImpl();
+
+    return bindlessHeapImpl->GetDescriptorSet();
+}
+
+static uint32_t NRI_CALL AllocateBindlessHeapSlot(BindlessHeap& bindlessHeap, const Descriptor& descriptor) {
+    DeviceVal& deviceVal = GetDeviceVal(bindlessHeap);
+    BindlessHeapVal& bindlessHeapVal = (BindlessHeapVal&)bindlessHeap;
+    BindlessHeapImpl* bindlessHeapImpl = bindlessHeapVal.GetImpl();
+
+    const DescriptorVal& descriptorVal = (DescriptorVal&)descriptor;
+    bool isResource = descriptorVal.IsShaderResource() || descriptorVal.IsShaderResourceStorage() || descriptorVal.IsConstantBuffer();
+    RETURN_ON_FAILURE(&deviceVal, isResource, BINDLESS_HEAP_INVALID_SLOT, "'descriptor' must be a resource view (not a sampler or an attachment)");
+
+    uint32_t slot = bindlessHeapImpl->AllocateSlot(descriptor);
+    if (slot == BINDLESS_HEAP_INVALID_SLOT)
+        REPORT_WARNING(&deviceVal, "The bindless heap is full");
+
+    return slot;
+}
+
+static void NRI_CALL FreeBindlessHeapSlot(BindlessHeap& bindlessHeap, uint32_t slot, uint64_t fenceValue) {
+    DeviceVal& deviceVal = GetDeviceVal(bindlessHeap);
+    BindlessHeapVal& bindlessHeapVal = (BindlessHeapVal&)bindlessHeap;
+    BindlessHeapImpl* bindlessHeapImpl = bindlessHeapVal.GetImpl();
+    const BindlessHeapDesc& bindlessHeapDesc = bindlessHeapVal.GetDesc();
+
+    RETURN_ON_FAILURE(&deviceVal, slot < bindlessHeapDesc.slotNum, ReturnVoid(), "'slot=%u' is out of bounds", slot);
+    RETURN_ON_FAILURE(&deviceVal, fenceValue == 0 || bindlessHeapDesc.fence, ReturnVoid(), "'fenceValue' requires 'BindlessHeapDesc::fence'");
+
+    bindlessHeapImpl->FreeSlot(slot, fenceValue);
+}
+
+Result DeviceVal::FillFunctionTable(BindlessHeapInterface& table) const {
+    table.CreateBindlessHeap = ::CreateBindlessHeap;
+    table.DestroyBindlessHeap = ::DestroyBindlessHeap;
+    table.GetBindlessHeapDescriptorSetDesc = ::GetBindlessHeapDescriptorSetDesc;
+    table.GetBindlessHeapDescriptorSet = ::GetBindlessHeapDescriptorSet;
+    table.AllocateBindlessHeapSlot = ::AllocateBindlessHeapSlot;
+    table.FreeBindlessHeapSlot = ::FreeBindlessHeapSlot;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DescriptorAllocator  ]
+
+struct DescriptorAllocatorVal final : public ObjectVal {
+    inline DescriptorAllocatorVal(DeviceVal& device, DescriptorAllocatorImpl* impl)
+        : ObjectVal(device, impl) {
+    }
+
+    inline DescriptorAllocatorImpl* GetImpl() const {
+        return (DescriptorAllocatorImpl*)m_Impl;
+    }
+
+    inline uint64_t& GetFenceValue() {
+        return m_FenceValue;
+    }
+
+private:
+    uint64_t m_FenceValue = 0;
+};
+
+static Result NRI_CALL CreateDescriptorAllocator(Device& device, const DescriptorAllocatorDesc& descriptorAllocatorDesc, DescriptorAllocator*& descriptorAllocator) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    RETURN_ON_FAILURE(&deviceVal, descriptorAllocatorDesc.fence, Result::INVALID_ARGUMENT, "'fence' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, descriptorAllocatorDesc.poolDesc.descriptorSetMaxNum, Result::INVALID_ARGUMENT, "'poolDesc.descriptorSetMaxNum' is 0");
+    RETURN_ON_FAILURE(&deviceVal, descriptorAllocatorDesc.poolMaxNum, Result::INVALID_ARGUMENT, "'poolMaxNum' is 0");
+
+    DescriptorAllocatorImpl* impl = Allocate<DescriptorAllocatorImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(descriptorAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        descriptorAllocator = nullptr;
+    } else
+        descriptorAllocator = (DescriptorAllocator*)Allocate<DescriptorAllocatorVal>(deviceVal.GetAllocationCallbacks(), deviceVal, impl);
+
+    return result;
+}
+
+static void NRI_CALL DestroyDescriptorAllocator(DescriptorAllocator* descriptorAllocator) {
+    if (!descriptorAllocator)
+        return;
+
+    DescriptorAllocatorVal* descriptorAllocatorVal = (DescriptorAllocatorVal*)descriptorAllocator;
+    DescriptorAllocatorImpl* descriptorAllocatorImpl = descriptorAllocatorVal->GetImpl();
+
+    Destroy(descriptorAllocatorImpl);
+    Destroy(descriptorAllocatorVal);
+}
+
+static void NRI_CALL BeginDescriptorAllocatorFrame(DescriptorAllocator& descriptorAllocator, uint64_t fenceValue) {
+    DeviceVal& deviceVal = GetDeviceVal(descriptorAllocator);
+    DescriptorAllocatorVal& descriptorAllocatorVal = (DescriptorAllocatorVal&)descriptorAllocator;
+    DescriptorAllocatorImpl* descriptorAllocatorImpl = descriptorAllocatorVal.GetImpl();
+
+    uint64_t& prevFenceValue = descriptorAllocatorVal.GetFenceValue();
+    RETURN_ON_FAILURE(&deviceVal, fenceValue > prevFenceValue, ReturnVoid(), "'fenceValue=%" PRIu64 "' must be greater than the previous one (%" PRIu64 ")", fenceValue, prevFenceValue);
+    prevFenceValue = fenceValue;
+
+    descriptorAllocatorImpl->BeginFrame(fenceValue);
+}
+
+static DescriptorSet* NRI_CALL AllocateDescriptorSet(DescriptorAllocator& descriptorAllocator, const PipelineLayout& pipelineLayout, uint32_t setIndex, const Descriptor* const* descriptors) {
+    DeviceVal& deviceVal = GetDeviceVal(descriptorAllocator);
+    DescriptorAllocatorVal& descriptorAllocatorVal = (DescriptorAllocatorVal&)descriptorAllocator;
+    DescriptorAllocatorImpl* descriptorAllocatorImpl = descriptorAllocatorVal.GetImpl();
+
+    const PipelineLayoutDesc& pipelineLayoutDesc = ((PipelineLayoutVal&)pipelineLayout).GetPipelineLayoutDesc();
+    RETURN_ON_FAILURE(&deviceVal, setIndex < pipelineLayoutDesc.descriptorSetNum, nullptr, "'setIndex' is invalid");
+
+    DescriptorSet* descriptorSet = descriptorAllocatorImpl->AllocateDescriptorSet(pipelineLayout, setIndex, descriptors);
+    if (!descriptorSet)
+        REPORT_WARNING(&deviceVal, "Failed to allocate a descriptor set (all 'poolMaxNum' pools are in use?)");
+
+    return descriptorSet;
+}
+
+static DescriptorPool* NRI_CALL GetDescriptorAllocatorPool(const DescriptorAllocator& descriptorAllocator) {
+    const DescriptorAllocatorVal& descriptorAllocatorVal = (DescriptorAllocatorVal&)descriptorAllocator;
+    DescriptorAllocatorImpl* descriptorAllocatorImpl = descriptorAllocatorVal.GetImpl();
+
+    return descriptorAllocatorImpl->GetCurrentPool();
+}
+
+Result DeviceVal::FillFunctionTable(DescriptorAllocatorInterface& table) const {
+    table.CreateDescriptorAllocator = ::CreateDescriptorAllocator;
+    table.DestroyDescriptorAllocator = ::DestroyDescriptorAllocator;
+    table.BeginDescriptorAllocatorFrame = ::BeginDescriptorAllocatorFrame;
+    table.AllocateDescriptorSet = ::AllocateDescriptorSet;
+    table.GetDescriptorAllocatorPool = ::GetDescriptorAllocatorPool;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -879,6 +1189,45 @@ Result DeviceVal::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVal&)device).CreateIndirectCommandLayout(indirectCommandLayoutDesc, indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    if (indirectCommandLayout)
+        GetDeviceVal(*indirectCommandLayout).DestroyIndirectCommandLayout(indirectCommandLayout);
+}
+
+static uint64_t NRI_CALL GetIndirectBufferDeviceAddress(const Buffer& buffer) {
+    return ((BufferVal&)buffer).GetIndirectDeviceAddress();
+}
+
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessSize(const IndirectCommandLayout& indirectCommandLayout, const Pipeline& pipeline, uint32_t sequenceMaxNum) {
+    return ((IndirectCommandLayoutVal&)indirectCommandLayout).GetPreprocessSize(pipeline, sequenceMaxNum);
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer& commandBuffer, const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    ((CommandBufferVal&)commandBuffer).ExecuteIndirectCommands(executeIndirectCommandsDesc);
+}
+
+Result DeviceVal::FillFunctionTable(IndirectCommandsInterface& table) const {
+    if (!m_IsExtSupported.indirectCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.GetIndirectBufferDeviceAddress = ::GetIndirectBufferDeviceAddress;
+    table.GetIndirectCommandsPreprocessSize = ::GetIndirectCommandsPreprocessSize;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Low latency  ]
 
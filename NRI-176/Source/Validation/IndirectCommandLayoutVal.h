@@ -0,0 +1,37 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectCommandLayoutVal final : public ObjectVal {
+    inline IndirectCommandLayoutVal(DeviceVal& device, IndirectCommandLayout* indirectCommandLayout, uint32_t stride, IndirectCommandType actionType)
+        : ObjectVal(device, indirectCommandLayout)
+        , m_Stride(stride)
+        , m_ActionType(actionType) {
+    }
+
+    inline IndirectCommandLayout* GetImpl() const {
+        return (IndirectCommandLayout*)m_Impl;
+    }
+
+    inline uint32_t GetStride() const {
+        return m_Stride;
+    }
+
+    inline IndirectCommandType GetActionType() const {
+        return m_ActionType;
+    }
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    uint64_t GetPreprocessSize(const Pipeline& pipeline, uint32_t sequenceMaxNum) const;
+
+private:
+    uint32_t m_Stride = 0;
+    IndirectCommandType m_ActionType = IndirectCommandType::MAX_NUM;
+};
+
+} // namespace nri
@@ -0,0 +1,9 @@
+// © 2025 NVIDIA Corporation
+
+NRI_INLINE uint64_t IndirectCommandLayoutVal::GetPreprocessSize(const Pipeline& pipeline, uint32_t sequenceMaxNum) const {
+    RETURN_ON_FAILURE(&m_Device, sequenceMaxNum != 0, 0, "'sequenceMaxNum' is 0");
+
+    Pipeline* pipelineImpl = NRI_GET_IMPL(Pipeline, &pipeline);
+
+    return GetIndirectCommandsInterfaceImpl().GetIndirectCommandsPreprocessSize(*GetImpl(), *pipelineImpl, sequenceMaxNum);
+}
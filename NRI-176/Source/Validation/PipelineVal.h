@@ -26,16 +26,33 @@ struct PipelineVal final : public ObjectVal {
         return m_WritesToStencil;
     }
 
+    inline bool IsGraphics() const {
+        return m_IsGraphics;
+    }
+
+    inline bool IsCompute() const {
+        return m_IsCompute;
+    }
+
+    inline DynamicStateBits GetDynamicState() const {
+        return m_DynamicState;
+    }
+
     //================================================================================================================
     // NRI
     //================================================================================================================
 
     Result WriteShaderGroupIdentifiers(uint32_t baseShaderGroupIndex, uint32_t shaderGroupNum, void* dst);
+    Result Optimize();
+    void GetStats(PipelineStats& pipelineStats) const;
 
 private:
     const PipelineLayout* m_PipelineLayout = nullptr;
+    DynamicStateBits m_DynamicState = DynamicStateBits::NONE;
     bool m_WritesToDepth = false;
     bool m_WritesToStencil = false;
+    bool m_IsGraphics = false;
+    bool m_IsCompute = false;
 };
 
 } // namespace nri
@@ -9,11 +9,14 @@ PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const GraphicsPi
     , m_PipelineLayout(graphicsPipelineDesc.pipelineLayout) {
     m_WritesToDepth = graphicsPipelineDesc.outputMerger.depth.write;
     m_WritesToStencil = graphicsPipelineDesc.outputMerger.stencil.front.writeMask != 0 || graphicsPipelineDesc.outputMerger.stencil.back.writeMask != 0;
+    m_DynamicState = graphicsPipelineDesc.dynamicState;
+    m_IsGraphics = true;
 }
 
 PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const ComputePipelineDesc& computePipelineDesc)
     : ObjectVal(device, pipeline)
     , m_PipelineLayout(computePipelineDesc.pipelineLayout) {
+    m_IsCompute = true;
 }
 
 PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const RayTracingPipelineDesc& rayTracingPipelineDesc)
@@ -24,3 +27,11 @@ PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const RayTracing
 NRI_INLINE Result PipelineVal::WriteShaderGroupIdentifiers(uint32_t baseShaderGroupIndex, uint32_t shaderGroupNum, void* dst) {
     return GetRayTracingInterfaceImpl().WriteShaderGroupIdentifiers(*GetImpl(), baseShaderGroupIndex, shaderGroupNum, dst);
 }
+
+NRI_INLINE Result PipelineVal::Optimize() {
+    return GetCoreInterfaceImpl().OptimizePipeline(*GetImpl());
+}
+
+NRI_INLINE void PipelineVal::GetStats(PipelineStats& pipelineStats) const {
+    GetCoreInterfaceImpl().GetPipelineStats(*GetImpl(), pipelineStats);
+}
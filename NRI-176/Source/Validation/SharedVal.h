@@ -39,6 +39,10 @@ struct ObjectVal : public DebugNameBaseVal {
         return m_Device.GetHelperInterfaceImpl();
     }
 
+    inline const IndirectCommandsInterface& GetIndirectCommandsInterfaceImpl() const {
+        return m_Device.GetIndirectCommandsInterfaceImpl();
+    }
+
     inline const LowLatencyInterface& GetLowLatencyInterfaceImpl() const {
         return m_Device.GetLowLatencyInterfaceImpl();
     }
@@ -127,7 +131,7 @@ constexpr bool IsAccessMaskSupported(BufferUsageBits usage, AccessBits accessMas
     if (accessMask & AccessBits::CONSTANT_BUFFER)
         isSupported = isSupported && (usage & BufferUsageBits::CONSTANT_BUFFER) != 0;
     if (accessMask & AccessBits::ARGUMENT_BUFFER)
-        isSupported = isSupported && (usage & BufferUsageBits::ARGUMENT_BUFFER) != 0;
+        isSupported = isSupported && (usage & (BufferUsageBits::ARGUMENT_BUFFER | BufferUsageBits::PREPROCESS_BUFFER)) != 0;
     if (accessMask & AccessBits::SCRATCH_BUFFER)
         isSupported = isSupported && (usage & BufferUsageBits::SCRATCH_BUFFER) != 0;
     if (accessMask & (AccessBits::COLOR_ATTACHMENT | AccessBits::SHADING_RATE_ATTACHMENT | AccessBits::DEPTH_STENCIL_ATTACHMENT_READ | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE))
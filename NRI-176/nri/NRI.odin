@@ -66,19 +66,20 @@ CoreInterface :: struct {
 	GetQueue: proc "c" (device: ^Device, queueType: QueueType, queueIndex: u32, queue: ^^Queue) -> Result,
 
 	// Create (doesn't assume allocation of big chunks of memory on the device, but it happens for some entities implicitly)
-	CreateCommandAllocator: proc "c" (queue: ^Queue, commandAllocator: ^^CommandAllocator) -> Result,
-	CreateCommandBuffer:    proc "c" (commandAllocator: ^CommandAllocator, commandBuffer: ^^CommandBuffer) -> Result,
-	CreateFence:            proc "c" (device: ^Device, initialValue: u64, fence: ^^Fence) -> Result,
-	CreateDescriptorPool:   proc "c" (device: ^Device, descriptorPoolDesc: ^DescriptorPoolDesc, descriptorPool: ^^DescriptorPool) -> Result,
-	CreatePipelineLayout:   proc "c" (device: ^Device, pipelineLayoutDesc: ^PipelineLayoutDesc, pipelineLayout: ^^PipelineLayout) -> Result,
-	CreateGraphicsPipeline: proc "c" (device: ^Device, graphicsPipelineDesc: ^GraphicsPipelineDesc, pipeline: ^^Pipeline) -> Result,
-	CreateComputePipeline:  proc "c" (device: ^Device, computePipelineDesc: ^ComputePipelineDesc, pipeline: ^^Pipeline) -> Result,
-	CreateQueryPool:        proc "c" (device: ^Device, queryPoolDesc: ^QueryPoolDesc, queryPool: ^^QueryPool) -> Result,
-	CreateSampler:          proc "c" (device: ^Device, samplerDesc: ^SamplerDesc, sampler: ^^Descriptor) -> Result,
-	CreateBufferView:       proc "c" (bufferViewDesc: ^BufferViewDesc, bufferView: ^^Descriptor) -> Result,
-	CreateTexture1DView:    proc "c" (textureViewDesc: ^Texture1DViewDesc, textureView: ^^Descriptor) -> Result,
-	CreateTexture2DView:    proc "c" (textureViewDesc: ^Texture2DViewDesc, textureView: ^^Descriptor) -> Result,
-	CreateTexture3DView:    proc "c" (textureViewDesc: ^Texture3DViewDesc, textureView: ^^Descriptor) -> Result,
+	CreateCommandAllocator:       proc "c" (queue: ^Queue, commandAllocator: ^^CommandAllocator) -> Result,
+	CreateCommandBuffer:          proc "c" (commandAllocator: ^CommandAllocator, commandBuffer: ^^CommandBuffer) -> Result,
+	CreateSecondaryCommandBuffer: proc "c" (commandAllocator: ^CommandAllocator, commandBuffer: ^^CommandBuffer) -> Result, // requires "features.secondaryCommandBuffer"
+	CreateFence:                  proc "c" (device: ^Device, initialValue: u64, fence: ^^Fence) -> Result,
+	CreateDescriptorPool:         proc "c" (device: ^Device, descriptorPoolDesc: ^DescriptorPoolDesc, descriptorPool: ^^DescriptorPool) -> Result,
+	CreatePipelineLayout:         proc "c" (device: ^Device, pipelineLayoutDesc: ^PipelineLayoutDesc, pipelineLayout: ^^PipelineLayout) -> Result,
+	CreateGraphicsPipeline:       proc "c" (device: ^Device, graphicsPipelineDesc: ^GraphicsPipelineDesc, pipeline: ^^Pipeline) -> Result,
+	CreateComputePipeline:        proc "c" (device: ^Device, computePipelineDesc: ^ComputePipelineDesc, pipeline: ^^Pipeline) -> Result,
+	CreateQueryPool:              proc "c" (device: ^Device, queryPoolDesc: ^QueryPoolDesc, queryPool: ^^QueryPool) -> Result,
+	CreateSampler:                proc "c" (device: ^Device, samplerDesc: ^SamplerDesc, sampler: ^^Descriptor) -> Result,
+	CreateBufferView:             proc "c" (bufferViewDesc: ^BufferViewDesc, bufferView: ^^Descriptor) -> Result,
+	CreateTexture1DView:          proc "c" (textureViewDesc: ^Texture1DViewDesc, textureView: ^^Descriptor) -> Result,
+	CreateTexture2DView:          proc "c" (textureViewDesc: ^Texture2DViewDesc, textureView: ^^Descriptor) -> Result,
+	CreateTexture3DView:          proc "c" (textureViewDesc: ^Texture3DViewDesc, textureView: ^^Descriptor) -> Result,
 
 	// Destroy
 	DestroyCommandAllocator: proc "c" (commandAllocator: ^CommandAllocator),
@@ -121,18 +122,39 @@ CoreInterface :: struct {
 	CreatePlacedBuffer:     proc "c" (device: ^Device, memory: ^Memory, offset: u64, bufferDesc: ^BufferDesc, buffer: ^^Buffer) -> Result,
 	CreatePlacedTexture:    proc "c" (device: ^Device, memory: ^Memory, offset: u64, textureDesc: ^TextureDesc, texture: ^^Texture) -> Result,
 
+	// Pipeline
+	// - "OptimizePipeline" relinks a pipeline created from pipeline libraries (see "enableVKGraphicsPipelineLibrary") with link time optimizations and swaps it in
+	// - it's slow, better call it from a background thread. Command buffers recorded before and after the swap are valid
+	// - NOP if the pipeline is not built from pipeline libraries or already optimized
+	// - "GetPipelineStats" returns creation statistics of a pipeline, "GetPipelineCreationStats" - aggregated over all pipelines created on the device
+	OptimizePipeline:         proc "c" (pipeline: ^Pipeline) -> Result,
+	GetPipelineStats:         proc "c" (pipeline: ^Pipeline, pipelineStats: ^PipelineStats),
+	GetPipelineCreationStats: proc "c" (device: ^Device, pipelineCreationStats: ^PipelineCreationStats),
+
+	// Descriptor cache
+	// - identical "CreateSampler" and "CreateXxxView" calls share native samplers and views (ref-counted), but return different descriptors
+	GetDescriptorCacheStats: proc "c" (device: ^Device, descriptorCacheStats: ^DescriptorCacheStats),
+
 	// Descriptor set management (entities don't require destroying)
 	// - if "ALLOW_UPDATE_AFTER_SET" not used, descriptor sets (and data pointed to by descriptors) must be updated before "CmdSetDescriptorSet"
 	// - if "ALLOW_UPDATE_AFTER_SET" used, descriptor sets (and data pointed to by descriptors) can be updated after "CmdSetDescriptorSet"
 	// - "ResetDescriptorPool" resets the pool and and wipes out all allocated descriptor sets
+	// - "GetDescriptorPoolStats" returns peak usage of the pool, which can be used to size it better next run
+	// - "UpdateDescriptorSet" writes all descriptors of a set at once, "descriptors" go range by range ("descriptorNum" per range). Not for sets with "VARIABLE_SIZED_ARRAY" ranges
 	AllocateDescriptorSets: proc "c" (descriptorPool: ^DescriptorPool, pipelineLayout: ^PipelineLayout, setIndex: u32, descriptorSets: ^^DescriptorSet, instanceNum: u32, variableDescriptorNum: u32) -> Result,
 	UpdateDescriptorRanges: proc "c" (updateDescriptorRangeDescs: ^UpdateDescriptorRangeDesc, updateDescriptorRangeDescNum: u32),
+	UpdateDescriptorSet:    proc "c" (descriptorSet: ^DescriptorSet, descriptors: ^^Descriptor),
 	CopyDescriptorRanges:   proc "c" (copyDescriptorRangeDescs: ^CopyDescriptorRangeDesc, copyDescriptorRangeDescNum: u32),
 	ResetDescriptorPool:    proc "c" (descriptorPool: ^DescriptorPool),
+	GetDescriptorPoolStats: proc "c" (descriptorPool: ^DescriptorPool, descriptorPoolStats: ^DescriptorPoolStats),
 
 	// Command buffer (one time submit)
 	BeginCommandBuffer: proc "c" (commandBuffer: ^CommandBuffer, descriptorPool: ^DescriptorPool) -> Result,
 
+	// Secondary command buffer (one time submit), continues rendering of a primary command buffer started with the same "attachmentsDesc" and "secondaryCommandBuffers = true".
+	// Recording is "inside CmdBeginRendering/CmdEndRendering" until "EndCommandBuffer". The bound state is not inherited, i.e. pipeline layout, pipeline, descriptor sets and etc. must be set again
+	BeginSecondaryCommandBuffer: proc "c" (commandBuffer: ^CommandBuffer, attachmentsDesc: ^AttachmentsDesc, descriptorPool: ^DescriptorPool) -> Result,
+
 	// {                {
 	// Set descriptor pool (initially can be set via "BeginCommandBuffer")
 	CmdSetDescriptorPool: proc "c" (commandBuffer: ^CommandBuffer, descriptorPool: ^DescriptorPool),
@@ -140,13 +162,14 @@ CoreInterface :: struct {
 	// Resource binding (expect "CmdSetPipelineLayout" to be called first)
 	CmdSetPipelineLayout: proc "c" (commandBuffer: ^CommandBuffer, bindPoint: BindPoint, pipelineLayout: ^PipelineLayout),
 	CmdSetDescriptorSet:  proc "c" (commandBuffer: ^CommandBuffer, setDescriptorSetDesc: ^SetDescriptorSetDesc),
+	CmdSetDescriptorSets: proc "c" (commandBuffer: ^CommandBuffer, setDescriptorSetsDesc: ^SetDescriptorSetsDesc), // required for sets with "DYNAMIC_OFFSET" ranges
 	CmdSetRootConstants:  proc "c" (commandBuffer: ^CommandBuffer, setRootConstantsDesc: ^SetRootConstantsDesc),
 	CmdSetRootDescriptor: proc "c" (commandBuffer: ^CommandBuffer, setRootDescriptorDesc: ^SetRootDescriptorDesc),
 
 	// Pipeline
 	CmdSetPipeline: proc "c" (commandBuffer: ^CommandBuffer, pipeline: ^Pipeline),
 
-	// Barrier
+	// Barrier (VK: deferred until the next command, which needs it, and merged with adjacent barriers)
 	CmdBarrier: proc "c" (commandBuffer: ^CommandBuffer, barrierDesc: ^BarrierDesc),
 
 	// Input assembly
@@ -167,6 +190,13 @@ CoreInterface :: struct {
 	// State override
 	CmdSetDepthBias: proc "c" (commandBuffer: ^CommandBuffer, depthBiasDesc: ^DepthBiasDesc), // requires "features.dynamicDepthBias"
 
+	// Dynamic state, if enabled via "GraphicsPipelineDesc::dynamicState" in the current pipeline (must be set before drawing)
+	CmdSetTopology:     proc "c" (commandBuffer: ^CommandBuffer, topology: Topology),
+	CmdSetCullMode:     proc "c" (commandBuffer: ^CommandBuffer, cullMode: CullMode, frontCounterClockwise: bool),
+	CmdSetDepthState:   proc "c" (commandBuffer: ^CommandBuffer, depthAttachmentDesc: ^DepthAttachmentDesc),
+	CmdSetStencilState: proc "c" (commandBuffer: ^CommandBuffer, stencilAttachmentDesc: ^StencilAttachmentDesc),
+	CmdSetBlendState:   proc "c" (commandBuffer: ^CommandBuffer, baseAttachment: u32, colorAttachmentDescs: ^ColorAttachmentDesc, colorAttachmentNum: u32),
+
 	// Graphics
 	CmdBeginRendering: proc "c" (commandBuffer: ^CommandBuffer, attachmentsDesc: ^AttachmentsDesc),
 
@@ -178,12 +208,19 @@ CoreInterface :: struct {
 	CmdDraw:        proc "c" (commandBuffer: ^CommandBuffer, drawDesc: ^DrawDesc),
 	CmdDrawIndexed: proc "c" (commandBuffer: ^CommandBuffer, drawIndexedDesc: ^DrawIndexedDesc),
 
+	// Draw multi (many draws in one call, "stride" is the distance between descs in bytes, 0 means tightly packed)
+	CmdDrawMulti:        proc "c" (commandBuffer: ^CommandBuffer, drawDescs: ^DrawDesc, drawNum: u32, stride: u32),
+	CmdDrawIndexedMulti: proc "c" (commandBuffer: ^CommandBuffer, drawIndexedDescs: ^DrawIndexedDesc, drawNum: u32, stride: u32),
+
 	// Draw indirect:
 	//  - drawNum = min(drawNum, countBuffer ? countBuffer[countBufferOffset] : INF)
 	//  - see "Modified draw command signatures"
 	CmdDrawIndirect:        proc "c" (commandBuffer: ^CommandBuffer, buffer: ^Buffer, offset: u64, drawNum: u32, stride: u32, countBuffer: ^Buffer, countBufferOffset: u64), // "buffer" contains "Draw(Base)Desc" commands
 	CmdDrawIndexedIndirect: proc "c" (commandBuffer: ^CommandBuffer, buffer: ^Buffer, offset: u64, drawNum: u32, stride: u32, countBuffer: ^Buffer, countBufferOffset: u64), // "buffer" contains "DrawIndexed(Base)Desc" commands
 
+	// Secondary command buffers (the only allowed command if "AttachmentsDesc::secondaryCommandBuffers = true"). The bound state is undefined afterwards
+	CmdExecuteCommandBuffers: proc "c" (commandBuffer: ^CommandBuffer, commandBuffers: ^^CommandBuffer, commandBufferNum: u32),
+
 	// }                }
 	CmdEndRendering: proc "c" (commandBuffer: ^CommandBuffer),
 
@@ -193,6 +230,7 @@ CoreInterface :: struct {
 
 	// Copy
 	CmdCopyBuffer:              proc "c" (commandBuffer: ^CommandBuffer, dstBuffer: ^Buffer, dstOffset: u64, srcBuffer: ^Buffer, srcOffset: u64, size: u64),
+	CmdCopyBufferRegions:       proc "c" (commandBuffer: ^CommandBuffer, dstBuffer: ^Buffer, srcBuffer: ^Buffer, regions: ^BufferCopyRegionDesc, regionNum: u32), // destination ranges must not overlap
 	CmdCopyTexture:             proc "c" (commandBuffer: ^CommandBuffer, dstTexture: ^Texture, dstRegion: ^TextureRegionDesc, srcTexture: ^Texture, srcRegion: ^TextureRegionDesc),
 	CmdUploadBufferToTexture:   proc "c" (commandBuffer: ^CommandBuffer, dstTexture: ^Texture, dstRegion: ^TextureRegionDesc, srcBuffer: ^Buffer, srcDataLayout: ^TextureDataLayoutDesc),
 	CmdReadbackTextureToBuffer: proc "c" (commandBuffer: ^CommandBuffer, dstBuffer: ^Buffer, dstDataLayout: ^TextureDataLayoutDesc, srcTexture: ^Texture, srcRegion: ^TextureRegionDesc),
@@ -202,7 +240,8 @@ CoreInterface :: struct {
 	CmdResolveTexture: proc "c" (commandBuffer: ^CommandBuffer, dstTexture: ^Texture, dstRegion: ^TextureRegionDesc, srcTexture: ^Texture, srcRegion: ^TextureRegionDesc), // "features.regionResolve" is needed for region specification
 
 	// Clear (potentially slow)
-	CmdClearStorage: proc "c" (commandBuffer: ^CommandBuffer, clearDesc: ^ClearStorageDesc),
+	CmdClearStorage:  proc "c" (commandBuffer: ^CommandBuffer, clearDesc: ^ClearStorageDesc),
+	CmdClearStorages: proc "c" (commandBuffer: ^CommandBuffer, clearDescs: ^ClearStorageDesc, clearDescNum: u32), // one barrier covers the whole batch, clears can be reordered (overlapping clears must use the same value)
 
 	// Query
 	CmdResetQueries: proc "c" (commandBuffer: ^CommandBuffer, queryPool: ^QueryPool, offset: u32, num: u32),
@@ -216,7 +255,8 @@ CoreInterface :: struct {
 	CmdAnnotation:      proc "c" (commandBuffer: ^CommandBuffer, name: cstring, bgra: u32),
 
 	// }                }
-	EndCommandBuffer: proc "c" (commandBuffer: ^CommandBuffer) -> Result, // D3D11 performs state tracking and resets it there
+	EndCommandBuffer:      proc "c" (commandBuffer: ^CommandBuffer) -> Result,                                // D3D11 performs state tracking and resets it there
+	GetCommandBufferStats: proc "c" (commandBuffer: ^CommandBuffer, commandBufferStats: ^CommandBufferStats), // native commands recorded in between are not tracked
 
 	// Annotations for profiling tools: command queue - D3D11: NOP
 	QueueBeginAnnotation: proc "c" (queue: ^Queue, name: cstring, bgra: u32),
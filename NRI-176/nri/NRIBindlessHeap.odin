@@ -0,0 +1,48 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: a global "resource heap" of mutable descriptors, addressed in shaders by stable indices
+package nri
+
+when ODIN_OS == .Linux {
+	foreign import lib {"libNRI.a", "libNRI_VK.a", "libNRI_Shared.a", "libNRI_Validation.a", "libNRI_NONE.a", "system:stdc++"}
+} else when ODIN_OS == .Windows {
+	foreign import lib {"libNRI.lib", "libNRI_VK.lib", "libNRI_Shared.lib", "libNRI_Validation.lib", "libNRI_NONE.lib", "system:stdc++"}
+}
+
+
+NRI_BINDLESS_HEAP_H :: 1
+
+BindlessHeap :: struct {}
+
+BINDLESS_HEAP_INVALID_SLOT :: max(u32) // returned if the heap is full
+
+// Requires "features.mutableDescriptorType" and "tiers.bindless != 0"
+BindlessHeapDesc :: struct {
+	descriptorPool:      ^DescriptorPool,    // the heap descriptor set is allocated from it (needs "ALLOW_UPDATE_AFTER_SET", 1 set and "slotNum" in "mutableMaxNum"), must outlive the heap and not be reset
+	slotNum:             u32,                // number of descriptors in the heap
+	registerSpace:       u32,                // "space" of the heap descriptor set in pipeline layouts, must be unique
+	baseRegisterIndex:   u32,                // the heap is a single "MUTABLE" array of "slotNum" descriptors starting at this register
+	shaderStages:        StageBits,
+	pipelineLayoutFlags: PipelineLayoutBits, // only "IGNORE_GLOBAL_SPIRV_OFFSETS" matters, must match pipeline layouts accessing the heap
+
+	// Deferred slot reuse
+	fence: ^Fence, // values of this fence are passed to "FreeBindlessHeapSlot"
+}
+
+// Threadsafe: yes
+BindlessHeapInterface :: struct {
+	CreateBindlessHeap:  proc "c" (device: ^Device, bindlessHeapDesc: ^BindlessHeapDesc, bindlessHeap: ^^BindlessHeap) -> Result,
+	DestroyBindlessHeap: proc "c" (bindlessHeap: ^BindlessHeap),
+
+	// Must be added to "PipelineLayoutDesc::descriptorSets" of pipeline layouts accessing the heap
+	GetBindlessHeapDescriptorSetDesc: proc "c" (bindlessHeap: ^BindlessHeap) -> ^DescriptorSetDesc,
+
+	// Statically allocated (never changes), can be bound once per command buffer via "CmdSetDescriptorSet" (along with "descriptorPool")
+	GetBindlessHeapDescriptorSet: proc "c" (bindlessHeap: ^BindlessHeap) -> ^DescriptorSet,
+
+	// (HOST) Write a descriptor into a free slot. Return the slot index for shaders or "BINDLESS_HEAP_INVALID_SLOT" if the heap is full
+	AllocateBindlessHeapSlot: proc "c" (bindlessHeap: ^BindlessHeap, descriptor: ^Descriptor) -> u32,
+
+	// (HOST) The slot gets reused after "fence" reaches "fenceValue" (0 - immediately). The descriptor must not be accessed by the GPU after that
+	FreeBindlessHeapSlot: proc "c" (bindlessHeap: ^BindlessHeap, slot: u32, fenceValue: u64),
+}
@@ -0,0 +1,37 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: contention-free transient descriptor sets, carved from private per-frame descriptor pools
+package nri
+
+when ODIN_OS == .Linux {
+	foreign import lib {"libNRI.a", "libNRI_VK.a", "libNRI_Shared.a", "libNRI_Validation.a", "libNRI_NONE.a", "system:stdc++"}
+} else when ODIN_OS == .Windows {
+	foreign import lib {"libNRI.lib", "libNRI_VK.lib", "libNRI_Shared.lib", "libNRI_Validation.lib", "libNRI_NONE.lib", "system:stdc++"}
+}
+
+
+NRI_DESCRIPTOR_ALLOCATOR_H :: 1
+
+DescriptorAllocator :: struct {}
+
+DescriptorAllocatorDesc :: struct {
+	poolDesc:   DescriptorPoolDesc, // a single pool, more pools get chained if a frame needs more ("GROWABLE" is added implicitly)
+	fence:      ^Fence,             // values of this fence are passed to "BeginDescriptorAllocatorFrame"
+	poolMaxNum: u32,                // max number of pools (all frames in flight), allocations fail if more are needed
+}
+
+// Threadsafe: no (an allocator is owned by a recording thread, allocators don't share pools)
+DescriptorAllocatorInterface :: struct {
+	CreateDescriptorAllocator:  proc "c" (device: ^Device, descriptorAllocatorDesc: ^DescriptorAllocatorDesc, descriptorAllocator: ^^DescriptorAllocator) -> Result,
+	DestroyDescriptorAllocator: proc "c" (descriptorAllocator: ^DescriptorAllocator),
+
+	// Descriptor sets allocated after this call are valid until "fence" reaches "fenceValue". Pools of completed frames get reset and reused
+	BeginDescriptorAllocatorFrame: proc "c" (descriptorAllocator: ^DescriptorAllocator, fenceValue: u64),
+
+	// Bump-allocate a descriptor set and, if "descriptors" is provided, write it at once (see "UpdateDescriptorSet"). Return NULL on failure
+	AllocateDescriptorSet: proc "c" (descriptorAllocator: ^DescriptorAllocator, pipelineLayout: ^PipelineLayout, setIndex: u32, descriptors: ^^Descriptor) -> ^DescriptorSet,
+
+	// The pool of the last allocated descriptor set, it must be bound via "CmdSetDescriptorPool" before the set is bound
+	// A new pool gets chained (i.e. the returned pool changes) if the current one is exhausted in the middle of a frame
+	GetDescriptorAllocatorPool: proc "c" (descriptorAllocator: ^DescriptorAllocator) -> ^DescriptorPool,
+}
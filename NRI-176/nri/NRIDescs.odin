@@ -1547,9 +1547,11 @@ GlobalBarrierDesc :: struct {
 }
 
 BufferBarrierDesc :: struct {
-	buffer: ^Buffer, // use "GetAccelerationStructureBuffer" and "GetMicromapBuffer" for related barriers
+	buffer: ^Buffer,     // use "GetAccelerationStructureBuffer" and "GetMicromapBuffer" for related barriers
 	before: AccessStage,
 	after:  AccessStage,
+	offset: u64,         // VK only, D3D: the whole buffer is used
+	size:   u64,         // can be "WHOLE_SIZE" (the rest of the buffer)
 }
 
 TextureBarrierDesc :: struct {
@@ -1620,6 +1622,7 @@ BufferUsageBits_ :: enum u32 {
 	ACCELERATION_STRUCTURE_STORAGE     = 9,  // Min compatible access:                  Usage:
 	MICROMAP_BUILD_INPUT               = 10, // Min compatible access:                  Usage:
 	MICROMAP_STORAGE                   = 11, // Min compatible access:                  Usage:
+	PREPROCESS_BUFFER                  = 12, // Min compatible access:                  Usage:
 }
 
 // https://registry.khronos.org/vulkan/specs/latest/man/html/VkBufferUsageFlagBits.html
@@ -1892,6 +1895,7 @@ PipelineLayoutBits :: bit_set[PipelineLayoutBits_; i32]
 
 DescriptorPoolBits_ :: enum u32 {
 	NriDescriptorPoolBits_ALLOW_UPDATE_AFTER_SET = 0,
+	NriDescriptorPoolBits_GROWABLE               = 1,
 }
 
 DescriptorPoolBits :: bit_set[DescriptorPoolBits_; i32]
@@ -1908,6 +1912,7 @@ DescriptorRangeBits_ :: enum u32 {
 	VARIABLE_SIZED_ARRAY   = 2,
 	ALLOW_UPDATE_AFTER_SET = 3,
 	MUTABLE                = 4,
+	DYNAMIC_OFFSET         = 5,
 }
 
 // https://registry.khronos.org/vulkan/specs/latest/man/html/VkDescriptorBindingFlagBits.html
@@ -2007,9 +2012,26 @@ DescriptorPoolDesc :: struct {
 	storageStructuredBufferMaxNum: u32, // number of "STORAGE_STRUCTURED_BUFFER" descriptors
 	accelerationStructureMaxNum:   u32, // number of "ACCELERATION_STRUCTURE" descriptors, requires "features.rayTracing"
 	mutableMaxNum:                 u32, // number of descriptors for "DescriptorRangeBits::MUTABLE", requires "features.mutableDescriptorType"
+
+	// Dynamic offset descriptors are not included in the numbers above
+	dynamicConstantBufferMaxNum:   u32, // number of "CONSTANT_BUFFER" descriptors for "DescriptorRangeBits::DYNAMIC_OFFSET", requires "features.dynamicDescriptorOffset"
+	dynamicStructuredBufferMaxNum: u32, // number of "STRUCTURED_BUFFER" and "STORAGE_STRUCTURED_BUFFER" descriptors for "DescriptorRangeBits::DYNAMIC_OFFSET", requires "features.dynamicDescriptorOffset"
 	flags:                         DescriptorPoolBits,
 }
 
+// Can be used to size "DescriptorPoolDesc" better next run
+DescriptorPoolStats :: struct {
+	peakUsage:      DescriptorPoolDesc, // VK: max numbers of allocated descriptor sets and descriptors between resets
+	chainedPoolNum: u32,                // VK: number of native pools, can be > 1 only if "GROWABLE" is set
+}
+
+// VK only, zeros otherwise. Identical views and samplers share native objects
+DescriptorCacheStats :: struct {
+	hitNum:     u64, // number of "CreateSampler" and "CreateXxxView" calls reused an existing native object
+	viewNum:    u32, // live native image and buffer views
+	samplerNum: u32, // live native samplers, must not exceed "samplerAllocationMaxNum"
+}
+
 // Updating/initializing descriptors in a descriptor set
 UpdateDescriptorRangeDesc :: struct {
 	// Destination
@@ -2043,6 +2065,17 @@ SetDescriptorSetDesc :: struct {
 	bindPoint:     BindPoint,
 }
 
+// Binds "descriptorSetNum" sets starting from "baseSetIndex" at once
+// - "dynamicOffsets" go set by set, in binding order within a set (i.e. ordered by register index), one per "DYNAMIC_OFFSET" descriptor
+SetDescriptorSetsDesc :: struct {
+	baseSetIndex:     u32,
+	descriptorSets:   ^^DescriptorSet,
+	descriptorSetNum: u32,
+	dynamicOffsets:   ^u32, // must be aligned to "memoryAlignment.constantBufferOffset" or "memoryAlignment.bufferShaderResourceOffset"
+	dynamicOffsetNum: u32,
+	bindPoint:        BindPoint,
+}
+
 SetRootConstantsDesc :: struct {
 	rootConstantIndex: u32,
 	data:              rawptr,
@@ -2619,11 +2652,12 @@ OutputMergerDesc :: struct {
 }
 
 AttachmentsDesc :: struct {
-	depthStencil: ^Descriptor,
-	shadingRate:  ^Descriptor, // requires "tiers.shadingRate >= 2"
-	colors:       ^^Descriptor,
-	colorNum:     u32,
-	viewMask:     u32,         // if non-0, requires "viewMaxNum > 1"
+	depthStencil:            ^Descriptor,
+	shadingRate:             ^Descriptor, // requires "tiers.shadingRate >= 2"
+	colors:                  ^^Descriptor,
+	colorNum:                u32,
+	viewMask:                u32,         // if non-0, requires "viewMaxNum > 1"
+	secondaryCommandBuffers: bool,        // if "true", the content is provided only by "CmdExecuteCommandBuffers", requires "features.secondaryCommandBuffer"
 }
 
 // https://docs.vulkan.org/guide/latest/robustness.html
@@ -2635,6 +2669,18 @@ Robustness :: enum u32 {
 	MAX_NUM = 4,
 }
 
+DynamicStateBits_ :: enum u32 {
+	TOPOLOGY  = 0,
+	CULL_MODE = 1,
+	DEPTH     = 2,
+	STENCIL   = 3,
+	BLEND     = 4,
+}
+
+// Dynamic state: the corresponding part of "GraphicsPipelineDesc" is ignored, the state must be set via "CmdSetXxx" after "CmdSetPipeline"
+// https://docs.vulkan.org/samples/latest/samples/extensions/dynamic_state3/README.html
+DynamicStateBits :: bit_set[DynamicStateBits_; i32]
+
 // It's recommended to use "NRI.hlsl" in the shader code
 ShaderDesc :: struct {
 	stage:          StageBits,
@@ -2653,6 +2699,7 @@ GraphicsPipelineDesc :: struct {
 	shaders:        ^ShaderDesc,
 	shaderNum:      u32,
 	robustness:     Robustness,
+	dynamicState:   DynamicStateBits, // requires "features.dynamicState"
 }
 
 ComputePipelineDesc :: struct {
@@ -2661,6 +2708,24 @@ ComputePipelineDesc :: struct {
 	robustness:     Robustness,
 }
 
+// VK only ("VK_EXT_pipeline_creation_feedback" for driver-provided values), zeros otherwise
+PipelineStats :: struct {
+	hash:             u64,  // stable across runs (shaders and state, but not "pipelineLayout"), a key for offline precompilation lists
+	creationTime:     u64,  // us, CPU time spent in "CreateXxxPipeline"
+	compilationTime:  u64,  // us, driver-reported, 0 if unknown
+	stageNum:         u32,
+	cacheHitStageNum: u32,  // stages found in a cache, driver-reported
+	cacheHit:         bool, // the whole pipeline was found in a cache, driver-reported
+}
+
+// Device-wide aggregate of "PipelineStats" of all successfully created pipelines
+PipelineCreationStats :: struct {
+	slowestPipelines:   [8]PipelineStats, // sorted by "creationTime", the slowest first
+	totalCreationTime:  u64,              // us
+	pipelineNum:        u32,
+	slowestPipelineNum: u32,              // valid entries in "slowestPipelines"
+}
+
 // https://microsoft.github.io/DirectX-Specs/d3d/CountersAndQueries.html
 // https://registry.khronos.org/vulkan/specs/latest/man/html/VkQueryType.html
 QueryType :: enum u32 {
@@ -2747,6 +2812,12 @@ DrawIndexedBaseDesc :: struct {
 } // see NRI_FILL_DRAW_INDEXED_COMMAND
 
 // Copy
+BufferCopyRegionDesc :: struct {
+	dstOffset: u64,
+	srcOffset: u64,
+	size:      u64, // can be "WHOLE_SIZE" (same rules as in "CmdCopyBuffer")
+}
+
 TextureRegionDesc :: struct {
 	x:           Dim_t,
 	y:           Dim_t,
@@ -2808,6 +2879,34 @@ ClearStorageDesc :: struct {
 	descriptorIndex: u32,
 }
 
+// Counters are reset in "BeginCommandBuffer". Batched commands count each element
+CommandBufferStats :: struct {
+	// Recorded commands
+	recordingTime:     u64, // us, CPU time between "BeginCommandBuffer" and "EndCommandBuffer" (0 until "EndCommandBuffer")
+	rootConstantSize:  u64, // bytes passed to "CmdSetRootConstants"
+	drawNum:           u32, // draws, including multi, indirect and mesh tasks ones (an indirect call is counted once)
+	dispatchNum:       u32, // compute and ray dispatches, including indirect ones
+	descriptorBindNum: u32, // descriptor sets and root descriptors passed to "CmdSetDescriptorSet(s)" and "CmdSetRootDescriptor"
+	copyNum:           u32, // buffer and texture copies, uploads, readbacks, resolves and "CmdZeroBuffer" calls
+	clearNum:          u32, // attachment and storage clears
+
+	// VK only, zeros otherwise. Identical state is not rebound
+	skippedPipelineNum:         u32, // "CmdSetPipeline" calls with the bound pipeline
+	skippedPipelineLayoutNum:   u32, // "CmdSetPipelineLayout" calls with the bound pipeline layout
+	skippedDescriptorSetNum:    u32, // "CmdSetDescriptorSet" calls with the bound descriptor set
+	skippedVertexBufferNum:     u32, // "CmdSetVertexBuffers" calls with the bound vertex buffers
+	skippedIndexBufferNum:      u32, // "CmdSetIndexBuffer" calls with the bound index buffer
+	skippedViewportNum:         u32, // "CmdSetViewports" calls with the current viewports
+	skippedScissorNum:          u32, // "CmdSetScissors" calls with the current scissors
+	skippedStencilReferenceNum: u32, // "CmdSetStencilReference" calls with the current references
+	skippedDepthBiasNum:        u32, // "CmdSetDepthBias" calls and depth bias updates in "CmdSetPipeline" with the current depth bias
+
+	// Barriers
+	requestedBarrierNum: u32, // global, buffer and texture barriers passed to "CmdBarrier"
+	emittedBarrierNum:   u32, // VK only: native barriers after merging (barriers are deferred until the next command, which needs them)
+	barrierBatchNum:     u32, // VK only: "vkCmdPipelineBarrier2" calls
+}
+
 //============================================================================================================================================================================================
 Vendor :: enum u32 {
 	//============================================================================================================================================================================================
@@ -3084,6 +3183,8 @@ DeviceDesc :: struct {
 		copyQueueTimestamp:                              u32, // see "QueryType::TIMESTAMP_COPY_QUEUE"
 		meshShaderPipelineStats:                         u32, // see "PipelineStatisticsDesc"
 		dynamicDepthBias:                                u32, // see "CmdSetDepthBias"
+		dynamicState:                                    u32, // see "DynamicStateBits"
+		dynamicBlendState:                               u32, // see "DynamicStateBits::BLEND"
 		additionalShadingRates:                          u32, // see "ShadingRate"
 		viewportOriginBottomLeft:                        u32, // see "Viewport"
 		regionResolve:                                   u32, // see "CmdResolveTexture"
@@ -3097,6 +3198,8 @@ DeviceDesc :: struct {
 		rootConstantsOffset:                             u32, // see "SetRootConstantsDesc" (unsupported only in D3D11)
 		nonConstantBufferRootDescriptorOffset:           u32, // see "SetRootDescriptorDesc" (unsupported only in D3D11)
 		mutableDescriptorType:                           u32, // see "DescriptorRangeBits::MUTABLE"
+		dynamicDescriptorOffset:                         u32, // see "DescriptorRangeBits::DYNAMIC_OFFSET" (VK only)
+		secondaryCommandBuffer:                          u32, // see "CreateSecondaryCommandBuffer" (VK only)
 	},
 
 	shaderFeatures: struct {
@@ -83,6 +83,9 @@ DeviceCreationDesc :: struct {
 	enableD3D11CommandBufferEmulation: bool, // enable? but why? (auto-enabled if deferred contexts are not supported)
 	enableD3D12RayTracingValidation:   bool, // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
 	enableMemoryZeroInitialization:    bool, // page-clears are fast, but memory is not cleared by default in VK
+	enableVKGraphicsPipelineLibrary:   bool, // link graphics pipelines from cached parts via "VK_EXT_graphics_pipeline_library" (monolithic pipelines if unsupported), see "OptimizePipeline"
+	enableVKShaderObject:              bool, // bind graphics shaders as "VK_EXT_shader_object" objects and set all fixed-function state dynamically (pipelines if unsupported), takes precedence over "enableVKGraphicsPipelineLibrary"
+	enableVKDescriptorBuffer:          bool, // back descriptor pools with host-visible "VK_EXT_descriptor_buffer" memory: updates become CPU writes, binding becomes offset-based (descriptor pools if unsupported)
 
 	// Switches (enabled by default)
 	disableVKRayTracing:          bool, // to save CPU memory in some implementations
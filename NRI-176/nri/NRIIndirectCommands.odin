@@ -0,0 +1,84 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: GPU-generated command sequences, which can change root constants, vertex and index buffers between draws or dispatches
+// https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_device_generated_commands.html
+package nri
+
+when ODIN_OS == .Linux {
+	foreign import lib {"libNRI.a", "libNRI_VK.a", "libNRI_Shared.a", "libNRI_Validation.a", "libNRI_NONE.a", "system:stdc++"}
+} else when ODIN_OS == .Windows {
+	foreign import lib {"libNRI.lib", "libNRI_VK.lib", "libNRI_Shared.lib", "libNRI_Validation.lib", "libNRI_NONE.lib", "system:stdc++"}
+}
+
+
+NRI_INDIRECT_COMMANDS_H :: 1
+
+IndirectCommandLayout :: struct {}
+
+// A sequence is a set of commands, the last command must be an action command
+IndirectCommandType :: enum u32 {
+	ROOT_CONSTANTS = 0, // Data in a sequence:
+	VERTEX_BUFFER  = 1, // Data in a sequence:
+	INDEX_BUFFER   = 2, // Data in a sequence:
+	DRAW           = 3, // Data in a sequence:
+	DRAW_INDEXED   = 4, // Data in a sequence:
+	DISPATCH       = 5, // Data in a sequence:
+	MAX_NUM        = 6, // Data in a sequence:
+} // Data in a sequence:
+
+IndirectVertexBufferDesc :: struct {
+	deviceAddress: u64, // see "GetIndirectBufferDeviceAddress", can be offsetted
+	size:          u32,
+	stride:        u32,
+}
+
+IndirectIndexBufferDesc :: struct {
+	deviceAddress: u64, // see "GetIndirectBufferDeviceAddress", can be offsetted
+	size:          u32,
+	indexType:     u32, // 0 - UINT16, 1 - UINT32
+}
+
+IndirectCommandDesc :: struct {
+	type:              IndirectCommandType,
+	offset:            u32, // offset of the command data in a sequence, must be a multiple of 4
+	rootConstantIndex: u32, // "ROOT_CONSTANTS" only
+	rootConstantSize:  u32, // "ROOT_CONSTANTS" only
+	vertexBufferSlot:  u32, // "VERTEX_BUFFER" only
+}
+
+IndirectCommandLayoutDesc :: struct {
+	pipelineLayout: ^PipelineLayout,      // root constants are taken from this layout
+	commands:       ^IndirectCommandDesc,
+	commandNum:     u32,
+	stride:         u32,                  // sequence size, must be a multiple of 4
+}
+
+ExecuteIndirectCommandsDesc :: struct {
+	indirectCommandLayout: ^IndirectCommandLayout,
+	buffer:                ^Buffer, // "ARGUMENT_BUFFER" usage, contains sequences
+	offset:                u64,
+	sequenceMaxNum:        u32,
+	countBuffer:           ^Buffer, // "ARGUMENT_BUFFER" usage, contains "uint32_t" number of sequences (clamped to "sequenceMaxNum")
+	countBufferOffset:     u64,
+	preprocessBuffer:      ^Buffer, // "PREPROCESS_BUFFER" usage, at least "GetIndirectCommandsPreprocessSize" bytes (not needed if the size is 0)
+}
+
+// Native with "VK_EXT_device_generated_commands", otherwise emulated during recording on the CPU:
+//  - "buffer" and "countBuffer" must be CPU-visible and filled before "CmdExecuteIndirectCommands"
+//  - buffers referenced by "IndirectVertexBufferDesc" and "IndirectIndexBufferDesc" must have memory bound before their addresses are queried
+// Threadsafe: yes
+IndirectCommandsInterface :: struct {
+	CreateIndirectCommandLayout:  proc "c" (device: ^Device, indirectCommandLayoutDesc: ^IndirectCommandLayoutDesc, indirectCommandLayout: ^^IndirectCommandLayout) -> Result,
+	DestroyIndirectCommandLayout: proc "c" (indirectCommandLayout: ^IndirectCommandLayout),
+
+	// Address of a vertex or index buffer for "IndirectVertexBufferDesc" and "IndirectIndexBufferDesc"
+	GetIndirectBufferDeviceAddress: proc "c" (buffer: ^Buffer) -> u64,
+
+	// Size of a preprocess buffer needed to execute up to "sequenceMaxNum" sequences with "pipeline" bound (0 if emulated)
+	GetIndirectCommandsPreprocessSize: proc "c" (indirectCommandLayout: ^IndirectCommandLayout, pipeline: ^Pipeline, sequenceMaxNum: u32) -> u64,
+
+	// Command buffer
+	// {
+	// Sequences are executed with the bound pipeline. Root constants, vertex and index buffers are undefined after the call
+	CmdExecuteIndirectCommands: proc "c" (commandBuffer: ^CommandBuffer, executeIndirectCommandsDesc: ^ExecuteIndirectCommandsDesc),
+}